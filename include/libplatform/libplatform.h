@@ -5,11 +5,16 @@
 #ifndef V8_LIBPLATFORM_LIBPLATFORM_H_
 #define V8_LIBPLATFORM_LIBPLATFORM_H_
 
+#include <iosfwd>
+
 #include "v8-platform.h"  // NOLINT(build/include)
 
 namespace v8 {
 namespace platform {
 
+enum class IdleTaskSupport { kDisabled, kEnabled };
+enum class MessageLoopBehavior { kDoNotWait, kWaitForWork };
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -17,19 +22,59 @@ namespace platform {
  * is the number of worker threads to allocate for background jobs. If a value
  * of zero is passed, a suitable default based on the current number of
  * processors online will be chosen.
+ * If |idle_task_support| is enabled then the embedder must call
+ * |RunIdleTasks| whenever it is idle, or idle tasks will never run.
  */
-v8::Platform* CreateDefaultPlatform(int thread_pool_size = 0);
+v8::Platform* CreateDefaultPlatform(
+    int thread_pool_size = 0,
+    IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled);
 
 
 /**
  * Pumps the message loop for the given isolate.
  *
  * The caller has to make sure that this is called from the right thread.
- * Returns true if a task was executed, and false otherwise. This call does
- * not block if no task is pending. The |platform| has to be created using
- * |CreateDefaultPlatform|.
+ * Returns true if a task was executed, and false otherwise. Unless requested
+ * through the |behavior| parameter, this call does not block if no task is
+ * pending. With |MessageLoopBehavior::kWaitForWork| it sleeps until a task is
+ * posted or the next delayed task is due, and then runs it. The |platform|
+ * has to be created using |CreateDefaultPlatform|.
+ */
+bool PumpMessageLoop(
+    v8::Platform* platform, v8::Isolate* isolate,
+    MessageLoopBehavior behavior = MessageLoopBehavior::kDoNotWait);
+
+
+/**
+ * Runs pending idle tasks for the given isolate for at most
+ * |idle_time_in_seconds| seconds.
+ *
+ * The caller has to make sure that this is called from the right thread. The
+ * |platform| has to be created using |CreateDefaultPlatform| with idle task
+ * support enabled.
+ */
+void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                  double idle_time_in_seconds);
+
+
+/**
+ * Starts recording trace events emitted through the TRACE_EVENT macros.
+ *
+ * |categories| is a comma-separated list of categories, e.g. "v8,v8.gc";
+ * events whose category group contains any of them are recorded. Events are
+ * kept in a fixed-size ring buffer, so only the most recent ones survive a
+ * long recording. Previously recorded events are discarded. The |platform|
+ * has to be created using |CreateDefaultPlatform|.
+ */
+void StartTracing(v8::Platform* platform, const char* categories);
+
+
+/**
+ * Stops recording trace events and writes the recorded ones to |stream| in
+ * the JSON Trace Event Format that chrome://tracing can load. The |platform|
+ * has to be created using |CreateDefaultPlatform|.
  */
-bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate);
+void StopTracing(v8::Platform* platform, std::ostream& stream);
 
 
 }  // namespace platform
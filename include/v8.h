@@ -5207,6 +5207,19 @@ typedef void (*GCCallback)(GCType type, GCCallbackFlags flags);
 
 typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 
+/**
+ * This callback is invoked when V8 is about to fail an allocation because the
+ * old generation has reached its limit, even after a last resort garbage
+ * collection. It receives the current and the initial heap limit in bytes.
+ * Returning a value greater than |current_heap_limit| raises the limit and
+ * the allocation is retried; any other value lets V8 fail with an
+ * out-of-memory error. The callback must not allocate on the V8 heap, but it
+ * may call Isolate::TerminateExecution to stop the running script once the
+ * allocation has succeeded.
+ */
+typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
+                                        size_t initial_heap_limit);
+
 
 /**
  * Collection of V8 heap information.
@@ -5224,6 +5237,7 @@ class V8_EXPORT HeapStatistics {
   size_t used_heap_size() { return used_heap_size_; }
   size_t heap_size_limit() { return heap_size_limit_; }
   size_t malloced_memory() { return malloced_memory_; }
+  size_t peak_malloced_memory() { return peak_malloced_memory_; }
   size_t does_zap_garbage() { return does_zap_garbage_; }
 
  private:
@@ -5234,6 +5248,7 @@ class V8_EXPORT HeapStatistics {
   size_t used_heap_size_;
   size_t heap_size_limit_;
   size_t malloced_memory_;
+  size_t peak_malloced_memory_;
   bool does_zap_garbage_;
 
   friend class V8;
@@ -5850,6 +5865,10 @@ class V8_EXPORT Isolate {
   /**
    * Get statistics about objects in the heap.
    *
+   * Statistics are only available when V8 runs with --track-gc-object-stats.
+   * They are gathered while marking, i.e., mostly during incremental marking
+   * steps, and cover the objects that were live at the last full GC.
+   *
    * \param object_statistics The HeapObjectStatistics object to fill in
    *   statistics of objects of given type, which were live in the previous GC.
    * \param type_index The index of the type of object to fill details about,
@@ -6025,6 +6044,21 @@ class V8_EXPORT Isolate {
    */
   void RemoveGCEpilogueCallback(GCCallback callback);
 
+  /**
+   * Adds a callback that is invoked when the heap is about to run out of
+   * memory. If several callbacks are added, only the most recently added one
+   * is invoked.
+   */
+  void AddNearHeapLimitCallback(NearHeapLimitCallback callback, void* data);
+
+  /**
+   * Removes a callback installed by AddNearHeapLimitCallback. If |heap_limit|
+   * is not zero, a heap limit raised by the callback is lowered back to it,
+   * but not below the current size of the old generation.
+   */
+  void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                   size_t heap_limit);
+
   /**
    * Forcefully terminate the current thread of JavaScript execution
    * in the given isolate.
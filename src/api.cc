@@ -5137,6 +5137,13 @@ class Utf8WriterVisitor {
       }
       // Write the characters to the stream.
       if (sizeof(Char) == 1) {
+        // A leading run of ASCII characters needs no encoding, copy it as is.
+        int ascii_length = i::String::NonAsciiStart(
+            reinterpret_cast<const char*>(chars), fast_length - i);
+        i::MemCopy(buffer, chars, ascii_length);
+        buffer += ascii_length;
+        chars += ascii_length;
+        i += ascii_length;
         for (; i < fast_length; i++) {
           buffer += unibrow::Utf8::EncodeOneByte(
               buffer, static_cast<uint8_t>(*chars++));
@@ -5578,6 +5585,7 @@ HeapStatistics::HeapStatistics()
       used_heap_size_(0),
       heap_size_limit_(0),
       malloced_memory_(0),
+      peak_malloced_memory_(0),
       does_zap_garbage_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
@@ -7253,6 +7261,20 @@ void Isolate::RemoveGCEpilogueCallback(GCCallback callback) {
 }
 
 
+void Isolate::AddNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                       void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->AddNearHeapLimitCallback(callback, data);
+}
+
+
+void Isolate::RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
+                                          size_t heap_limit) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->RemoveNearHeapLimitCallback(callback, heap_limit);
+}
+
+
 void V8::AddGCPrologueCallback(GCCallback callback, GCType gc_type) {
   i::Isolate* isolate = i::Isolate::Current();
   isolate->heap()->AddGCPrologueCallback(
@@ -7468,6 +7490,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->heap_size_limit_ = heap->MaxReserved();
   heap_statistics->malloced_memory_ =
       isolate->allocator()->GetCurrentMemoryUsage();
+  heap_statistics->peak_malloced_memory_ =
+      isolate->allocator()->GetMaxMemoryUsage();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
 }
 
@@ -7727,6 +7751,14 @@ bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   // continue to call IdleNotification.
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   if (!i::FLAG_use_idle_notification) return true;
+  if (i::FLAG_concurrent_recompilation_idle_install &&
+      isolate->concurrent_recompilation_enabled()) {
+    // Install finished optimized code while idle, instead of in an install
+    // interrupt during execution. The deadline is in seconds here.
+    isolate->optimizing_compile_dispatcher()->InstallOptimizedFunctions(
+        deadline_in_seconds *
+        static_cast<double>(base::Time::kMillisecondsPerSecond));
+  }
   return isolate->heap()->IdleNotification(deadline_in_seconds);
 }
 
@@ -58,6 +58,7 @@ class AstRawStringInternalizationKey : public HashTableKey {
       : string_(string) {}
 
   bool IsMatch(Object* other) override {
+    if (HashFieldsDiffer(string_->hash(), String::cast(other))) return false;
     if (string_->is_one_byte_)
       return String::cast(other)->IsOneByteEqualTo(string_->literal_bytes_);
     return String::cast(other)->IsTwoByteEqualTo(
@@ -263,7 +264,9 @@ void AstValueFactory::Internalize(Isolate* isolate) {
     return;
   }
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. Most of them are usually new, so make room for all of them in
+  // the string table up front.
+  StringTable::EnsureCapacityForBulkInsert(isolate, strings_.length());
   for (int i = 0; i < strings_.length(); ++i) {
     strings_[i]->Internalize(isolate);
   }
@@ -10,12 +10,21 @@
 #include <malloc.h>  // NOLINT
 #endif
 
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+
 namespace v8 {
 namespace base {
 
+const size_t AccountingAllocator::kMinPooledSegmentSize;
+const size_t AccountingAllocator::kMaxPooledSegmentSize;
+const size_t AccountingAllocator::kMaxPooledSegmentsPerSize;
+
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
+
 void* AccountingAllocator::Allocate(size_t bytes) {
   void* memory = malloc(bytes);
-  if (memory) NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
+  if (memory) IncreaseMemoryUsage(bytes);
   return memory;
 }
 
@@ -25,9 +34,97 @@ void AccountingAllocator::Free(void* memory, size_t bytes) {
                             -static_cast<AtomicWord>(bytes));
 }
 
+void* AccountingAllocator::AllocateSegment(size_t bytes) {
+  if (IsPooledSegmentSize(bytes)) {
+    size_t index = PoolIndex(bytes);
+    LockGuard<Mutex> lock_guard(&pool_mutex_);
+    PooledSegment* segment = pools_[index];
+    if (segment != nullptr) {
+      pools_[index] = segment->next;
+      pool_lengths_[index]--;
+      NoBarrier_AtomicIncrement(&current_pool_size_,
+                                -static_cast<AtomicWord>(bytes));
+      IncreaseMemoryUsage(bytes);
+      return segment;
+    }
+  }
+  return Allocate(bytes);
+}
+
+void AccountingAllocator::ReturnSegment(void* memory, size_t bytes) {
+  if (IsPooledSegmentSize(bytes)) {
+    size_t index = PoolIndex(bytes);
+    LockGuard<Mutex> lock_guard(&pool_mutex_);
+    if (pool_lengths_[index] < kMaxPooledSegmentsPerSize) {
+      PooledSegment* segment = reinterpret_cast<PooledSegment*>(memory);
+      segment->next = pools_[index];
+      pools_[index] = segment;
+      pool_lengths_[index]++;
+      NoBarrier_AtomicIncrement(&current_memory_usage_,
+                                -static_cast<AtomicWord>(bytes));
+      NoBarrier_AtomicIncrement(&current_pool_size_, bytes);
+      return;
+    }
+  }
+  Free(memory, bytes);
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  for (size_t index = 0; index < kNumberOfPools; index++) {
+    size_t bytes = kMinPooledSegmentSize << index;
+    PooledSegment* segment = pools_[index];
+    while (segment != nullptr) {
+      PooledSegment* next = segment->next;
+      free(segment);
+      NoBarrier_AtomicIncrement(&current_pool_size_,
+                                -static_cast<AtomicWord>(bytes));
+      segment = next;
+    }
+    pools_[index] = nullptr;
+    pool_lengths_[index] = 0;
+  }
+}
+
 size_t AccountingAllocator::GetCurrentMemoryUsage() const {
   return NoBarrier_Load(&current_memory_usage_);
 }
 
+size_t AccountingAllocator::GetMaxMemoryUsage() const {
+  return NoBarrier_Load(&max_memory_usage_);
+}
+
+size_t AccountingAllocator::GetCurrentPoolSize() const {
+  return NoBarrier_Load(&current_pool_size_);
+}
+
+void AccountingAllocator::IncreaseMemoryUsage(size_t bytes) {
+  AtomicWord current = NoBarrier_AtomicIncrement(
+      &current_memory_usage_, static_cast<AtomicWord>(bytes));
+  AtomicWord max = NoBarrier_Load(&max_memory_usage_);
+  while (current > max) {
+    AtomicWord previous =
+        NoBarrier_CompareAndSwap(&max_memory_usage_, max, current);
+    if (previous == max) break;
+    max = previous;
+  }
+}
+
+// static
+bool AccountingAllocator::IsPooledSegmentSize(size_t bytes) {
+  return bytes >= kMinPooledSegmentSize && bytes <= kMaxPooledSegmentSize &&
+         bits::IsPowerOfTwo32(static_cast<uint32_t>(bytes));
+}
+
+// static
+size_t AccountingAllocator::PoolIndex(size_t bytes) {
+  STATIC_ASSERT(kMaxPooledSegmentSize == kMinPooledSegmentSize
+                                           << (kNumberOfPools - 1));
+  DCHECK(IsPooledSegmentSize(bytes));
+  return bits::CountTrailingZeros32(static_cast<uint32_t>(bytes)) -
+         bits::CountTrailingZeros32(
+             static_cast<uint32_t>(kMinPooledSegmentSize));
+}
+
 }  // namespace base
 }  // namespace v8
@@ -7,23 +7,65 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 namespace base {
 
 class AccountingAllocator final {
  public:
+  // Segments with a power of two size in this range are kept in a pool when
+  // they are returned, so that later zones can reuse them without going
+  // through malloc and free.
+  static const size_t kMinPooledSegmentSize = 8 * 1024;
+  static const size_t kMaxPooledSegmentSize = 32 * 1024;
+  // Maximum number of segments kept per pooled size.
+  static const size_t kMaxPooledSegmentsPerSize = 16;
+
   AccountingAllocator() = default;
-  ~AccountingAllocator() = default;
+  ~AccountingAllocator();
 
   // Returns nullptr on failed allocation.
   void* Allocate(size_t bytes);
   void Free(void* memory, size_t bytes);
 
+  // Like Allocate and Free, but segments of pooled sizes are taken from and
+  // returned to the pool. Thread-safe.
+  void* AllocateSegment(size_t bytes);
+  void ReturnSegment(void* memory, size_t bytes);
+
+  // Frees all pooled segments, e.g. in response to memory pressure.
+  void ReleasePooledSegments();
+
+  // Returns the size of the segments currently allocated, excluding pooled
+  // segments.
   size_t GetCurrentMemoryUsage() const;
+  // Returns the peak of GetCurrentMemoryUsage() since the allocator was
+  // created.
+  size_t GetMaxMemoryUsage() const;
+  // Returns the size of the segments currently kept in the pool.
+  size_t GetCurrentPoolSize() const;
+
+  static bool IsPooledSegmentSize(size_t bytes);
 
  private:
+  struct PooledSegment {
+    PooledSegment* next;
+  };
+
+  static const size_t kNumberOfPools = 3;
+
+  static size_t PoolIndex(size_t bytes);
+
+  void IncreaseMemoryUsage(size_t bytes);
+
+  Mutex pool_mutex_;
+  PooledSegment* pools_[kNumberOfPools] = {};
+  size_t pool_lengths_[kNumberOfPools] = {};
+
   AtomicWord current_memory_usage_ = 0;
+  AtomicWord max_memory_usage_ = 0;
+  AtomicWord current_pool_size_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(AccountingAllocator);
 };
@@ -3490,10 +3490,9 @@ bool Genesis::InstallSpecialObjects(Handle<Context> native_context) {
       native_context->global_object()));
 
   Handle<JSObject> Error = isolate->error_function();
-  Handle<String> name =
-      factory->InternalizeOneByteString(STATIC_CHAR_VECTOR("stackTraceLimit"));
   Handle<Smi> stack_trace_limit(Smi::FromInt(FLAG_stack_trace_limit), isolate);
-  JSObject::AddProperty(Error, name, stack_trace_limit, NONE);
+  JSObject::AddProperty(Error, factory->stackTraceLimit_string(),
+                        stack_trace_limit, NONE);
 
   // Expose the debug global object in global if a name for it is specified.
   if (FLAG_expose_debug_as != NULL && strlen(FLAG_expose_debug_as) != 0) {
@@ -1403,6 +1403,11 @@ MaybeHandle<JSArray> Fast_ArrayConcat(Isolate* isolate,
     // and calculating total length.
     for (int i = 0; i < n_arguments; i++) {
       Object* arg = (*args)[i];
+      // Primitives are never spreadable and are appended as one element.
+      if (!arg->IsJSReceiver()) {
+        result_len++;
+        continue;
+      }
       if (!arg->IsJSArray()) return MaybeHandle<JSArray>();
       if (!HasOnlySimpleReceiverElements(isolate, JSObject::cast(arg))) {
         return MaybeHandle<JSArray>();
@@ -1974,9 +1979,10 @@ BUILTIN(ObjectKeys) {
     if (enum_length == 0) {
       keys = isolate->factory()->empty_fixed_array();
     } else {
-      Handle<FixedArray> cache(
-          receiver->map()->instance_descriptors()->GetEnumCache());
-      keys = isolate->factory()->CopyFixedArrayUpTo(cache, enum_length);
+      Handle<DescriptorArray> descriptors(
+          receiver->map()->instance_descriptors(), isolate);
+      keys = DescriptorArray::GetEnumCacheKeys(descriptors, isolate,
+                                               enum_length);
     }
   } else {
     ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
@@ -3390,29 +3396,28 @@ const char* kShortMonths[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
 double ParseDateTimeString(Handle<String> str) {
   Isolate* const isolate = str->GetIsolate();
   str = String::Flatten(str);
-  // TODO(bmeurer): Change DateParser to not use the FixedArray.
-  Handle<FixedArray> tmp =
-      isolate->factory()->NewFixedArray(DateParser::OUTPUT_SIZE);
+  double out[DateParser::OUTPUT_SIZE];
   DisallowHeapAllocation no_gc;
   String::FlatContent str_content = str->GetFlatContent();
   bool result;
   if (str_content.IsOneByte()) {
-    result = DateParser::Parse(isolate, str_content.ToOneByteVector(), *tmp);
+    result = DateParser::Parse(isolate, str_content.ToOneByteVector(), out);
   } else {
-    result = DateParser::Parse(isolate, str_content.ToUC16Vector(), *tmp);
+    result = DateParser::Parse(isolate, str_content.ToUC16Vector(), out);
   }
   if (!result) return std::numeric_limits<double>::quiet_NaN();
-  double const day = MakeDay(tmp->get(0)->Number(), tmp->get(1)->Number(),
-                             tmp->get(2)->Number());
-  double const time = MakeTime(tmp->get(3)->Number(), tmp->get(4)->Number(),
-                               tmp->get(5)->Number(), tmp->get(6)->Number());
+  double const day = MakeDay(out[DateParser::YEAR], out[DateParser::MONTH],
+                             out[DateParser::DAY]);
+  double const time =
+      MakeTime(out[DateParser::HOUR], out[DateParser::MINUTE],
+               out[DateParser::SECOND], out[DateParser::MILLISECOND]);
   double date = MakeDate(day, time);
-  if (tmp->get(7)->IsNull(isolate)) {
+  if (std::isnan(out[DateParser::UTC_OFFSET])) {
     if (!std::isnan(date)) {
       date = isolate->date_cache()->ToUTC(static_cast<int64_t>(date));
     }
   } else {
-    date -= tmp->get(7)->Number() * 1000.0;
+    date -= out[DateParser::UTC_OFFSET] * 1000.0;
   }
   return date;
 }
@@ -5927,6 +5932,19 @@ void Builtins::TearDown() {
 }
 
 
+void Builtins::PrintBuiltinSize() {
+  DCHECK(initialized_);
+  int total_size = 0;
+  for (int i = 0; i < builtin_count; i++) {
+    Code* code = Code::cast(builtins_[i]);
+    PrintF("Builtin %s: %d\n", names_[i], code->instruction_size());
+    total_size += code->instruction_size();
+  }
+  PrintF("Builtins total: %d instruction bytes in %d builtins\n", total_size,
+         builtin_count);
+}
+
+
 void Builtins::IterateBuiltins(ObjectVisitor* v) {
   v->VisitPointers(&builtins_[0], &builtins_[0] + builtin_count);
 }
@@ -449,6 +449,10 @@ class Builtins {
 
   bool is_initialized() const { return initialized_; }
 
+  // Prints the instruction size of every builtin and their total. This is
+  // machine code that each isolate currently holds its own copy of.
+  void PrintBuiltinSize();
+
   MUST_USE_RESULT static MaybeHandle<Object> InvokeApiFunction(
       Isolate* isolate, Handle<HeapObject> function, Handle<Object> receiver,
       int argc, Handle<Object> args[]);
@@ -12,7 +12,11 @@ namespace internal {
 
 
 Cancelable::Cancelable(CancelableTaskManager* parent)
-    : parent_(parent), status_(kWaiting), id_(0), cancel_counter_(0) {
+    : parent_(parent),
+      status_(kWaiting),
+      id_(0),
+      counted_as_running_(false),
+      cancel_counter_(0) {
   id_ = parent->Register(this);
 }
 
@@ -22,11 +26,13 @@ Cancelable::~Cancelable() {
   // manager object. This happens when the manager cancels all pending tasks
   // in {CancelAndWait} only before destroying the manager object.
   if (TryRun() || IsRunning()) {
+    if (counted_as_running_) parent_->running_tasks_.Increment(-1);
     parent_->RemoveFinishedTask(id_);
   }
 }
 
-CancelableTaskManager::CancelableTaskManager() : task_id_counter_(0) {}
+CancelableTaskManager::CancelableTaskManager()
+    : task_id_counter_(0), running_tasks_(0) {}
 
 uint32_t CancelableTaskManager::Register(Cancelable* task) {
   base::LockGuard<base::Mutex> guard(&mutex_);
@@ -93,6 +99,17 @@ CancelableTask::CancelableTask(Isolate* isolate)
     : Cancelable(isolate->cancelable_task_manager()), isolate_(isolate) {}
 
 
+void CancelableTask::Run() {
+  // Foreground tasks run on a thread that has entered the isolate. Any other
+  // thread is one of the platform's background threads.
+  bool on_background_thread =
+      base::Thread::GetThreadLocal(Isolate::isolate_key()) != isolate_;
+  if (TryRun(on_background_thread)) {
+    RunInternal();
+  }
+}
+
+
 CancelableIdleTask::CancelableIdleTask(Isolate* isolate)
     : Cancelable(isolate->cancelable_task_manager()), isolate_(isolate) {}
 
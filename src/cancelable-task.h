@@ -43,6 +43,11 @@ class CancelableTaskManager {
   // already running.
   void CancelAndWait();
 
+  // Returns the number of registered tasks that have started running on a
+  // background thread and not yet finished. Parallel jobs use this to avoid
+  // queueing more tasks than there are idle worker threads.
+  int NumberOfRunningTasks() { return running_tasks_.Value(); }
+
  private:
   // Only called by {Cancelable} destructor. The task is done with executing,
   // but needs to be removed.
@@ -54,6 +59,10 @@ class CancelableTaskManager {
   // A set of cancelable tasks that are currently registered.
   std::map<uint32_t, Cancelable*> cancelable_tasks_;
 
+  // Number of registered tasks that ran {TryRun} on a background thread and
+  // have not finished yet.
+  base::AtomicNumber<int> running_tasks_;
+
   // Mutex and condition variable enabling concurrent register and removing, as
   // well as waiting for background tasks on {CancelAndWait}.
   base::ConditionVariable cancelable_tasks_barrier_;
@@ -78,7 +87,16 @@ class Cancelable {
   uint32_t id() { return id_; }
 
  protected:
-  bool TryRun() { return status_.TrySetValue(kWaiting, kRunning); }
+  // Tasks running on a background thread are counted in
+  // {NumberOfRunningTasks} of the manager until they finish.
+  bool TryRun(bool on_background_thread = false) {
+    if (!status_.TrySetValue(kWaiting, kRunning)) return false;
+    if (on_background_thread) {
+      counted_as_running_ = true;
+      parent_->running_tasks_.Increment(1);
+    }
+    return true;
+  }
   bool IsRunning() { return status_.Value() == kRunning; }
   intptr_t CancelAttempts() { return cancel_counter_.Value(); }
 
@@ -108,6 +126,10 @@ class Cancelable {
   base::AtomicValue<Status> status_;
   uint32_t id_;
 
+  // Whether the task is included in the running task count of {parent_}. Only
+  // accessed by the thread that runs the task.
+  bool counted_as_running_;
+
   // The counter is incremented for failing tries to cancel a task. This can be
   // used by the task itself as an indication how often external entities tried
   // to abort it.
@@ -125,11 +147,7 @@ class CancelableTask : public Cancelable, public Task {
   explicit CancelableTask(Isolate* isolate);
 
   // Task overrides.
-  void Run() final {
-    if (TryRun()) {
-      RunInternal();
-    }
-  }
+  void Run() final;
 
   virtual void RunInternal() = 0;
 
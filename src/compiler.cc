@@ -663,6 +663,9 @@ bool GetOptimizedCodeNow(CompilationJob* job) {
   if (job->CreateGraph() != CompilationJob::SUCCEEDED ||
       job->OptimizeGraph() != CompilationJob::SUCCEEDED ||
       job->GenerateCode() != CompilationJob::SUCCEEDED) {
+    if (info->bailout_reason() == kZoneBudgetExceeded) {
+      isolate->counters()->turbo_zone_budget_exceeded()->Increment();
+    }
     if (FLAG_trace_opt) {
       PrintF("[aborted optimizing ");
       info->closure()->ShortPrint();
@@ -749,6 +752,9 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   if (shared->is_compiled()) {
     shared->code()->set_profiler_ticks(0);
   }
+  if (shared->HasBytecodeArray()) {
+    shared->set_profiler_ticks(0);
+  }
 
   VMState<COMPILER> state(isolate);
   DCHECK(!isolate->has_pending_exception());
@@ -1791,6 +1797,9 @@ void Compiler::FinalizeCompilationJob(CompilationJob* raw_job) {
   }
 
   DCHECK(job->last_status() != CompilationJob::SUCCEEDED);
+  if (info->bailout_reason() == kZoneBudgetExceeded) {
+    isolate->counters()->turbo_zone_budget_exceeded()->Increment();
+  }
   if (FLAG_trace_opt) {
     PrintF("[aborted optimizing ");
     info->closure()->ShortPrint();
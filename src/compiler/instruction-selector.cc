@@ -38,6 +38,7 @@ InstructionSelector::InstructionSelector(
       virtual_registers_(node_count,
                          InstructionOperand::kInvalidVirtualRegister, zone),
       scheduler_(nullptr),
+      schedule_current_block_(false),
       frame_(frame) {
   instructions_.reserve(node_count);
 }
@@ -65,7 +66,8 @@ void InstructionSelector::SelectInstructions() {
   }
 
   // Schedule the selected instructions.
-  if (FLAG_turbo_instruction_scheduling &&
+  if ((FLAG_turbo_instruction_scheduling ||
+       FLAG_turbo_loop_instruction_scheduling) &&
       InstructionScheduler::SchedulerSupported()) {
     scheduler_ = new (zone()) InstructionScheduler(zone(), sequence());
   }
@@ -88,9 +90,16 @@ void InstructionSelector::SelectInstructions() {
 }
 
 void InstructionSelector::StartBlock(RpoNumber rpo) {
-  if (FLAG_turbo_instruction_scheduling &&
-      InstructionScheduler::SchedulerSupported()) {
-    DCHECK_NOT_NULL(scheduler_);
+  schedule_current_block_ = false;
+  if (scheduler_ != nullptr) {
+    // Unless all blocks are scheduled, only schedule the blocks of loop
+    // bodies, where the scheduling pays off most.
+    InstructionBlock* const block = sequence()->InstructionBlockAt(rpo);
+    schedule_current_block_ = FLAG_turbo_instruction_scheduling ||
+                              block->IsLoopHeader() ||
+                              block->loop_header().IsValid();
+  }
+  if (schedule_current_block_) {
     scheduler_->StartBlock(rpo);
   } else {
     sequence()->StartBlock(rpo);
@@ -99,8 +108,7 @@ void InstructionSelector::StartBlock(RpoNumber rpo) {
 
 
 void InstructionSelector::EndBlock(RpoNumber rpo) {
-  if (FLAG_turbo_instruction_scheduling &&
-      InstructionScheduler::SchedulerSupported()) {
+  if (schedule_current_block_) {
     DCHECK_NOT_NULL(scheduler_);
     scheduler_->EndBlock(rpo);
   } else {
@@ -110,8 +118,7 @@ void InstructionSelector::EndBlock(RpoNumber rpo) {
 
 
 void InstructionSelector::AddInstruction(Instruction* instr) {
-  if (FLAG_turbo_instruction_scheduling &&
-      InstructionScheduler::SchedulerSupported()) {
+  if (schedule_current_block_) {
     DCHECK_NOT_NULL(scheduler_);
     scheduler_->AddInstruction(instr);
   } else {
@@ -1241,6 +1248,24 @@ void InstructionSelector::VisitNode(Node* node) {
     }
     case IrOpcode::kAtomicStore:
       return VisitAtomicStore(node);
+    case IrOpcode::kCreateFloat32x4:
+      return MarkAsSimd128(node), VisitCreateFloat32x4(node);
+    case IrOpcode::kFloat32x4ExtractLane:
+      return MarkAsFloat32(node), VisitFloat32x4ExtractLane(node);
+    case IrOpcode::kFloat32x4Add:
+      return MarkAsSimd128(node), VisitFloat32x4Add(node);
+    case IrOpcode::kFloat32x4Sub:
+      return MarkAsSimd128(node), VisitFloat32x4Sub(node);
+    case IrOpcode::kFloat32x4Mul:
+      return MarkAsSimd128(node), VisitFloat32x4Mul(node);
+    case IrOpcode::kFloat32x4Div:
+      return MarkAsSimd128(node), VisitFloat32x4Div(node);
+    case IrOpcode::kFloat32x4Min:
+      return MarkAsSimd128(node), VisitFloat32x4Min(node);
+    case IrOpcode::kFloat32x4Max:
+      return MarkAsSimd128(node), VisitFloat32x4Max(node);
+    case IrOpcode::kFloat32x4Sqrt:
+      return MarkAsSimd128(node), VisitFloat32x4Sqrt(node);
     default:
       V8_Fatal(__FILE__, __LINE__, "Unexpected operator #%d:%s @ node #%d",
                node->opcode(), node->op()->mnemonic(), node->id());
@@ -1534,6 +1559,14 @@ void InstructionSelector::VisitWord32PairShr(Node* node) { UNIMPLEMENTED(); }
 void InstructionSelector::VisitWord32PairSar(Node* node) { UNIMPLEMENTED(); }
 #endif  // V8_TARGET_ARCH_64_BIT
 
+// Only x64 implements the SIMD instructions so far.
+#if !V8_TARGET_ARCH_X64
+#define SIMD_UNIMPLEMENTED(Name) \
+  void InstructionSelector::Visit##Name(Node* node) { UNIMPLEMENTED(); }
+MACHINE_SIMD_SELECTED_OP_LIST(SIMD_UNIMPLEMENTED)
+#undef SIMD_UNIMPLEMENTED
+#endif  // !V8_TARGET_ARCH_X64
+
 void InstructionSelector::VisitFinishRegion(Node* node) { EmitIdentity(node); }
 
 void InstructionSelector::VisitParameter(Node* node) {
@@ -18,6 +18,19 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+// The subset of the SIMD machine operators that has instruction selection
+// support; currently only implemented on x64.
+#define MACHINE_SIMD_SELECTED_OP_LIST(V) \
+  V(CreateFloat32x4)                     \
+  V(Float32x4ExtractLane)                \
+  V(Float32x4Add)                        \
+  V(Float32x4Sub)                        \
+  V(Float32x4Mul)                        \
+  V(Float32x4Div)                        \
+  V(Float32x4Min)                        \
+  V(Float32x4Max)                        \
+  V(Float32x4Sqrt)
+
 // Forward declarations.
 class BasicBlock;
 struct CallBuffer;  // TODO(bmeurer): Remove this.
@@ -202,6 +215,9 @@ class InstructionSelector final {
   void MarkAsFloat64(Node* node) {
     MarkAsRepresentation(MachineRepresentation::kFloat64, node);
   }
+  void MarkAsSimd128(Node* node) {
+    MarkAsRepresentation(MachineRepresentation::kSimd128, node);
+  }
   void MarkAsReference(Node* node) {
     MarkAsRepresentation(MachineRepresentation::kTagged, node);
   }
@@ -250,6 +266,7 @@ class InstructionSelector final {
 
 #define DECLARE_GENERATOR(x) void Visit##x(Node* node);
   MACHINE_OP_LIST(DECLARE_GENERATOR)
+  MACHINE_SIMD_SELECTED_OP_LIST(DECLARE_GENERATOR)
 #undef DECLARE_GENERATOR
 
   void VisitFinishRegion(Node* node);
@@ -300,6 +317,7 @@ class InstructionSelector final {
   IntVector effect_level_;
   IntVector virtual_registers_;
   InstructionScheduler* scheduler_;
+  bool schedule_current_block_;
   Frame* frame_;
 };
 
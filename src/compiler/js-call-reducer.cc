@@ -114,40 +114,15 @@ Reduction JSCallReducer::ReduceFunctionPrototypeApply(Node* node) {
     node->RemoveInput(0);
     --arity;
   } else if (arity == 4) {
-    // Check if argArray is an arguments object, and {node} is the only value
-    // user of argArray (except for value uses in frame states).
+    // Check if argArray is an arguments object whose parameters can be
+    // forwarded to the {node} directly.
     Node* arg_array = NodeProperties::GetValueInput(node, 3);
-    if (arg_array->opcode() != IrOpcode::kJSCreateArguments) return NoChange();
-    for (Edge edge : arg_array->use_edges()) {
-      if (edge.from()->opcode() == IrOpcode::kStateValues) continue;
-      if (!NodeProperties::IsValueEdge(edge)) continue;
-      if (edge.from() == node) continue;
+    Node* frame_state;
+    int start_index;
+    if (!CanForwardArguments(node, arg_array, &frame_state, &start_index)) {
       return NoChange();
     }
-    // Get to the actual frame state from which to extract the arguments;
-    // we can only optimize this in case the {node} was already inlined into
-    // some other function (and same for the {arg_array}).
-    CreateArgumentsType type = CreateArgumentsTypeOf(arg_array->op());
-    Node* frame_state = NodeProperties::GetFrameStateInput(arg_array, 0);
-    Node* outer_state = frame_state->InputAt(kFrameStateOuterStateInput);
-    if (outer_state->opcode() != IrOpcode::kFrameState) return NoChange();
-    FrameStateInfo outer_info = OpParameter<FrameStateInfo>(outer_state);
-    if (outer_info.type() == FrameStateType::kArgumentsAdaptor) {
-      // Need to take the parameters from the arguments adaptor.
-      frame_state = outer_state;
-    }
     FrameStateInfo state_info = OpParameter<FrameStateInfo>(frame_state);
-    int start_index = 0;
-    if (type == CreateArgumentsType::kMappedArguments) {
-      // Mapped arguments (sloppy mode) cannot be handled if they are aliased.
-      Handle<SharedFunctionInfo> shared;
-      if (!state_info.shared_info().ToHandle(&shared)) return NoChange();
-      if (shared->internal_formal_parameter_count() != 0) return NoChange();
-    } else if (type == CreateArgumentsType::kRestParameter) {
-      Handle<SharedFunctionInfo> shared;
-      if (!state_info.shared_info().ToHandle(&shared)) return NoChange();
-      start_index = shared->internal_formal_parameter_count();
-    }
     // Remove the argArray input from the {node}.
     node->RemoveInput(static_cast<int>(--arity));
     // Add the actual parameters to the {node}, skipping the receiver.
@@ -177,6 +152,76 @@ Reduction JSCallReducer::ReduceFunctionPrototypeApply(Node* node) {
 }
 
 
+// ES6 section 26.1.1 Reflect.apply (target, thisArgument, argumentsList)
+Reduction JSCallReducer::ReduceReflectApply(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSCallFunction, node->opcode());
+  CallFunctionParameters const& p = CallFunctionParametersOf(node->op());
+  // We only handle Reflect.apply(target, thisArgument, arguments) here, where
+  // the arguments can be forwarded directly, so that argumentsList is known
+  // to be an object. Everything else is left to the builtin.
+  if (p.arity() != 5) return NoChange();
+  Node* arg_array = NodeProperties::GetValueInput(node, 4);
+  Node* frame_state;
+  int start_index;
+  if (!CanForwardArguments(node, arg_array, &frame_state, &start_index)) {
+    return NoChange();
+  }
+  // Drop the receiver of the Reflect.apply call to turn the {node} into the
+  // shape of a Function.prototype.apply call, i.e. (target, thisArg, argArray)
+  // with Reflect.apply in place of Function.prototype.apply.
+  node->RemoveInput(1);
+  NodeProperties::ChangeOp(
+      node, javascript()->CallFunction(4, p.feedback(),
+                                       ConvertReceiverMode::kAny,
+                                       p.tail_call_mode()));
+  Reduction const reduction = ReduceFunctionPrototypeApply(node);
+  DCHECK(reduction.Changed());
+  return reduction;
+}
+
+
+bool JSCallReducer::CanForwardArguments(Node* node, Node* arg_array,
+                                        Node** frame_state_return,
+                                        int* start_index_return) {
+  // Check if {arg_array} is an arguments object, and {node} is the only value
+  // user of {arg_array} (except for value uses in frame states).
+  if (arg_array->opcode() != IrOpcode::kJSCreateArguments) return false;
+  for (Edge edge : arg_array->use_edges()) {
+    if (edge.from()->opcode() == IrOpcode::kStateValues) continue;
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    if (edge.from() == node) continue;
+    return false;
+  }
+  // Get to the actual frame state from which to extract the arguments;
+  // we can only optimize this in case the {node} was already inlined into
+  // some other function (and same for the {arg_array}).
+  CreateArgumentsType type = CreateArgumentsTypeOf(arg_array->op());
+  Node* frame_state = NodeProperties::GetFrameStateInput(arg_array, 0);
+  Node* outer_state = frame_state->InputAt(kFrameStateOuterStateInput);
+  if (outer_state->opcode() != IrOpcode::kFrameState) return false;
+  FrameStateInfo outer_info = OpParameter<FrameStateInfo>(outer_state);
+  if (outer_info.type() == FrameStateType::kArgumentsAdaptor) {
+    // Need to take the parameters from the arguments adaptor.
+    frame_state = outer_state;
+  }
+  FrameStateInfo state_info = OpParameter<FrameStateInfo>(frame_state);
+  int start_index = 0;
+  if (type == CreateArgumentsType::kMappedArguments) {
+    // Mapped arguments (sloppy mode) cannot be handled if they are aliased.
+    Handle<SharedFunctionInfo> shared;
+    if (!state_info.shared_info().ToHandle(&shared)) return false;
+    if (shared->internal_formal_parameter_count() != 0) return false;
+  } else if (type == CreateArgumentsType::kRestParameter) {
+    Handle<SharedFunctionInfo> shared;
+    if (!state_info.shared_info().ToHandle(&shared)) return false;
+    start_index = shared->internal_formal_parameter_count();
+  }
+  *frame_state_return = frame_state;
+  *start_index_return = start_index;
+  return true;
+}
+
+
 // ES6 section 19.2.3.3 Function.prototype.call (thisArg, ...args)
 Reduction JSCallReducer::ReduceFunctionPrototypeCall(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCallFunction, node->opcode());
@@ -259,6 +304,11 @@ Reduction JSCallReducer::ReduceJSCallFunction(Node* node) {
       if (*function == function->native_context()->number_function()) {
         return ReduceNumberConstructor(node);
       }
+
+      // Check for Reflect.apply.
+      if (*function == function->native_context()->reflect_apply()) {
+        return ReduceReflectApply(node);
+      }
     } else if (m.Value()->IsJSBoundFunction()) {
       Handle<JSBoundFunction> function =
           Handle<JSBoundFunction>::cast(m.Value());
@@ -40,9 +40,16 @@ class JSCallReducer final : public Reducer {
   Reduction ReduceNumberConstructor(Node* node);
   Reduction ReduceFunctionPrototypeApply(Node* node);
   Reduction ReduceFunctionPrototypeCall(Node* node);
+  Reduction ReduceReflectApply(Node* node);
   Reduction ReduceJSCallConstruct(Node* node);
   Reduction ReduceJSCallFunction(Node* node);
 
+  // Checks whether the parameters of the arguments object {arg_array} can be
+  // passed to {node} directly, and if so returns the frame state holding the
+  // parameters and the index of the first parameter to pass.
+  bool CanForwardArguments(Node* node, Node* arg_array,
+                           Node** frame_state_return, int* start_index_return);
+
   MaybeHandle<Context> GetNativeContext(Node* node);
 
   Graph* graph() const;
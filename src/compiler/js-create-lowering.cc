@@ -951,11 +951,14 @@ Node* JSCreateLowering::AllocateFastLiteral(
                                              boilerplate_object, site_context);
         site_context->ExitScope(current_site, boilerplate_object);
       } else if (property_details.representation().IsDouble()) {
-        // Allocate a mutable HeapNumber box and store the value into it.
+        // Allocate a mutable HeapNumber box and store the value into it. Use
+        // the same {pretenure} mode as the literal itself, so that the box
+        // can be folded into the literal's inline allocation group (in old
+        // space for pretenured sites) instead of needing a separate one.
         effect = graph()->NewNode(
             common()->BeginRegion(RegionObservability::kNotObservable), effect);
         value = effect = graph()->NewNode(
-            simplified()->Allocate(NOT_TENURED),
+            simplified()->Allocate(pretenure),
             jsgraph()->Constant(HeapNumber::kSize), effect, control);
         effect = graph()->NewNode(
             simplified()->StoreField(AccessBuilder::ForMap()), value,
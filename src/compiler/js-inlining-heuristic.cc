@@ -5,13 +5,43 @@
 #include "src/compiler/js-inlining-heuristic.h"
 
 #include "src/compiler.h"
+#include "src/compiler/common-operator.h"
 #include "src/compiler/node-matchers.h"
+#include "src/compiler/simplified-operator.h"
 #include "src/objects-inl.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+#define TRACE(...)                                      \
+  do {                                                  \
+    if (FLAG_trace_turbo_inlining) PrintF(__VA_ARGS__); \
+  } while (false)
+
+int JSInliningHeuristic::CollectFunctions(Node* callee,
+                                          Handle<JSFunction>* functions,
+                                          int functions_size) {
+  DCHECK_NE(0, functions_size);
+  HeapObjectMatcher m(callee);
+  if (m.HasValue() && m.Value()->IsJSFunction()) {
+    functions[0] = Handle<JSFunction>::cast(m.Value());
+    return 1;
+  }
+  if (m.IsPhi()) {
+    int const value_input_count = m.node()->op()->ValueInputCount();
+    if (value_input_count > functions_size) return 0;
+    for (int n = 0; n < value_input_count; ++n) {
+      HeapObjectMatcher mn(callee->InputAt(n));
+      if (!mn.HasValue() || !mn.Value()->IsJSFunction()) return 0;
+      functions[n] = Handle<JSFunction>::cast(mn.Value());
+    }
+    return value_input_count;
+  }
+  return 0;
+}
+
+
 Reduction JSInliningHeuristic::Reduce(Node* node) {
   if (!IrOpcode::IsInlineeOpcode(node->opcode())) return NoChange();
 
@@ -19,14 +49,26 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   if (seen_.find(node->id()) != seen_.end()) return NoChange();
   seen_.insert(node->id());
 
+  // Check if the {node} is an appropriate candidate for inlining.
   Node* callee = node->InputAt(0);
-  HeapObjectMatcher match(callee);
-  if (!match.HasValue() || !match.Value()->IsJSFunction()) return NoChange();
-  Handle<JSFunction> function = Handle<JSFunction>::cast(match.Value());
+  Candidate candidate;
+  candidate.node = node;
+  candidate.num_functions =
+      CollectFunctions(callee, candidate.functions, kMaxCallPolymorphism);
+  if (candidate.num_functions == 0) {
+    return NoChange();
+  } else if (candidate.num_functions > 1 && !FLAG_polymorphic_inlining) {
+    TRACE("Not considering call site #%d:%s, because polymorphic inlining "
+          "is disabled\n",
+          node->id(),
+          candidate.functions[0]->shared()->DebugName()->ToCString().get());
+    return NoChange();
+  }
 
   // Functions marked with %SetForceInlineFlag are immediately inlined.
-  if (function->shared()->force_inline()) {
-    return inliner_.ReduceJSCall(node, function);
+  if (candidate.num_functions == 1 &&
+      candidate.functions[0]->shared()->force_inline()) {
+    return inliner_.ReduceJSCall(node, candidate.functions[0]);
   }
 
   // Handling of special inlining modes right away:
@@ -36,7 +78,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     case kRestrictedInlining:
       return NoChange();
     case kStressInlining:
-      return inliner_.ReduceJSCall(node, function);
+      return InlineCandidate(candidate);
     case kGeneralInlining:
       break;
   }
@@ -45,41 +87,74 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // Everything below this line is part of the inlining heuristic.
   // ---------------------------------------------------------------------------
 
-  // Built-in functions are handled by the JSBuiltinReducer.
-  if (function->shared()->HasBuiltinFunctionId()) return NoChange();
-
-  // Don't inline builtins.
-  if (function->shared()->IsBuiltin()) return NoChange();
+  // Avoid inlining within or across the boundary of asm.js code.
+  if (info_->shared_info()->asm_function()) return NoChange();
 
-  // Quick check on source code length to avoid parsing large candidate.
-  if (function->shared()->SourceSize() > FLAG_max_inlined_source_size) {
+  // The dispatch for polymorphic call sites doesn't support exception edges.
+  if (candidate.num_functions > 1 && NodeProperties::IsExceptionalCall(node)) {
+    TRACE("Not considering call site #%d:%s, because of surrounding "
+          "try-block\n",
+          node->id(),
+          candidate.functions[0]->shared()->DebugName()->ToCString().get());
     return NoChange();
   }
 
-  // Quick check on the size of the AST to avoid parsing large candidate.
-  if (function->shared()->ast_node_count() > FLAG_max_inlined_nodes) {
-    return NoChange();
-  }
+  // Every call target has to qualify for inlining by itself.
+  candidate.size = 0;
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    Handle<SharedFunctionInfo> shared(candidate.functions[i]->shared());
 
-  // Avoid inlining within or across the boundary of asm.js code.
-  if (info_->shared_info()->asm_function()) return NoChange();
-  if (function->shared()->asm_function()) return NoChange();
+    // Built-in functions are handled by the JSBuiltinReducer.
+    if (shared->HasBuiltinFunctionId()) return NoChange();
+
+    // Don't inline builtins.
+    if (shared->IsBuiltin()) return NoChange();
+
+    // Quick check on source code length to avoid parsing large candidate.
+    if (shared->SourceSize() > FLAG_max_inlined_source_size) {
+      TRACE("Not considering call site #%d:%s, because source size %d "
+            "exceeds the limit\n",
+            node->id(), shared->DebugName()->ToCString().get(),
+            shared->SourceSize());
+      return NoChange();
+    }
+
+    // Quick check on the size of the AST to avoid parsing large candidate.
+    if (shared->ast_node_count() > FLAG_max_inlined_nodes) {
+      TRACE("Not considering call site #%d:%s, because AST size %d exceeds "
+            "the limit\n",
+            node->id(), shared->DebugName()->ToCString().get(),
+            shared->ast_node_count());
+      return NoChange();
+    }
+
+    // Avoid inlining across the boundary of asm.js code.
+    if (shared->asm_function()) return NoChange();
+
+    candidate.size += std::max(1, shared->ast_node_count());
+  }
 
   // Stop inlinining once the maximum allowed level is reached.
   int level = 0;
   for (Node* frame_state = NodeProperties::GetFrameStateInput(node, 0);
        frame_state->opcode() == IrOpcode::kFrameState;
        frame_state = NodeProperties::GetFrameStateInput(frame_state, 0)) {
-    if (++level > FLAG_max_inlining_levels) return NoChange();
+    if (++level > FLAG_max_inlining_levels) {
+      Handle<SharedFunctionInfo> shared(candidate.functions[0]->shared());
+      TRACE("Not considering call site #%d:%s, because the maximum inlining "
+            "level is reached\n",
+            node->id(), shared->DebugName()->ToCString().get());
+      return NoChange();
+    }
   }
 
   // Gather feedback on how often this call site has been hit before.
-  int calls = -1;  // Same default as CallICNexus::ExtractCallCount.
+  candidate.calls = -1;  // Same default as CallICNexus::ExtractCallCount.
   if (node->opcode() == IrOpcode::kJSCallFunction) {
     CallFunctionParameters p = CallFunctionParametersOf(node->op());
     if (p.feedback().IsValid()) {
       CallICNexus nexus(p.feedback().vector(), p.feedback().slot());
-      calls = nexus.ExtractCallCount();
+      candidate.calls = nexus.ExtractCallCount();
     }
   } else {
     DCHECK_EQ(IrOpcode::kJSCallConstruct, node->opcode());
@@ -88,9 +163,9 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       int const extra_index =
           p.feedback().vector()->GetIndex(p.feedback().slot()) + 1;
       Handle<Object> feedback_extra(p.feedback().vector()->get(extra_index),
-                                    function->GetIsolate());
+                                    info_->isolate());
       if (feedback_extra->IsSmi()) {
-        calls = Handle<Smi>::cast(feedback_extra)->value();
+        candidate.calls = Handle<Smi>::cast(feedback_extra)->value();
       }
     }
   }
@@ -100,7 +175,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // ---------------------------------------------------------------------------
 
   // In the general case we remember the candidate for later.
-  candidates_.insert({function, node, calls});
+  candidates_.insert(candidate);
   return NoChange();
 }
 
@@ -111,7 +186,9 @@ void JSInliningHeuristic::Finalize() {
 
   // We inline at most one candidate in every iteration of the fixpoint.
   // This is to ensure that we don't consume the full inlining budget
-  // on things that aren't called very often.
+  // on things that aren't called very often. Candidates are tried in order
+  // of their call count per size, and candidates that don't fit into the
+  // remaining budget are skipped in favor of smaller ones.
   // TODO(bmeurer): Use std::priority_queue instead of std::set here.
   while (!candidates_.empty()) {
     if (cumulative_count_ > FLAG_max_inlined_nodes_cumulative) return;
@@ -119,21 +196,105 @@ void JSInliningHeuristic::Finalize() {
     Candidate candidate = *i;
     candidates_.erase(i);
     // Make sure we don't try to inline dead candidate nodes.
-    if (!candidate.node->IsDead()) {
-      Reduction r = inliner_.ReduceJSCall(candidate.node, candidate.function);
-      if (r.Changed()) {
-        cumulative_count_ += candidate.function->shared()->ast_node_count();
-        return;
-      }
+    if (candidate.node->IsDead()) continue;
+    if (cumulative_count_ + candidate.size >
+        FLAG_max_inlined_nodes_cumulative) {
+      TRACE("Not inlining call site #%d:%s, because its size %d exceeds the "
+            "remaining budget of %d\n",
+            candidate.node->id(),
+            candidate.functions[0]->shared()->DebugName()->ToCString().get(),
+            candidate.size,
+            FLAG_max_inlined_nodes_cumulative - cumulative_count_);
+      continue;
+    }
+    Reduction r = InlineCandidate(candidate);
+    if (r.Changed()) {
+      TRACE("Inlining call site #%d:%s (targets:%d, calls:%d, size:%d)\n",
+            candidate.node->id(),
+            candidate.functions[0]->shared()->DebugName()->ToCString().get(),
+            candidate.num_functions, candidate.calls, candidate.size);
+      cumulative_count_ += candidate.size;
+      return;
+    }
+  }
+}
+
+
+Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate) {
+  int const num_calls = candidate.num_functions;
+  Node* const node = candidate.node;
+  if (num_calls == 1) {
+    return inliner_.ReduceJSCall(node, candidate.functions[0]);
+  }
+
+  // Expand the JSCallFunction/JSCallConstruct node to a subgraph first if
+  // we have multiple known target functions. The {callee} is a phi of the
+  // known targets, so the last target doesn't need an explicit check.
+  DCHECK_LT(1, num_calls);
+  DCHECK(!NodeProperties::IsExceptionalCall(node));
+  Node* calls[kMaxCallPolymorphism + 1];
+  Node* if_successes[kMaxCallPolymorphism];
+  Node* callee = NodeProperties::GetValueInput(node, 0);
+  Node* fallthrough_control = NodeProperties::GetControlInput(node);
+
+  // Setup the inputs for the cloned call nodes.
+  int const input_count = node->InputCount();
+  Node** inputs = graph()->zone()->NewArray<Node*>(input_count);
+  for (int i = 0; i < input_count; ++i) {
+    inputs[i] = node->InputAt(i);
+  }
+
+  // Create the appropriate control flow to dispatch to the cloned calls.
+  for (int i = 0; i < num_calls; ++i) {
+    Node* target = jsgraph()->HeapConstant(candidate.functions[i]);
+    if (i != (num_calls - 1)) {
+      Node* check = graph()->NewNode(simplified()->ReferenceEqual(Type::Any()),
+                                     callee, target);
+      Node* branch =
+          graph()->NewNode(common()->Branch(), check, fallthrough_control);
+      fallthrough_control = graph()->NewNode(common()->IfFalse(), branch);
+      if_successes[i] = graph()->NewNode(common()->IfTrue(), branch);
+    } else {
+      if_successes[i] = fallthrough_control;
     }
+
+    // The first input to the call is the actual target (which we know is
+    // a constant now), and the last input is the control dependency.
+    inputs[0] = target;
+    inputs[input_count - 1] = if_successes[i];
+    calls[i] = graph()->NewNode(node->op(), input_count, inputs);
+    if_successes[i] = graph()->NewNode(common()->IfSuccess(), calls[i]);
   }
+
+  // Morph the call site into the dispatched call sites.
+  Node* control =
+      graph()->NewNode(common()->Merge(num_calls), num_calls, if_successes);
+  calls[num_calls] = control;
+  Node* effect =
+      graph()->NewNode(common()->EffectPhi(num_calls), num_calls + 1, calls);
+  Node* value =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, num_calls),
+                       num_calls + 1, calls);
+  ReplaceWithValue(node, value, effect, control);
+
+  // Inline the individual, cloned call sites.
+  for (int i = 0; i < num_calls; ++i) {
+    seen_.insert(calls[i]->id());
+    inliner_.ReduceJSCall(calls[i], candidate.functions[i]);
+  }
+
+  return Replace(value);
 }
 
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
-  if (left.calls != right.calls) {
-    return left.calls > right.calls;
+  // Compare calls per size without dividing, i.e. left.calls / left.size
+  // against right.calls / right.size.
+  int64_t const left_benefit = static_cast<int64_t>(left.calls) * right.size;
+  int64_t const right_benefit = static_cast<int64_t>(right.calls) * left.size;
+  if (left_benefit != right_benefit) {
+    return left_benefit > right_benefit;
   }
   return left.node < right.node;
 }
@@ -142,14 +303,32 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
 void JSInliningHeuristic::PrintCandidates() {
   PrintF("Candidates for inlining (size=%zu):\n", candidates_.size());
   for (const Candidate& candidate : candidates_) {
-    PrintF("  id:%d, calls:%d, size[source]:%d, size[ast]:%d / %s\n",
-           candidate.node->id(), candidate.calls,
-           candidate.function->shared()->SourceSize(),
-           candidate.function->shared()->ast_node_count(),
-           candidate.function->shared()->DebugName()->ToCString().get());
+    PrintF("  #%d:%s, calls:%d, size:%d\n", candidate.node->id(),
+           candidate.node->op()->mnemonic(), candidate.calls, candidate.size);
+    for (int i = 0; i < candidate.num_functions; ++i) {
+      Handle<SharedFunctionInfo> shared(candidate.functions[i]->shared());
+      PrintF("  - size[source]:%d, size[ast]:%d, name: %s\n",
+             shared->SourceSize(), shared->ast_node_count(),
+             shared->DebugName()->ToCString().get());
+    }
   }
 }
 
+
+Graph* JSInliningHeuristic::graph() const { return jsgraph()->graph(); }
+
+
+CommonOperatorBuilder* JSInliningHeuristic::common() const {
+  return jsgraph()->common();
+}
+
+
+SimplifiedOperatorBuilder* JSInliningHeuristic::simplified() const {
+  return jsgraph()->simplified();
+}
+
+#undef TRACE
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -21,7 +21,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
         inliner_(editor, local_zone, info, jsgraph),
         candidates_(local_zone),
         seen_(local_zone),
-        info_(info) {}
+        info_(info),
+        jsgraph_(jsgraph) {}
 
   Reduction Reduce(Node* node) final;
 
@@ -30,13 +31,19 @@ class JSInliningHeuristic final : public AdvancedReducer {
   void Finalize() final;
 
  private:
+  // This limit currently matches what Crankshaft does. We may want to
+  // re-evaluate and come up with a proper limit for TurboFan.
+  static const int kMaxCallPolymorphism = 4;
+
   struct Candidate {
-    Handle<JSFunction> function;  // The call target being inlined.
-    Node* node;                   // The call site at which to inline.
-    int calls;                    // Number of times the call site was hit.
+    Handle<JSFunction> functions[kMaxCallPolymorphism];  // The call targets.
+    int num_functions;  // Number of call targets, always at least one.
+    Node* node;         // The call site at which to inline.
+    int calls;          // Number of times the call site was hit.
+    int size;           // Total AST node count of the call targets.
   };
 
-  // Comparator for candidates.
+  // Comparator for candidates; orders by call count per size (descending).
   struct CandidateCompare {
     bool operator()(const Candidate& left, const Candidate& right) const;
   };
@@ -47,11 +54,26 @@ class JSInliningHeuristic final : public AdvancedReducer {
   // Dumps candidates to console.
   void PrintCandidates();
 
+  // Inlines the call targets of the {candidate}; for polymorphic call sites
+  // the call is first expanded into a dispatch on the target identity.
+  Reduction InlineCandidate(Candidate const& candidate);
+
+  // Collects the known JSFunction call targets of {callee}, which is either
+  // a constant or a phi of constants. Returns 0 if the targets are unknown.
+  static int CollectFunctions(Node* callee, Handle<JSFunction>* functions,
+                              int functions_size);
+
+  CommonOperatorBuilder* common() const;
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() const;
+
   Mode const mode_;
   JSInliner inliner_;
   Candidates candidates_;
   ZoneSet<NodeId> seen_;
   CompilationInfo* info_;
+  JSGraph* const jsgraph_;
   int cumulative_count_ = 0;
 };
 
@@ -446,6 +446,12 @@ Reduction JSTypedLowering::ReduceJSAdd(Node* node) {
     r.ConvertInputsToNumber(frame_state);
     return r.ChangeToPureOperator(simplified()->NumberAdd(), Type::Number());
   }
+  if (FLAG_turbo_string_concat && r.BothInputsAre(Type::String())) {
+    // Fold chains like a + b + c into a single concatenation, so that the
+    // result length is known upfront and no intermediate strings are built.
+    Reduction const reduction = ReduceStringConcat(node);
+    if (reduction.Changed()) return reduction;
+  }
   if (r.OneInputIs(Type::String())) {
     StringAddFlags flags = STRING_ADD_CHECK_NONE;
     if (!r.LeftInputIs(Type::String())) {
@@ -471,6 +477,87 @@ Reduction JSTypedLowering::ReduceJSAdd(Node* node) {
 }
 
 
+namespace {
+
+// Upper bound for the number of operands passed to %StringConcat.
+const int kMaxStringConcatOperands = 16;
+
+// Checks whether {node} only flows into {frame_state}, via state values.
+bool IsOnlyUsedByFrameState(Node* node, Node* frame_state) {
+  for (Node* const use : node->uses()) {
+    if (use == frame_state) continue;
+    if (use->opcode() != IrOpcode::kStateValues &&
+        use->opcode() != IrOpcode::kTypedStateValues) {
+      return false;
+    }
+    if (!IsOnlyUsedByFrameState(use, frame_state)) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+
+Reduction JSTypedLowering::ReduceStringConcat(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSAdd, node->opcode());
+  Node* const lhs = NodeProperties::GetValueInput(node, 0);
+  Node* const frame_state = NodeProperties::GetFrameStateInput(node, 1);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+
+  // Check if {lhs} is a string addition (already lowered to either the
+  // StringAdd stub or %StringConcat) whose operands we can take over.
+  int lhs_index, lhs_count;
+  if (lhs->opcode() == IrOpcode::kCall) {
+    Callable const callable =
+        CodeFactory::StringAdd(isolate(), STRING_ADD_CHECK_NONE, NOT_TENURED);
+    HeapObjectMatcher m(lhs->InputAt(0));
+    if (!m.HasValue() || *m.Value() != *callable.code()) return NoChange();
+    lhs_index = 1;
+    lhs_count = 2;
+  } else if (lhs->opcode() == IrOpcode::kJSCallRuntime &&
+             CallRuntimeParametersOf(lhs->op()).id() ==
+                 Runtime::kStringConcat) {
+    lhs_index = 0;
+    lhs_count = lhs->op()->ValueInputCount();
+  } else {
+    return NoChange();
+  }
+  if (lhs_count >= kMaxStringConcatOperands) return NoChange();
+
+  // The {lhs} must directly precede the {node} on the effect and control
+  // chain, and all its other uses must be from the frame state that we are
+  // going to remove from the {node} below. This way no observable operation
+  // can happen in between and we do not need to materialize {lhs} anywhere.
+  if (effect != lhs || control->opcode() != IrOpcode::kIfSuccess ||
+      NodeProperties::GetControlInput(control) != lhs ||
+      control->UseCount() != 1 || frame_state->UseCount() != 1) {
+    return NoChange();
+  }
+  for (Node* const use : lhs->uses()) {
+    if (use == node || use == control) continue;
+    if (!IsOnlyUsedByFrameState(use, frame_state)) return NoChange();
+  }
+
+  // JSAdd(StringConcat(x1:string, ..., xn:string), y:string)
+  //   => StringConcat(x1, ..., xn, y)
+  node->RemoveInput(NodeProperties::FirstFrameStateIndex(node) + 1);
+  node->ReplaceInput(0, lhs->InputAt(lhs_index));
+  for (int i = 1; i < lhs_count; ++i) {
+    node->InsertInput(graph()->zone(), i, lhs->InputAt(lhs_index + i));
+  }
+  NodeProperties::ReplaceEffectInput(node, NodeProperties::GetEffectInput(lhs));
+  NodeProperties::ReplaceControlInput(node,
+                                      NodeProperties::GetControlInput(lhs));
+  NodeProperties::ChangeOp(
+      node, javascript()->CallRuntime(Runtime::kStringConcat, lhs_count + 1));
+  control->Kill();
+  lhs->ReplaceUses(jsgraph()->Dead());
+  lhs->Kill();
+  return Changed(node);
+}
+
+
 Reduction JSTypedLowering::ReduceJSModulus(Node* node) {
   if (flags() & kDisableBinaryOpReduction) return NoChange();
   JSBinopReduction r(this, node);
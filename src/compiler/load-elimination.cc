@@ -25,46 +25,58 @@ Reduction LoadElimination::Reduce(Node* node) {
   return NoChange();
 }
 
+namespace {
+
+// Maximum number of nested EffectPhis that are looked through when searching
+// for an available value, which bounds the cost of the search.
+const int kMaxEffectPhiDepth = 4;
+
+}  // namespace
+
+
 Reduction LoadElimination::ReduceLoadField(Node* node) {
   DCHECK_EQ(IrOpcode::kLoadField, node->opcode());
   FieldAccess const access = FieldAccessOf(node->op());
   Node* object = NodeProperties::GetValueInput(node, 0);
-  for (Node* effect = NodeProperties::GetEffectInput(node);;
-       effect = NodeProperties::GetEffectInput(effect)) {
+  Node* value = FindAvailableValue(NodeProperties::GetEffectInput(node), object,
+                                   access, 0);
+  if (value == nullptr) return NoChange();
+  Type* value_type = NodeProperties::GetType(value);
+  Type* load_type = NodeProperties::GetType(node);
+  // Make sure the replacement's type is a subtype of the node's
+  // type. Otherwise we could confuse optimizations that were
+  // based on the original type.
+  if (!value_type->Is(load_type)) {
+    value = graph()->NewNode(
+        simplified()->TypeGuard(
+            Type::Intersect(value_type, load_type, graph()->zone())),
+        value, NodeProperties::GetControlInput(node));
+  }
+  ReplaceWithValue(node, value);
+  return Replace(value);
+}
+
+
+Node* LoadElimination::FindAvailableValue(Node* effect, Node* object,
+                                          FieldAccess const& access,
+                                          int depth) {
+  for (;; effect = NodeProperties::GetEffectInput(effect)) {
     switch (effect->opcode()) {
       case IrOpcode::kLoadField: {
         FieldAccess const effect_access = FieldAccessOf(effect->op());
         if (object == NodeProperties::GetValueInput(effect, 0) &&
             access == effect_access && effect_access.type->Is(access.type)) {
-          Node* const value = effect;
-          ReplaceWithValue(node, value);
-          return Replace(value);
+          return effect;
         }
         break;
       }
       case IrOpcode::kStoreField: {
         if (access == FieldAccessOf(effect->op())) {
           if (object == NodeProperties::GetValueInput(effect, 0)) {
-            Node* const value = NodeProperties::GetValueInput(effect, 1);
-            Type* stored_value_type = NodeProperties::GetType(value);
-            Type* load_type = NodeProperties::GetType(node);
-            // Make sure the replacement's type is a subtype of the node's
-            // type. Otherwise we could confuse optimizations that were
-            // based on the original type.
-            if (stored_value_type->Is(load_type)) {
-              ReplaceWithValue(node, value);
-              return Replace(value);
-            } else {
-              Node* renamed = graph()->NewNode(
-                  simplified()->TypeGuard(Type::Intersect(
-                      stored_value_type, load_type, graph()->zone())),
-                  value, NodeProperties::GetControlInput(node));
-              ReplaceWithValue(node, renamed);
-              return Replace(renamed);
-            }
+            return NodeProperties::GetValueInput(effect, 1);
           }
           // TODO(turbofan): Alias analysis to the rescue?
-          return NoChange();
+          return nullptr;
         }
         break;
       }
@@ -83,20 +95,40 @@ Reduction LoadElimination::ReduceLoadField(Node* node) {
       case IrOpcode::kAllocate: {
         // Allocations don't interfere with field loads. In case we see the
         // actual allocation for the {object} we can abort.
-        if (object == effect) return NoChange();
+        if (object == effect) return nullptr;
         break;
       }
+      case IrOpcode::kEffectPhi: {
+        // Look through EffectPhis at (non-loop) merges if the same value is
+        // available on every incoming effect path. The value is then
+        // computed before the control flow split, and thus dominates the
+        // merge.
+        Node* const control = NodeProperties::GetControlInput(effect);
+        if (control->opcode() != IrOpcode::kMerge) return nullptr;
+        if (depth >= kMaxEffectPhiDepth) return nullptr;
+        Node* value = nullptr;
+        int const input_count = effect->op()->EffectInputCount();
+        for (int i = 0; i < input_count; ++i) {
+          Node* const input_value =
+              FindAvailableValue(NodeProperties::GetEffectInput(effect, i),
+                                 object, access, depth + 1);
+          if (input_value == nullptr) return nullptr;
+          if (value != nullptr && value != input_value) return nullptr;
+          value = input_value;
+        }
+        return value;
+      }
       default: {
         if (!effect->op()->HasProperty(Operator::kNoWrite) ||
             effect->op()->EffectInputCount() != 1) {
-          return NoChange();
+          return nullptr;
         }
         break;
       }
     }
   }
   UNREACHABLE();
-  return NoChange();
+  return nullptr;
 }
 
 }  // namespace compiler
@@ -11,6 +11,7 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+struct FieldAccess;
 class Graph;
 class SimplifiedOperatorBuilder;
 
@@ -29,6 +30,12 @@ class LoadElimination final : public AdvancedReducer {
 
   Reduction ReduceLoadField(Node* node);
 
+  // Walks the effect chain starting at {effect} to find a value for the
+  // field {access} of {object} that is available at that point. Returns
+  // nullptr if there's no such value or it could have been overwritten.
+  Node* FindAvailableValue(Node* effect, Node* object,
+                           FieldAccess const& access, int depth);
+
   Graph* const graph_;
   SimplifiedOperatorBuilder* const simplified_;
 };
@@ -0,0 +1,238 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Nodes that may remain on the effect chain in front of hoisted nodes. Stack
+// checks are not among them: handling an interrupt can run arbitrary
+// JavaScript, which may change any of the fields we load. See
+// {ReloadAfterStackCheck} for how a loop with a stack check is handled.
+bool IsTransparentEffect(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kCheckpoint:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Returns the single effect use of {node}, or nullptr if there's none or
+// more than one.
+Node* GetSingleEffectUse(Node* node) {
+  Node* result = nullptr;
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsEffectEdge(edge)) continue;
+    if (result != nullptr) return nullptr;
+    result = edge.from();
+  }
+  return result;
+}
+
+}  // namespace
+
+
+int LoopInvariantCodeMotion::Run() {
+  int hoisted = 0;
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    hoisted += VisitLoop(loop);
+  }
+  return hoisted;
+}
+
+
+int LoopInvariantCodeMotion::VisitLoop(LoopTree::Loop* loop) {
+  int hoisted = 0;
+  for (LoopTree::Loop* child : loop->children()) {
+    hoisted += VisitLoop(child);
+  }
+  return hoisted + HoistInvariantLoads(loop);
+}
+
+
+bool LoopInvariantCodeMotion::IsReadOnlyLoop(LoopTree::Loop* loop,
+                                             Node** stack_check) {
+  *stack_check = nullptr;
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    const Operator* op = node->op();
+    if (op->EffectOutputCount() == 0) continue;
+    if (op->HasProperty(Operator::kNoWrite)) continue;
+    if (IsTransparentEffect(node)) continue;
+    if (node->opcode() == IrOpcode::kJSStackCheck && *stack_check == nullptr) {
+      *stack_check = node;
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+
+bool LoopInvariantCodeMotion::IsOnAllBackEdges(Node* effect_phi,
+                                               Node* stack_check) {
+  // Every effect path from the back edge to the top of the loop body has to
+  // pass through {stack_check}.
+  ZoneSet<Node*> visited(zone_);
+  ZoneStack<Node*> stack(zone_);
+  stack.push(NodeProperties::GetEffectInput(effect_phi, 1));
+  while (!stack.empty()) {
+    Node* node = stack.top();
+    stack.pop();
+    if (node == stack_check) continue;
+    if (node == effect_phi) return false;
+    if (!visited.insert(node).second) continue;
+    for (int i = 0; i < node->op()->EffectInputCount(); ++i) {
+      stack.push(NodeProperties::GetEffectInput(node, i));
+    }
+  }
+  return true;
+}
+
+
+bool LoopInvariantCodeMotion::CanHoist(LoopTree::Loop* loop, Node* node) {
+  if (node->opcode() != IrOpcode::kLoadField) return false;
+  // An untagged field may hold a raw pointer into a movable object, which
+  // must not be kept alive across a GC triggered inside the loop.
+  if (FieldAccessOf(node->op()).machine_type.representation() !=
+      MachineRepresentation::kTagged) {
+    return false;
+  }
+  for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+    if (loop_tree_->Contains(loop, node->InputAt(i))) return false;
+  }
+  return true;
+}
+
+
+int LoopInvariantCodeMotion::HoistInvariantLoads(LoopTree::Loop* loop) {
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node == nullptr) return 0;
+
+  Node* effect_phi = nullptr;
+  for (Node* use : loop_node->uses()) {
+    if (use->opcode() != IrOpcode::kEffectPhi) continue;
+    if (effect_phi != nullptr) return 0;
+    effect_phi = use;
+  }
+  if (effect_phi == nullptr) return 0;
+  Node* stack_check;
+  if (!IsReadOnlyLoop(loop, &stack_check)) return 0;
+  Node* if_success = nullptr;
+  if (stack_check != nullptr) {
+    if (loop_node->InputCount() != 2) return 0;
+    if (!IsOnAllBackEdges(effect_phi, stack_check)) return 0;
+    for (Node* use : stack_check->uses()) {
+      if (use->opcode() == IrOpcode::kIfSuccess) if_success = use;
+    }
+    if (if_success == nullptr) return 0;
+  }
+
+  // Walk the effect chain from the loop header as long as it's straight-line
+  // and only consists of transparent and hoistable nodes. Hoistable nodes
+  // have to be controlled by the loop header itself, or by a transparent node
+  // that is (transitively) controlled by the loop header.
+  ZoneVector<Node*> hoisted_nodes(zone_);
+  Node* effect = effect_phi;
+  Node* control = loop_node;
+  while (Node* node = GetSingleEffectUse(effect)) {
+    if (node->op()->ControlInputCount() != 1) break;
+    Node* node_control = NodeProperties::GetControlInput(node);
+    if (node_control != loop_node && node_control != control) break;
+    if (IsTransparentEffect(node)) {
+      if (node->op()->ControlOutputCount() > 0) control = node;
+      effect = node;
+      continue;
+    }
+    if (!CanHoist(loop, node)) break;
+
+    // Unlink {node} from the loop body effect chain...
+    for (Edge edge : node->use_edges()) {
+      if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect);
+    }
+    // ...and append it to the effect chain entering the loop.
+    NodeProperties::ReplaceEffectInput(node, effect_phi->InputAt(0));
+    NodeProperties::ReplaceControlInput(node, loop_node->InputAt(0));
+    effect_phi->ReplaceInput(0, node);
+    hoisted_nodes.push_back(node);
+  }
+  if (stack_check != nullptr && !hoisted_nodes.empty()) {
+    ReloadAfterStackCheck(loop_node, stack_check, if_success, hoisted_nodes);
+  }
+  return static_cast<int>(hoisted_nodes.size());
+}
+
+
+void LoopInvariantCodeMotion::ReloadAfterStackCheck(
+    Node* loop_node, Node* stack_check, Node* if_success,
+    ZoneVector<Node*> const& hoisted_nodes) {
+  Graph* graph = jsgraph_->graph();
+  CommonOperatorBuilder* common = jsgraph_->common();
+  MachineOperatorBuilder* machine = jsgraph_->machine();
+
+  // Split off the slow path of {stack_check} the same way JSGenericLowering
+  // does, so that the reloads only happen when an interrupt was handled.
+  Node* effect = NodeProperties::GetEffectInput(stack_check);
+  Node* control = NodeProperties::GetControlInput(stack_check);
+  Node* limit = graph->NewNode(
+      machine->Load(MachineType::Pointer()),
+      jsgraph_->ExternalConstant(
+          ExternalReference::address_of_stack_limit(jsgraph_->isolate())),
+      jsgraph_->IntPtrConstant(0), effect, control);
+  Node* pointer = graph->NewNode(machine->LoadStackPointer());
+  Node* check = graph->NewNode(machine->UintLessThan(), limit, pointer);
+  Node* branch =
+      graph->NewNode(common->Branch(BranchHint::kTrue), check, control);
+  Node* if_true = graph->NewNode(common->IfTrue(), branch);
+  Node* if_false = graph->NewNode(common->IfFalse(), branch);
+  NodeProperties::ReplaceControlInput(stack_check, if_false);
+
+  Node* merge = graph->NewNode(common->Merge(2), if_true, if_false);
+  if_success->ReplaceUses(merge);
+  merge->ReplaceInput(1, if_success);
+  Node* ephi =
+      graph->NewNode(common->EffectPhi(2), effect, stack_check, merge);
+  for (Edge edge : stack_check->use_edges()) {
+    Node* const user = edge.from();
+    if (!NodeProperties::IsEffectEdge(edge)) continue;
+    if (user == ephi || user->opcode() == IrOpcode::kIfException) continue;
+    edge.UpdateTo(ephi);
+  }
+
+  // Each hoisted value now enters the loop through a phi, whose back edge
+  // value is reloaded on the slow path of the stack check.
+  Node* slow_effect = stack_check;
+  for (Node* node : hoisted_nodes) {
+    Node* object = NodeProperties::GetValueInput(node, 0);
+    Node* reload =
+        graph->NewNode(node->op(), object, slow_effect, if_success);
+    slow_effect = reload;
+    Node* phi = graph->NewNode(common->Phi(MachineRepresentation::kTagged, 2),
+                               node, node, loop_node);
+    for (Edge edge : node->use_edges()) {
+      if (!NodeProperties::IsValueEdge(edge) || edge.from() == phi) continue;
+      edge.UpdateTo(phi);
+    }
+    Node* value = graph->NewNode(
+        common->Phi(MachineRepresentation::kTagged, 2), phi, reload, merge);
+    phi->ReplaceInput(1, value);
+  }
+  ephi->ReplaceInput(1, slow_effect);
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,70 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class JSGraph;
+
+// Hoists loop-invariant loads out of loops that don't write to memory.
+//
+// Pure nodes are already hoisted out of loops by the scheduler, so this
+// pass only deals with effectful nodes that sit on the effect chain at the
+// top of a loop body. A node is moved to the loop pre-header if its value
+// inputs are defined outside of the loop, nothing in the loop (including
+// nested loops) may write to memory, and every node preceding it on the
+// effect chain of the loop header is either hoisted itself or a checkpoint.
+//
+// The only write tolerated is a single stack check on every path to the back
+// edge, as emitted for each JavaScript loop: an interrupt may run arbitrary
+// JavaScript there. The hoisted values therefore enter the loop through a
+// phi, and are loaded again on the slow path of the stack check.
+class LoopInvariantCodeMotion final {
+ public:
+  LoopInvariantCodeMotion(JSGraph* jsgraph, LoopTree* loop_tree, Zone* zone)
+      : jsgraph_(jsgraph), loop_tree_(loop_tree), zone_(zone) {}
+
+  // Processes all loops in the loop tree; returns the number of hoisted nodes.
+  int Run();
+
+ private:
+  int VisitLoop(LoopTree::Loop* loop);
+  int HoistInvariantLoads(LoopTree::Loop* loop);
+
+  // Returns true if nothing inside {loop} can write to memory, except for at
+  // most one stack check, which is returned in {stack_check}.
+  bool IsReadOnlyLoop(LoopTree::Loop* loop, Node** stack_check);
+
+  // Returns true if {stack_check} lies on every effect path from the back
+  // edge of the loop to {effect_phi}.
+  bool IsOnAllBackEdges(Node* effect_phi, Node* stack_check);
+
+  // Returns true if {node} is an effectful operation that may be moved in
+  // front of {loop}, provided its position on the effect chain allows it.
+  bool CanHoist(LoopTree::Loop* loop, Node* node);
+
+  // Rewires the values of {hoisted_nodes} through loop phis that are updated
+  // by reloads on the slow path of {stack_check}.
+  void ReloadAfterStackCheck(Node* loop_node, Node* stack_check,
+                             Node* if_success,
+                             ZoneVector<Node*> const& hoisted_nodes);
+
+  JSGraph* const jsgraph_;
+  LoopTree* const loop_tree_;
+  Zone* const zone_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
@@ -0,0 +1,230 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+
+#include <algorithm>
+
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/ostreams.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Matches {node} = {phi} + 1.
+bool IsIncrementOf(Node* node, Node* phi) {
+  if (node->opcode() != IrOpcode::kNumberAdd) return false;
+  for (int i = 0; i < 2; ++i) {
+    NumberMatcher m(node->InputAt(1 - i));
+    if (node->InputAt(i) == phi && m.Is(1.0)) return true;
+  }
+  return false;
+}
+
+
+// Returns true if {node} computes the same result when applied lane-wise to
+// vectors of {rep} elements.
+bool IsVectorizableArithmetic(Node* node, MachineRepresentation rep) {
+  switch (node->opcode()) {
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kNumberSubtract:
+      return true;
+    case IrOpcode::kNumberMultiply:
+    case IrOpcode::kNumberDivide:
+      // Integer lanes would wrap around where the scalar code produces a
+      // double that is truncated only when stored.
+      return rep == MachineRepresentation::kFloat32 ||
+             rep == MachineRepresentation::kFloat64;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+
+void LoopVectorizationAnalysis::Run() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) VisitLoop(loop);
+}
+
+
+void LoopVectorizationAnalysis::VisitLoop(LoopTree::Loop* loop) {
+  for (LoopTree::Loop* child : loop->children()) VisitLoop(child);
+  VectorizableLoop result;
+  if (Analyze(loop, &result)) {
+    if (FLAG_trace_turbo_vectorization) {
+      OFStream os(stdout);
+      os << "Loop headed at #" << loop_tree_->HeaderNode(loop)->id()
+         << " is vectorizable: " << result.lanes << " lanes of "
+         << result.element_representation
+         << (result.needs_alias_check ? ", needs alias check" : "")
+         << std::endl;
+    }
+    candidates_.push_back(result);
+  }
+}
+
+
+bool LoopVectorizationAnalysis::Analyze(LoopTree::Loop* loop,
+                                        VectorizableLoop* result) {
+  // Only innermost loops with a single back edge are considered.
+  if (!loop->children().empty()) return false;
+  Node* const loop_node = loop_tree_->HeaderNode(loop);
+  if (loop_node->InputCount() != 2) return false;
+
+  // The loop header must only carry the counter and the effect.
+  Node* induction = nullptr;
+  Node* effect_phi = nullptr;
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    if (node == loop_node) continue;
+    if (node->opcode() == IrOpcode::kEffectPhi) {
+      if (effect_phi != nullptr) return false;
+      effect_phi = node;
+    } else if (node->opcode() == IrOpcode::kPhi) {
+      if (induction != nullptr) return false;
+      induction = node;
+    } else {
+      return false;
+    }
+  }
+  if (induction == nullptr || effect_phi == nullptr) return false;
+  Node* const increment = induction->InputAt(1);
+  if (!IsIncrementOf(increment, induction)) return false;
+
+  // The body must be a single block, which is left only through the false
+  // branch of the {induction} < {bound} test.
+  Node* compare = nullptr;
+  for (Node* control = loop_node->InputAt(1); control != loop_node;
+       control = NodeProperties::GetControlInput(control)) {
+    if (control->op()->ControlInputCount() != 1) return false;
+    switch (control->opcode()) {
+      case IrOpcode::kIfTrue: {
+        if (compare != nullptr) return false;
+        Node* const branch = NodeProperties::GetControlInput(control);
+        compare = branch->InputAt(0);
+        if (compare->opcode() != IrOpcode::kNumberLessThan ||
+            compare->InputAt(0) != induction ||
+            loop_tree_->Contains(loop, compare->InputAt(1))) {
+          return false;
+        }
+        break;
+      }
+      case IrOpcode::kBranch:
+      case IrOpcode::kJSStackCheck:
+        break;
+      default:
+        return false;
+    }
+  }
+  if (compare == nullptr) return false;
+
+  // The effect chain must be straight-line and only consist of accesses to
+  // external typed array backing stores with {induction} as the index.
+  ZoneVector<Node*> chain(zone_);
+  MachineRepresentation rep = MachineRepresentation::kNone;
+  Node* store_base = nullptr;
+  bool needs_alias_check = false;
+  ZoneVector<Node*> load_bases(zone_);
+  for (Node* effect = effect_phi;;) {
+    Node* next = nullptr;
+    for (Edge edge : effect->use_edges()) {
+      if (!NodeProperties::IsEffectEdge(edge)) continue;
+      if (edge.from()->opcode() == IrOpcode::kTerminate) continue;
+      if (next != nullptr) return false;
+      next = edge.from();
+    }
+    if (next == nullptr) return false;
+    if (next == effect_phi) break;
+    switch (next->opcode()) {
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kJSStackCheck:
+        break;
+      case IrOpcode::kLoadElement:
+      case IrOpcode::kStoreElement: {
+        ElementAccess const& access = ElementAccessOf(next->op());
+        MachineRepresentation const access_rep =
+            access.machine_type.representation();
+        if (access.base_is_tagged != kUntaggedBase) return false;
+        if (rep != MachineRepresentation::kNone && rep != access_rep) {
+          return false;
+        }
+        switch (access_rep) {
+          case MachineRepresentation::kWord32:
+          case MachineRepresentation::kFloat32:
+          case MachineRepresentation::kFloat64:
+            break;
+          default:
+            return false;
+        }
+        rep = access_rep;
+        Node* const base = next->InputAt(0);
+        if (next->InputAt(1) != induction ||
+            loop_tree_->Contains(loop, base)) {
+          return false;
+        }
+        if (next->opcode() == IrOpcode::kStoreElement) {
+          if (store_base != nullptr && store_base != base) {
+            needs_alias_check = true;
+          }
+          store_base = base;
+        } else {
+          load_bases.push_back(base);
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+    chain.push_back(next);
+    effect = next;
+  }
+  if (store_base == nullptr) return false;
+  for (Node* base : load_bases) {
+    if (base != store_base) needs_alias_check = true;
+  }
+
+  // Everything else in the loop must be lane-wise arithmetic, or belong to
+  // the loop control and the deoptimization state.
+  for (Node* node : loop_tree_->BodyNodes(loop)) {
+    if (node == increment || node == compare) continue;
+    switch (node->opcode()) {
+      case IrOpcode::kBranch:
+      case IrOpcode::kIfTrue:
+      case IrOpcode::kTerminate:
+      case IrOpcode::kFrameState:
+      case IrOpcode::kStateValues:
+      case IrOpcode::kTypedStateValues:
+        continue;
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kJSStackCheck:
+      case IrOpcode::kLoadElement:
+      case IrOpcode::kStoreElement:
+        if (std::find(chain.begin(), chain.end(), node) == chain.end()) {
+          return false;
+        }
+        continue;
+      default:
+        if (!IsVectorizableArithmetic(node, rep)) return false;
+        continue;
+    }
+  }
+
+  result->loop = loop;
+  result->induction = induction;
+  result->bound = compare->InputAt(1);
+  result->element_representation = rep;
+  result->lanes = kSimd128Size / (1 << ElementSizeLog2Of(rep));
+  result->needs_alias_check = needs_alias_check;
+  return true;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,69 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+#define V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/machine-type.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Describes a counted loop that performs a straight elementwise map over
+// typed arrays, i.e. loops of the shape
+//
+//   for (i = init; i < bound; i++) c[i] = f(a[i], b[i], ...);
+//
+// where f only consists of arithmetic on the loaded elements and values
+// computed outside the loop.
+struct VectorizableLoop {
+  LoopTree::Loop* loop;
+  Node* induction;  // The loop counter phi.
+  Node* bound;      // The (loop invariant) upper bound of the counter.
+  MachineRepresentation element_representation;
+  int lanes;  // Number of elements per 128-bit vector.
+  // Whether the loop reads from a different base than it writes to; in that
+  // case the vector body must be guarded by a check that the accessed ranges
+  // don't overlap.
+  bool needs_alias_check;
+};
+
+
+// Finds loops that are candidates for vectorization. Runs on the graph after
+// typed lowering, where typed array accesses are expressed as LoadElement and
+// StoreElement on external (untagged) backing stores.
+//
+// This is a diagnostic only: it never changes the graph, and the pipeline
+// runs it just for --trace-turbo-vectorization.
+class LoopVectorizationAnalysis final {
+ public:
+  LoopVectorizationAnalysis(LoopTree* loop_tree, Zone* zone)
+      : loop_tree_(loop_tree), zone_(zone), candidates_(zone) {}
+
+  // Analyzes all innermost loops in the loop tree.
+  void Run();
+
+  const ZoneVector<VectorizableLoop>& candidates() const {
+    return candidates_;
+  }
+
+  // Returns true and fills in {result} if {loop} is vectorizable.
+  bool Analyze(LoopTree::Loop* loop, VectorizableLoop* result);
+
+ private:
+  void VisitLoop(LoopTree::Loop* loop);
+
+  LoopTree* const loop_tree_;
+  Zone* const zone_;
+  ZoneVector<VectorizableLoop> candidates_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
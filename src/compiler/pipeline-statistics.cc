@@ -5,6 +5,7 @@
 #include "src/compiler.h"
 #include "src/compiler/pipeline-statistics.h"
 #include "src/compiler/zone-pool.h"
+#include "src/tracing/trace-event.h"
 
 namespace v8 {
 namespace internal {
@@ -96,6 +97,10 @@ void PipelineStatistics::EndPhase() {
   CompilationStatistics::BasicStats diff;
   phase_stats_.End(this, &diff);
   compilation_stats_->RecordPhaseStats(phase_kind_name_, phase_name_, diff);
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.zone_stats"),
+                       "V8.TFPhaseZoneUsage", TRACE_EVENT_SCOPE_THREAD, "phase",
+                       phase_name_, "max_allocated_bytes",
+                       static_cast<uint64_t>(diff.max_allocated_bytes_));
 }
 
 }  // namespace compiler
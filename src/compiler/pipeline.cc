@@ -43,7 +43,9 @@
 #include "src/compiler/live-range-separator.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
+#include "src/compiler/loop-vectorization-analysis.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
 #include "src/compiler/move-optimizer.h"
@@ -560,14 +562,17 @@ class PipelineCompilationJob final : public CompilationJob {
       // Note that the CompilationInfo is not initialized at the time we pass it
       // to the CompilationJob constructor, but it is not dereferenced there.
       : CompilationJob(&info_, "TurboFan"),
+        zone_budget_(static_cast<size_t>(FLAG_turbo_zone_budget) * MB),
         zone_(isolate->allocator()),
-        zone_pool_(isolate->allocator()),
+        zone_pool_(isolate->allocator(), &zone_budget_),
         parse_info_(&zone_, function),
         info_(&parse_info_, function),
         pipeline_statistics_(CreatePipelineStatistics(info(), &zone_pool_)),
         data_(&zone_pool_, info(), pipeline_statistics_.get()),
         pipeline_(&data_),
-        linkage_(nullptr) {}
+        linkage_(nullptr) {
+    zone_.set_budget(&zone_budget_);
+  }
 
  protected:
   Status CreateGraphImpl() final;
@@ -575,6 +580,7 @@ class PipelineCompilationJob final : public CompilationJob {
   Status GenerateCodeImpl() final;
 
  private:
+  ZoneBudget zone_budget_;
   Zone zone_;
   ZonePool zone_pool_;
   ParseInfo parse_info_;
@@ -613,12 +619,14 @@ PipelineCompilationJob::Status PipelineCompilationJob::CreateGraphImpl() {
     if (isolate()->has_pending_exception()) return FAILED;  // Stack overflowed.
     return AbortOptimization(kGraphBuildingFailed);
   }
+  if (zone_budget_.exceeded()) return AbortOptimization(kZoneBudgetExceeded);
 
   return SUCCEEDED;
 }
 
 PipelineCompilationJob::Status PipelineCompilationJob::OptimizeGraphImpl() {
   if (!pipeline_.OptimizeGraph(linkage_)) return FAILED;
+  if (zone_budget_.exceeded()) return AbortOptimization(kZoneBudgetExceeded);
   return SUCCEEDED;
 }
 
@@ -966,6 +974,17 @@ struct RepresentationSelectionPhase {
   }
 };
 
+struct LoopInvariantCodeMotionPhase {
+  static const char* phase_name() { return "loop invariant code motion"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(data->graph(), temp_zone);
+    if (loop_tree == nullptr) return;
+    LoopInvariantCodeMotion licm(data->jsgraph(), loop_tree, temp_zone);
+    licm.Run();
+  }
+};
+
 struct EarlyOptimizationPhase {
   static const char* phase_name() { return "early optimization"; }
 
@@ -1118,6 +1137,18 @@ struct StressLoopPeelingPhase {
 };
 
 
+struct LoopVectorizationAnalysisPhase {
+  static const char* phase_name() { return "loop vectorization analysis"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(data->graph(), temp_zone);
+    if (loop_tree == nullptr) return;
+    LoopVectorizationAnalysis analysis(loop_tree, temp_zone);
+    analysis.Run();
+  }
+};
+
+
 struct ComputeSchedulePhase {
   static const char* phase_name() { return "scheduling"; }
 
@@ -1440,6 +1471,10 @@ bool PipelineImpl::CreateGraph() {
       RunPrintAndVerify("Loop peeled");
     }
 
+    if (FLAG_trace_turbo_vectorization) {
+      Run<LoopVectorizationAnalysisPhase>();
+    }
+
     if (FLAG_turbo_escape) {
       Run<EscapeAnalysisPhase>();
       RunPrintAndVerify("Escape Analysed");
@@ -1467,6 +1502,11 @@ bool PipelineImpl::CreateGraph() {
   RunPrintAndVerify("Untyped", true);
 #endif
 
+  if (FLAG_turbo_loop_invariant_code_motion) {
+    Run<LoopInvariantCodeMotionPhase>();
+    RunPrintAndVerify("Loop invariant code moved", true);
+  }
+
   // Run early optimization pass.
   Run<EarlyOptimizationPhase>();
   RunPrintAndVerify("Early optimized", true);
@@ -1764,6 +1804,20 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data_->sequence()->ValidateDeferredBlockExitPaths();
 #endif
 
+  // Very large instruction sequences, typically from generated asm.js or
+  // wasm code, skip live range splintering and gap move optimization. The
+  // linear-scan allocator runs as usual; only the passes around it are
+  // dropped, which makes the code slightly worse but the whole phase cheaper.
+  bool const fast_mode =
+      FLAG_turbo_fast_regalloc_threshold > 0 &&
+      data->sequence()->instructions().size() >
+          static_cast<size_t>(FLAG_turbo_fast_regalloc_threshold);
+  if (fast_mode && FLAG_trace_turbo_graph) {
+    OFStream os(stdout);
+    os << "----- Skipping splintering and move optimization for "
+       << data->sequence()->instructions().size() << " instructions -----\n";
+  }
+
   data->InitializeRegisterAllocationData(config, descriptor);
   if (info()->is_osr()) {
     OsrHelper osr_helper(info());
@@ -1785,14 +1839,15 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
               ->RangesDefinedInDeferredStayInDeferred());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  bool const preprocess_ranges = FLAG_turbo_preprocess_ranges && !fast_mode;
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
   }
 
   Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
   Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -1802,7 +1857,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<PopulateReferenceMapsPhase>();
   Run<ConnectRangesPhase>();
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !fast_mode) {
     Run<OptimizeMovesPhase>();
   }
 
@@ -43,6 +43,7 @@ Schedule* Scheduler::ComputeSchedule(Zone* zone, Graph* graph, Flags flags) {
 
   scheduler.BuildCFG();
   scheduler.ComputeSpecialRPONumbering();
+  scheduler.MarkColdBlocks();
   scheduler.GenerateImmediateDominatorTree();
 
   scheduler.PrepareUses();
@@ -1106,6 +1107,89 @@ void Scheduler::ComputeSpecialRPONumbering() {
 }
 
 
+namespace {
+
+// Deferred blocks with several predecessors (or successors) need all of them
+// to be deferred as well, see InstructionSequence::ValidateDeferredBlock*.
+bool HasConsistentDeferredEdges(BasicBlock* block) {
+  if (block->PredecessorCount() > 1) {
+    for (BasicBlock* const pred : block->predecessors()) {
+      if (!pred->deferred()) return false;
+    }
+  }
+  if (block->SuccessorCount() > 1) {
+    for (BasicBlock* const succ : block->successors()) {
+      if (!succ->deferred()) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+
+void Scheduler::MarkColdBlocks() {
+  TRACE("--- MARKING COLD BLOCKS ------------------------------------\n");
+
+  // Blocks that end in a deoptimization or a throw are unlikely to execute,
+  // and so is every block from which all paths lead into deferred blocks.
+  // Marking them as deferred moves them out of the hot code in the final
+  // block layout. Loop headers are never marked, as the loop itself might
+  // still be hot even if all of its exits are cold.
+  ZoneVector<bool> marked(schedule_->BasicBlockCount(), false, zone_);
+  ZoneQueue<BasicBlock*> queue(zone_);
+  for (BasicBlock* const block : *schedule_->all_blocks()) {
+    if (block == schedule_->start()) continue;
+    if (!block->deferred() &&
+        (block->control() == BasicBlock::kDeoptimize ||
+         block->control() == BasicBlock::kThrow)) {
+      block->set_deferred(true);
+      marked[block->id().ToSize()] = true;
+    }
+    if (block->deferred()) queue.push(block);
+  }
+  while (!queue.empty()) {
+    BasicBlock* const block = queue.front();
+    queue.pop();
+    for (BasicBlock* const pred : block->predecessors()) {
+      if (pred->deferred() || pred == schedule_->start()) continue;
+      if (pred->IsLoopHeader()) continue;
+      bool cold = true;
+      for (BasicBlock* const succ : pred->successors()) {
+        if (!succ->deferred()) cold = false;
+      }
+      if (cold) {
+        pred->set_deferred(true);
+        marked[pred->id().ToSize()] = true;
+        queue.push(pred);
+      }
+    }
+  }
+
+  // Undo the marks that would leave a deferred block with a non-deferred
+  // predecessor or successor, until a fixed point is reached.
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (BasicBlock* const block : *schedule_->all_blocks()) {
+      if (!marked[block->id().ToSize()]) continue;
+      if (!HasConsistentDeferredEdges(block)) {
+        block->set_deferred(false);
+        marked[block->id().ToSize()] = false;
+        changed = true;
+      }
+    }
+  }
+
+  if (FLAG_trace_turbo_scheduler) {
+    for (BasicBlock* const block : *schedule_->all_blocks()) {
+      if (marked[block->id().ToSize()]) {
+        TRACE("Marked id:%d as deferred\n", block->id().ToInt());
+      }
+    }
+  }
+}
+
+
 void Scheduler::PropagateImmediateDominators(BasicBlock* block) {
   for (/*nop*/; block != nullptr; block = block->rpo_next()) {
     auto pred = block->predecessors().begin();
@@ -93,6 +93,7 @@ class Scheduler {
   // Phase 2: Compute special RPO and dominator tree.
   friend class SpecialRPONumberer;
   void ComputeSpecialRPONumbering();
+  void MarkColdBlocks();
   void GenerateImmediateDominatorTree();
 
   // Phase 3: Prepare use counts for nodes.
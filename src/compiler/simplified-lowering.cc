@@ -1682,8 +1682,21 @@ class RepresentationSelector {
       }
 
       case IrOpcode::kCheckBounds: {
-        VisitBinop(node, UseInfo::CheckedSigned32AsWord32(),
-                   UseInfo::TruncatingWord32(), MachineRepresentation::kWord32);
+        Type* index_type = GetUpperBound(node->InputAt(0));
+        Type* length_type = GetUpperBound(node->InputAt(1));
+        if (index_type->IsInhabited() && length_type->IsInhabited() &&
+            index_type->Is(Type::Unsigned32()) &&
+            index_type->Max() < length_type->Min()) {
+          // The bounds check is redundant if the index is known to be below
+          // the lower bound of the length.
+          VisitBinop(node, UseInfo::TruncatingWord32(),
+                     MachineRepresentation::kWord32);
+          if (lower()) DeferReplacement(node, node->InputAt(0));
+        } else {
+          VisitBinop(node, UseInfo::CheckedSigned32AsWord32(),
+                     UseInfo::TruncatingWord32(),
+                     MachineRepresentation::kWord32);
+        }
         return;
       }
       case IrOpcode::kCheckTaggedPointer: {
@@ -76,10 +76,13 @@ Typer::~Typer() {
 }
 
 
-class Typer::Visitor : public Reducer {
+class Typer::Visitor : public AdvancedReducer {
  public:
-  explicit Visitor(Typer* typer)
-      : typer_(typer), weakened_nodes_(typer->zone()) {}
+  explicit Visitor(Typer* typer, Editor* editor = nullptr)
+      : AdvancedReducer(editor),
+        typer_(typer),
+        weakened_nodes_(typer->zone()),
+        induction_bounds_(typer->zone()) {}
 
   Reduction Reduce(Node* node) override {
     if (node->op()->ValueOutputCount() == 0) return NoChange();
@@ -185,6 +188,9 @@ class Typer::Visitor : public Reducer {
  private:
   Typer* typer_;
   ZoneSet<NodeId> weakened_nodes_;
+  // Pairs of (bound, phi) for induction variables whose type depends on the
+  // type of a loop bound that is not an input of the phi.
+  ZoneSet<std::pair<Node*, Node*>> induction_bounds_;
 
 #define DECLARE_METHOD(x) inline Type* Type##x(Node* node);
   DECLARE_METHOD(Start)
@@ -204,6 +210,7 @@ class Typer::Visitor : public Reducer {
 
   Type* WrapContextTypeForInput(Node* node);
   Type* Weaken(Node* node, Type* current_type, Type* previous_type);
+  Type* TypeInductionVariable(Node* node);
 
   Zone* zone() { return typer_->zone(); }
   Isolate* isolate() { return typer_->isolate(); }
@@ -214,6 +221,19 @@ class Typer::Visitor : public Reducer {
   }
 
   void SetWeakened(NodeId node_id) { weakened_nodes_.insert(node_id); }
+
+  void AddInductionBound(Node* bound, Node* phi) {
+    induction_bounds_.insert(std::make_pair(bound, phi));
+  }
+  // The typing of induction variables derived from {node} is stale once the
+  // type of {node} changes.
+  void RevisitInductionVariables(Node* node) {
+    for (auto it = induction_bounds_.lower_bound(
+             std::make_pair(node, static_cast<Node*>(nullptr)));
+         it != induction_bounds_.end() && it->first == node; ++it) {
+      Revisit(it->second);
+    }
+  }
   bool IsWeakened(NodeId node_id) {
     return weakened_nodes_.find(node_id) != weakened_nodes_.end();
   }
@@ -278,6 +298,12 @@ class Typer::Visitor : public Reducer {
       if (node->opcode() == IrOpcode::kPhi) {
         // Speed up termination in the presence of range types:
         current = Weaken(node, current, previous);
+        // Loop induction variables are bounded by their loop exit test, which
+        // usually gives a much tighter range than the weakened type.
+        if (Type* induction = TypeInductionVariable(node)) {
+          Type* bounded = Type::Intersect(current, induction, zone());
+          if (previous->Is(bounded)) current = bounded;
+        }
       }
 
       CHECK(previous->Is(current));
@@ -285,12 +311,14 @@ class Typer::Visitor : public Reducer {
       NodeProperties::SetType(node, current);
       if (!current->Is(previous)) {
         // If something changed, revisit all uses.
+        RevisitInductionVariables(node);
         return Changed(node);
       }
       return NoChange();
     } else {
       // No previous type, simply update the type.
       NodeProperties::SetType(node, current);
+      RevisitInductionVariables(node);
       return Changed(node);
     }
   }
@@ -301,8 +329,8 @@ void Typer::Run() { Run(NodeVector(zone())); }
 
 
 void Typer::Run(const NodeVector& roots) {
-  Visitor visitor(this);
   GraphReducer graph_reducer(zone(), graph());
+  Visitor visitor(this, &graph_reducer);
   graph_reducer.AddReducer(&visitor);
   for (Node* const root : roots) graph_reducer.ReduceNode(root);
   graph_reducer.ReduceGraph();
@@ -1264,6 +1292,83 @@ Type* Typer::Visitor::Weaken(Node* node, Type* current_type,
 }
 
 
+// Recognizes loop phis of the form
+//
+//   i = Phi(init, i + k) with k > 0
+//
+// whose loop back edge is only reachable through the true branch of a test
+// i < bound (or i <= bound), and returns the range [init.min, bound.max + k]
+// for such phis (or nullptr if {node} is not an induction variable).
+Type* Typer::Visitor::TypeInductionVariable(Node* node) {
+  DCHECK_EQ(IrOpcode::kPhi, node->opcode());
+  if (node->op()->ValueInputCount() != 2) return nullptr;
+  Node* const loop = NodeProperties::GetControlInput(node);
+  if (loop->opcode() != IrOpcode::kLoop) return nullptr;
+
+  // Match the increment on the back edge.
+  Node* const increment = node->InputAt(1);
+  switch (increment->opcode()) {
+    case IrOpcode::kJSAdd:
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+      break;
+    default:
+      return nullptr;
+  }
+  int const step_index = increment->InputAt(0) == node ? 1 : 0;
+  if (increment->InputAt(1 - step_index) != node) return nullptr;
+  Type* const step = Operand(increment, step_index);
+  Type* const init = Operand(node, 0);
+  Type* const integer = typer_->cache_.kInteger;
+  if (!step->IsInhabited() || !init->IsInhabited()) return nullptr;
+  if (!step->Is(integer) || !init->Is(integer)) return nullptr;
+  if (step->Min() != step->Max() || step->Min() <= 0) return nullptr;
+  if (!std::isfinite(init->Min()) || !std::isfinite(init->Max())) {
+    return nullptr;
+  }
+
+  // Walk up from the back edge in search of the exit test; give up as soon
+  // as control flow merges.
+  for (Node* control = loop->InputAt(1); control != loop;
+       control = NodeProperties::GetControlInput(control)) {
+    if (control->op()->ControlInputCount() != 1) return nullptr;
+    if (control->opcode() == IrOpcode::kLoop) return nullptr;
+    if (control->opcode() != IrOpcode::kIfTrue) continue;
+    Node* const branch = NodeProperties::GetControlInput(control);
+    Node* condition = branch->InputAt(0);
+    if (condition->opcode() == IrOpcode::kJSToBoolean) {
+      condition = condition->InputAt(0);
+    }
+    switch (condition->opcode()) {
+      case IrOpcode::kJSLessThan:
+      case IrOpcode::kJSLessThanOrEqual:
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kNumberLessThanOrEqual:
+      case IrOpcode::kSpeculativeNumberLessThan:
+      case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+        break;
+      default:
+        continue;
+    }
+    if (condition->InputAt(0) != node) continue;
+    // The bound is not an input of {node}, so make sure {node} is typed again
+    // whenever the type of the bound changes.
+    AddInductionBound(NodeProperties::GetValueInput(condition, 1), node);
+    Type* const bound = Operand(condition, 1);
+    if (!bound->IsInhabited() || !bound->Is(Type::Number()) ||
+        !std::isfinite(bound->Max())) {
+      return nullptr;
+    }
+    double const max = std::max(init->Max(), std::floor(bound->Max()) +
+                                                 step->Max());
+    // Make sure the range stays exactly representable.
+    if (max > kMaxSafeInteger) return nullptr;
+    return Type::Range(init->Min(), max, zone());
+  }
+  return nullptr;
+}
+
+
 Type* Typer::Visitor::TypeJSStoreProperty(Node* node) {
   UNREACHABLE();
   return nullptr;
@@ -1467,6 +1572,8 @@ Type* Typer::Visitor::TypeJSCallRuntime(Node* node) {
       return TypeUnaryOp(node, ToString);
     case Runtime::kHasInPrototypeChain:
       return Type::Boolean();
+    case Runtime::kStringConcat:
+      return Type::String();
     default:
       break;
   }
@@ -1828,8 +1935,18 @@ Type* Typer::Visitor::TypeChangeBitToTagged(Node* node) {
 }
 
 Type* Typer::Visitor::TypeCheckBounds(Node* node) {
-  // TODO(bmeurer): We could do better here based on the limit.
-  return Type::Unsigned31();
+  Type* index = Operand(node, 0);
+  Type* length = Operand(node, 1);
+  if (!index->IsInhabited() || !length->IsInhabited()) return Type::None();
+  // The index is known to be in the range [0, length.max - 1] afterwards.
+  double const max = std::min(length->Max() - 1, kMaxInt - 1.0);
+  if (max < 0) return Type::Unsigned31();
+  Type* range = Type::Range(0.0, max, zone());
+  if (index->Is(Type::Number())) {
+    Type* bounded = Type::Intersect(index, range, zone());
+    if (bounded->IsInhabited()) return bounded;
+  }
+  return range;
 }
 
 Type* Typer::Visitor::TypeCheckTaggedPointer(Node* node) {
@@ -2584,12 +2584,24 @@ void WasmGraphBuilder::BoundsCheckMem(MachineType memtype, Node* index,
     }
   }
 
+  // Memory only grows, so a dominating check of the same index that covers
+  // at least the same range implies this one.
+  uint64_t end = static_cast<uint64_t>(offset) + memsize;
+  if (index == last_bounds_check_index_ &&
+      *control_ == last_bounds_check_control_ &&
+      end <= last_bounds_check_end_) {
+    return;
+  }
+
   Node* cond = graph()->NewNode(jsgraph()->machine()->Uint32LessThan(), index,
                                 jsgraph()->RelocatableInt32Constant(
                                     static_cast<uint32_t>(effective_size),
                                     RelocInfo::WASM_MEMORY_SIZE_REFERENCE));
 
   trap_->AddTrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  last_bounds_check_index_ = index;
+  last_bounds_check_control_ = *control_;
+  last_bounds_check_end_ = end;
 }
 
 MachineType WasmGraphBuilder::GetTypeForUnalignedAccess(uint32_t alignment,
@@ -2919,10 +2931,9 @@ void WasmGraphBuilder::SetSourcePosition(Node* node,
 }
 
 static void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
-                                      CompilationInfo* info,
+                                      Isolate* isolate, Handle<Code> code,
                                       const char* message, uint32_t index,
                                       wasm::WasmName func_name) {
-  Isolate* isolate = info->isolate();
   if (isolate->logger()->is_logging_code_events() || isolate->is_profiling()) {
     ScopedVector<char> buffer(128);
     SNPrintF(buffer, "%s#%d:%.*s", message, index, func_name.length(),
@@ -2931,7 +2942,6 @@ static void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
         isolate->factory()->NewStringFromAsciiChecked(buffer.start());
     Handle<String> script_str =
         isolate->factory()->NewStringFromAsciiChecked("(WASM)");
-    Handle<Code> code = info->code();
     Handle<SharedFunctionInfo> shared =
         isolate->factory()->NewSharedFunctionInfo(name_str, code, false);
     PROFILE(isolate, CodeCreateEvent(tag, AbstractCode::cast(*code), *shared,
@@ -2939,14 +2949,20 @@ static void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
   }
 }
 
-Handle<JSFunction> CompileJSToWasmWrapper(
-    Isolate* isolate, wasm::ModuleEnv* module, Handle<String> name,
-    Handle<Code> wasm_code, Handle<JSObject> module_object, uint32_t index) {
-  const wasm::WasmFunction* func = &module->module->functions[index];
+static void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
+                                      CompilationInfo* info,
+                                      const char* message, uint32_t index,
+                                      wasm::WasmName func_name) {
+  RecordFunctionCompilation(tag, info->isolate(), info->code(), message, index,
+                            func_name);
+}
 
-  //----------------------------------------------------------------------------
-  // Create the JSFunction object.
-  //----------------------------------------------------------------------------
+// Creates the JSFunction object for the JS-to-WASM wrapper of {wasm_code}.
+static Handle<JSFunction> NewJSToWasmFunction(Isolate* isolate,
+                                              const wasm::WasmFunction* func,
+                                              Handle<String> name,
+                                              Handle<Code> wasm_code,
+                                              Handle<JSObject> module_object) {
   Handle<SharedFunctionInfo> shared =
       isolate->factory()->NewSharedFunctionInfo(name, wasm_code, false);
   int params = static_cast<int>(func->sig->parameter_count());
@@ -2956,6 +2972,19 @@ Handle<JSFunction> CompileJSToWasmWrapper(
       isolate->wasm_function_map(), name, MaybeHandle<Code>());
   function->SetInternalField(0, *module_object);
   function->set_shared(*shared);
+  return function;
+}
+
+Handle<JSFunction> CompileJSToWasmWrapper(
+    Isolate* isolate, wasm::ModuleEnv* module, Handle<String> name,
+    Handle<Code> wasm_code, Handle<JSObject> module_object, uint32_t index) {
+  const wasm::WasmFunction* func = &module->module->functions[index];
+
+  //----------------------------------------------------------------------------
+  // Create the JSFunction object.
+  //----------------------------------------------------------------------------
+  Handle<JSFunction> function =
+      NewJSToWasmFunction(isolate, func, name, wasm_code, module_object);
 
   //----------------------------------------------------------------------------
   // Create the Graph
@@ -3029,6 +3058,44 @@ Handle<JSFunction> CompileJSToWasmWrapper(
   return function;
 }
 
+Handle<JSFunction> CloneJSToWasmWrapper(Isolate* isolate,
+                                        wasm::ModuleEnv* module,
+                                        Handle<String> name,
+                                        Handle<Code> wasm_code,
+                                        Handle<JSObject> module_object,
+                                        uint32_t index, Handle<Code> wrapper) {
+  const wasm::WasmFunction* func = &module->module->functions[index];
+  DCHECK_EQ(Code::JS_TO_WASM_FUNCTION, wrapper->kind());
+
+  Handle<JSFunction> function =
+      NewJSToWasmFunction(isolate, func, name, wasm_code, module_object);
+
+  // The wrapper only depends on the signature and on the wasm code it calls,
+  // so retarget the call in a copy of {wrapper}.
+  Handle<Code> code = isolate->factory()->CopyCode(wrapper);
+  {
+    AllowDeferredHandleDereference embedding_raw_address;
+    for (RelocIterator it(*code, RelocInfo::kCodeTargetMask); !it.done();
+         it.next()) {
+      Code* target =
+          Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
+      if (target->kind() == Code::WASM_FUNCTION) {
+        it.rinfo()->set_target_address(wasm_code->instruction_start(),
+                                       UPDATE_WRITE_BARRIER,
+                                       SKIP_ICACHE_FLUSH);
+      }
+    }
+  }
+  Assembler::FlushICache(isolate, code->instruction_start(),
+                         code->instruction_size());
+
+  RecordFunctionCompilation(
+      CodeEventListener::FUNCTION_TAG, isolate, code, "js-to-wasm", index,
+      module->module->GetName(func->name_offset, func->name_length));
+  function->set_code(*code);
+  return function;
+}
+
 Handle<Code> CompileWasmToJSWrapper(Isolate* isolate,
                                     Handle<JSFunction> function,
                                     wasm::FunctionSig* sig,
@@ -89,6 +89,16 @@ Handle<JSFunction> CompileJSToWasmWrapper(
     Isolate* isolate, wasm::ModuleEnv* module, Handle<String> name,
     Handle<Code> wasm_code, Handle<JSObject> module_object, uint32_t index);
 
+// Like {CompileJSToWasmWrapper}, but reuses {wrapper}, a JS-to-WASM wrapper
+// previously compiled for a function with the same signature, instead of
+// generating new code.
+Handle<JSFunction> CloneJSToWasmWrapper(Isolate* isolate,
+                                        wasm::ModuleEnv* module,
+                                        Handle<String> name,
+                                        Handle<Code> wasm_code,
+                                        Handle<JSObject> module_object,
+                                        uint32_t index, Handle<Code> wrapper);
+
 // Abstracts details of building TurboFan graph nodes for WASM to separate
 // the WASM decoder from the internal details of TurboFan.
 class WasmTrapHelper;
@@ -212,6 +222,13 @@ class WasmGraphBuilder {
 
   compiler::SourcePositionTable* source_position_table_ = nullptr;
 
+  // The most recent explicit memory bounds check. Accesses with the same
+  // index that are still control dependent on its success branch, and don't
+  // reach further, need no check of their own.
+  Node* last_bounds_check_index_ = nullptr;
+  Node* last_bounds_check_control_ = nullptr;
+  uint64_t last_bounds_check_end_ = 0;
+
   // Internal helper methods.
   JSGraph* jsgraph() { return jsgraph_; }
   Graph* graph();
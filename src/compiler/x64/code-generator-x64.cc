@@ -1570,6 +1570,44 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       }
       break;
     }
+    case kSSEFloat32x4Create: {
+      XMMRegister dst = i.OutputDoubleRegister();
+      DCHECK(dst.is(i.InputDoubleRegister(0)));
+      // dst = [x, x, y, y], scratch = [z, z, w, w], dst = [x, y, z, w].
+      __ shufps(dst, i.InputDoubleRegister(1), 0x00);
+      __ movaps(kScratchDoubleReg, i.InputDoubleRegister(2));
+      __ shufps(kScratchDoubleReg, i.InputDoubleRegister(3), 0x00);
+      __ shufps(dst, kScratchDoubleReg, 0x88);
+      break;
+    }
+    case kSSEFloat32x4ExtractLane: {
+      int32_t lane = i.InputInt32(1);
+      DCHECK(0 <= lane && lane < 4);
+      __ pshufd(i.OutputDoubleRegister(), i.InputDoubleRegister(0),
+                static_cast<uint8_t>(lane));
+      break;
+    }
+    case kSSEFloat32x4Add:
+      __ addps(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
+      break;
+    case kSSEFloat32x4Sub:
+      __ subps(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
+      break;
+    case kSSEFloat32x4Mul:
+      __ mulps(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
+      break;
+    case kSSEFloat32x4Div:
+      __ divps(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
+      break;
+    case kSSEFloat32x4Min:
+      __ minps(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
+      break;
+    case kSSEFloat32x4Max:
+      __ maxps(i.OutputDoubleRegister(), i.InputDoubleRegister(1));
+      break;
+    case kSSEFloat32x4Sqrt:
+      __ sqrtps(i.OutputDoubleRegister(), i.InputDoubleRegister(0));
+      break;
     case kAVXFloat64Abs: {
       // TODO(bmeurer): Use RIP relative 128-bit constants.
       CpuFeatureScope avx_scope(masm(), AVX);
@@ -2291,12 +2329,23 @@ void CodeGenerator::AssembleMove(InstructionOperand* source,
     } else {
       DCHECK(destination->IsFPStackSlot());
       Operand dst = g.ToOperand(destination);
-      __ Movsd(dst, src);
+      if (destination->IsSimd128StackSlot()) {
+        __ movups(dst, src);
+      } else {
+        __ Movsd(dst, src);
+      }
     }
   } else if (source->IsFPStackSlot()) {
     DCHECK(destination->IsFPRegister() || destination->IsFPStackSlot());
     Operand src = g.ToOperand(source);
-    if (destination->IsFPRegister()) {
+    if (source->IsSimd128StackSlot()) {
+      if (destination->IsFPRegister()) {
+        __ movups(g.ToDoubleRegister(destination), src);
+      } else {
+        __ movups(kScratchDoubleReg, src);
+        __ movups(g.ToOperand(destination), kScratchDoubleReg);
+      }
+    } else if (destination->IsFPRegister()) {
       XMMRegister dst = g.ToDoubleRegister(destination);
       __ Movsd(dst, src);
     } else {
@@ -2331,6 +2380,21 @@ void CodeGenerator::AssembleSwap(InstructionOperand* source,
     frame_access_state()->IncreaseSPDelta(-1);
     dst = g.ToOperand(destination);
     __ popq(dst);
+  } else if (source->IsSimd128StackSlot() &&
+             destination->IsSimd128StackSlot()) {
+    // 128-bit memory-memory swap, done in two 64-bit halves.
+    for (int offset = 0; offset < kSimd128Size; offset += kPointerSize) {
+      Operand src(g.ToOperand(source), offset);
+      Operand dst(g.ToOperand(destination), offset);
+      __ movq(kScratchRegister, dst);
+      __ pushq(src);
+      frame_access_state()->IncreaseSPDelta(1);
+      src = Operand(g.ToOperand(source), offset);
+      __ movq(src, kScratchRegister);
+      frame_access_state()->IncreaseSPDelta(-1);
+      dst = Operand(g.ToOperand(destination), offset);
+      __ popq(dst);
+    }
   } else if ((source->IsStackSlot() && destination->IsStackSlot()) ||
              (source->IsFPStackSlot() && destination->IsFPStackSlot())) {
     // Memory-memory.
@@ -2356,9 +2420,15 @@ void CodeGenerator::AssembleSwap(InstructionOperand* source,
     // XMM register-memory swap.
     XMMRegister src = g.ToDoubleRegister(source);
     Operand dst = g.ToOperand(destination);
-    __ Movsd(kScratchDoubleReg, src);
-    __ Movsd(src, dst);
-    __ Movsd(dst, kScratchDoubleReg);
+    if (destination->IsSimd128StackSlot()) {
+      __ movaps(kScratchDoubleReg, src);
+      __ movups(src, dst);
+      __ movups(dst, kScratchDoubleReg);
+    } else {
+      __ Movsd(kScratchDoubleReg, src);
+      __ Movsd(src, dst);
+      __ Movsd(dst, kScratchDoubleReg);
+    }
   } else {
     // No other combinations are possible.
     UNREACHABLE();
@@ -121,6 +121,15 @@ namespace compiler {
   V(AVXFloat64Neg)                 \
   V(AVXFloat32Abs)                 \
   V(AVXFloat32Neg)                 \
+  V(SSEFloat32x4Create)            \
+  V(SSEFloat32x4ExtractLane)       \
+  V(SSEFloat32x4Add)               \
+  V(SSEFloat32x4Sub)               \
+  V(SSEFloat32x4Mul)               \
+  V(SSEFloat32x4Div)               \
+  V(SSEFloat32x4Min)               \
+  V(SSEFloat32x4Max)               \
+  V(SSEFloat32x4Sqrt)              \
   V(X64Movsxbl)                    \
   V(X64Movzxbl)                    \
   V(X64Movb)                       \
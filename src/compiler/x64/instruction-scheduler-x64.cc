@@ -4,6 +4,8 @@
 
 #include "src/compiler/instruction-scheduler.h"
 
+#include "src/assembler.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -123,6 +125,15 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kAVXFloat64Neg:
     case kAVXFloat32Abs:
     case kAVXFloat32Neg:
+    case kSSEFloat32x4Create:
+    case kSSEFloat32x4ExtractLane:
+    case kSSEFloat32x4Add:
+    case kSSEFloat32x4Sub:
+    case kSSEFloat32x4Mul:
+    case kSSEFloat32x4Div:
+    case kSSEFloat32x4Min:
+    case kSSEFloat32x4Max:
+    case kSSEFloat32x4Sqrt:
     case kX64BitcastFI:
     case kX64BitcastDL:
     case kX64BitcastIF:
@@ -140,9 +151,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Movsxwl:
     case kX64Movzxwl:
     case kX64Movsxlq:
-      DCHECK(instr->InputCount() >= 1);
-      return instr->InputAt(0)->IsRegister() ? kNoOpcodeFlags
-                                             : kIsLoadOperation;
+      return instr->addressing_mode() == kMode_None ? kNoOpcodeFlags
+                                                    : kIsLoadOperation;
 
     case kX64Movb:
     case kX64Movw:
@@ -187,8 +197,200 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // TODO(all): Add instruction cost modeling.
-  return 1;
+  // Basic latency modeling for x64 instructions, based on the published
+  // latencies for Haswell class cores. Atom class cores (Bonnell/Silvermont)
+  // are in-order or have a much narrower out-of-order window, and get their
+  // own numbers where they differ significantly.
+  bool const atom = CpuFeatures::IsSupported(ATOM);
+  // Instructions with a memory operand pay for the load on top.
+  int const load_latency = atom ? 3 : 4;
+  int const memory_latency =
+      instr->addressing_mode() == kMode_None ? 0 : load_latency;
+  switch (instr->arch_opcode()) {
+    case kX64Add:
+    case kX64Add32:
+    case kX64And:
+    case kX64And32:
+    case kX64Cmp:
+    case kX64Cmp32:
+    case kX64Cmp16:
+    case kX64Cmp8:
+    case kX64Test:
+    case kX64Test32:
+    case kX64Test16:
+    case kX64Test8:
+    case kX64Or:
+    case kX64Or32:
+    case kX64Xor:
+    case kX64Xor32:
+    case kX64Sub:
+    case kX64Sub32:
+    case kX64Not:
+    case kX64Not32:
+    case kX64Neg:
+    case kX64Neg32:
+    case kX64Shl:
+    case kX64Shl32:
+    case kX64Shr:
+    case kX64Shr32:
+    case kX64Sar:
+    case kX64Sar32:
+    case kX64Ror:
+    case kX64Ror32:
+    case kX64Dec32:
+    case kX64Inc32:
+      return 1 + memory_latency;
+
+    case kX64Lea:
+    case kX64Lea32:
+      // The addressing mode is the computation here, not a memory access.
+      return 1;
+
+    case kX64Imul32:
+      return 3 + memory_latency;
+
+    case kX64Imul:
+      return (atom ? 5 : 3) + memory_latency;
+
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+      return (atom ? 5 : 4) + memory_latency;
+
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return atom ? 30 : 26;
+
+    case kX64Idiv:
+    case kX64Udiv:
+      return atom ? 70 : 40;
+
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
+      return 3 + memory_latency;
+
+    case kSSEFloat32Cmp:
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Max:
+    case kSSEFloat32Min:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Max:
+    case kAVXFloat32Min:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Max:
+    case kAVXFloat64Min:
+    case kSSEFloat32x4Add:
+    case kSSEFloat32x4Sub:
+    case kSSEFloat32x4Min:
+    case kSSEFloat32x4Max:
+      return 3 + memory_latency;
+
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+    case kSSEFloat32x4Mul:
+      return 5 + memory_latency;
+
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+      return atom ? 19 : 11;
+
+    case kSSEFloat32x4Div:
+      return atom ? 39 : 11;
+
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+      return atom ? 34 : 14;
+
+    case kSSEFloat32Sqrt:
+      return atom ? 20 : 11;
+
+    case kSSEFloat32x4Sqrt:
+      return atom ? 40 : 11;
+
+    case kSSEFloat64Sqrt:
+      return atom ? 35 : 16;
+
+    case kSSEFloat64Mod:
+      // Implemented as a fprem loop through the x87 stack.
+      return 50;
+
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return 6;
+
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToUint64:
+    case kSSEFloat32ToUint64:
+    case kSSEInt32ToFloat64:
+    case kSSEInt32ToFloat32:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+    case kSSEUint32ToFloat64:
+    case kSSEUint32ToFloat32:
+      return (atom ? 5 : 4) + memory_latency;
+
+    case kX64BitcastFI:
+    case kX64BitcastDL:
+    case kX64BitcastIF:
+    case kX64BitcastLD:
+    case kSSEFloat64ExtractLowWord32:
+    case kSSEFloat64ExtractHighWord32:
+    case kSSEFloat64InsertLowWord32:
+    case kSSEFloat64InsertHighWord32:
+      return (atom ? 4 : 2) + memory_latency;
+
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxlq:
+      return instr->addressing_mode() == kMode_None ? 1 : load_latency;
+
+    case kX64Movl:
+    case kX64Movq:
+      return instr->HasOutput() && memory_latency != 0 ? load_latency : 1;
+
+    case kX64Movsd:
+    case kX64Movss:
+    case kSSEFloat64LoadLowWord32:
+      return instr->HasOutput() ? load_latency + 1 : 1;
+
+    case kX64StackCheck:
+      return load_latency;
+
+    case kX64Xchgb:
+    case kX64Xchgw:
+    case kX64Xchgl:
+      // Exchanges with memory are implicitly locked.
+      return 20;
+
+    default:
+      return 1;
+  }
 }
 
 }  // namespace compiler
@@ -2059,6 +2059,62 @@ void InstructionSelector::VisitFloat64SilenceNaN(Node* node) {
        g.UseRegister(node->InputAt(0)));
 }
 
+void InstructionSelector::VisitCreateFloat32x4(Node* node) {
+  X64OperandGenerator g(this);
+  Emit(kSSEFloat32x4Create, g.DefineSameAsFirst(node),
+       g.UseRegister(node->InputAt(0)), g.UseUniqueRegister(node->InputAt(1)),
+       g.UseUniqueRegister(node->InputAt(2)),
+       g.UseUniqueRegister(node->InputAt(3)));
+}
+
+void InstructionSelector::VisitFloat32x4ExtractLane(Node* node) {
+  X64OperandGenerator g(this);
+  Emit(kSSEFloat32x4ExtractLane, g.DefineAsRegister(node),
+       g.UseRegister(node->InputAt(0)), g.UseImmediate(node->InputAt(1)));
+}
+
+namespace {
+
+void VisitFloat32x4Binop(InstructionSelector* selector, Node* node,
+                         ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  // Packed operations require aligned memory operands, so we always use
+  // registers for both inputs.
+  selector->Emit(opcode, g.DefineSameAsFirst(node),
+                 g.UseRegister(node->InputAt(0)),
+                 g.UseRegister(node->InputAt(1)));
+}
+
+}  // namespace
+
+void InstructionSelector::VisitFloat32x4Add(Node* node) {
+  VisitFloat32x4Binop(this, node, kSSEFloat32x4Add);
+}
+
+void InstructionSelector::VisitFloat32x4Sub(Node* node) {
+  VisitFloat32x4Binop(this, node, kSSEFloat32x4Sub);
+}
+
+void InstructionSelector::VisitFloat32x4Mul(Node* node) {
+  VisitFloat32x4Binop(this, node, kSSEFloat32x4Mul);
+}
+
+void InstructionSelector::VisitFloat32x4Div(Node* node) {
+  VisitFloat32x4Binop(this, node, kSSEFloat32x4Div);
+}
+
+void InstructionSelector::VisitFloat32x4Min(Node* node) {
+  VisitFloat32x4Binop(this, node, kSSEFloat32x4Min);
+}
+
+void InstructionSelector::VisitFloat32x4Max(Node* node) {
+  VisitFloat32x4Binop(this, node, kSSEFloat32x4Max);
+}
+
+void InstructionSelector::VisitFloat32x4Sqrt(Node* node) {
+  VisitRR(this, node, kSSEFloat32x4Sqrt);
+}
+
 void InstructionSelector::VisitAtomicLoad(Node* node) {
   LoadRepresentation load_rep = LoadRepresentationOf(node->op());
   DCHECK(load_rep.representation() == MachineRepresentation::kWord8 ||
@@ -64,8 +64,11 @@ void ZonePool::StatsScope::ZoneReturned(Zone* zone) {
   }
 }
 
-ZonePool::ZonePool(base::AccountingAllocator* allocator)
-    : max_allocated_bytes_(0), total_deleted_bytes_(0), allocator_(allocator) {}
+ZonePool::ZonePool(base::AccountingAllocator* allocator, ZoneBudget* budget)
+    : max_allocated_bytes_(0),
+      total_deleted_bytes_(0),
+      allocator_(allocator),
+      budget_(budget) {}
 
 ZonePool::~ZonePool() {
   DCHECK(used_.empty());
@@ -103,6 +106,7 @@ Zone* ZonePool::NewEmptyZone() {
     unused_.pop_back();
   } else {
     zone = new Zone(allocator_);
+    zone->set_budget(budget_);
   }
   used_.push_back(zone);
   DCHECK_EQ(0u, zone->allocation_size());
@@ -61,7 +61,9 @@ class ZonePool final {
     DISALLOW_COPY_AND_ASSIGN(StatsScope);
   };
 
-  explicit ZonePool(base::AccountingAllocator* allocator);
+  // Zones handed out by the pool are accounted to {budget}, if present.
+  explicit ZonePool(base::AccountingAllocator* allocator,
+                    ZoneBudget* budget = nullptr);
   ~ZonePool();
 
   size_t GetMaxAllocatedBytes();
@@ -83,6 +85,7 @@ class ZonePool final {
   size_t max_allocated_bytes_;
   size_t total_deleted_bytes_;
   base::AccountingAllocator* allocator_;
+  ZoneBudget* budget_;
 
   DISALLOW_COPY_AND_ASSIGN(ZonePool);
 };
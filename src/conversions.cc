@@ -125,6 +125,25 @@ const char* DoubleToCString(double v, Vector<char> buffer) {
     case FP_INFINITE: return (v < 0.0 ? "-Infinity" : "Infinity");
     case FP_ZERO: return "0";
     default: {
+      if (-kMaxSafeInteger <= v && v <= kMaxSafeInteger) {
+        // Integral values in the safe integer range are printed as plain
+        // digits (ECMA-262 section 9.8.1 step 6), which is much cheaper to
+        // produce directly than through the shortest dtoa algorithm.
+        int64_t integer = static_cast<int64_t>(v);
+        if (static_cast<double>(integer) == v) {
+          uint64_t magnitude =
+              static_cast<uint64_t>(integer < 0 ? -integer : integer);
+          int i = buffer.length();
+          buffer[--i] = '\0';
+          do {
+            buffer[--i] = '0' + (magnitude % 10);
+            magnitude /= 10;
+          } while (magnitude);
+          if (integer < 0) buffer[--i] = '-';
+          return buffer.start() + i;
+        }
+      }
+
       SimpleStringBuilder builder(buffer.start(), buffer.length());
       int decimal_point;
       int sign;
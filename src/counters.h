@@ -833,6 +833,20 @@ class RuntimeCallTimerScope {
   HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 6, 6)             \
   HR(errors_thrown_per_context, V8.ErrorsThrownPerContext, 0, 200, 20)        \
   HR(debug_feature_usage, V8.DebugFeatureUsage, 1, 7, 7)                      \
+  /* GC phase times in microseconds, recorded by GCTracer::Stop. */           \
+  HR(gc_mark_compactor_clear, V8.GCMarkCompactorClear, 0, 1000000, 50)        \
+  HR(gc_mark_compactor_evacuate, V8.GCMarkCompactorEvacuate, 0, 1000000, 50)  \
+  HR(gc_mark_compactor_finish, V8.GCMarkCompactorFinish, 0, 1000000, 50)      \
+  HR(gc_mark_compactor_mark, V8.GCMarkCompactorMark, 0, 1000000, 50)          \
+  HR(gc_mark_compactor_sweep, V8.GCMarkCompactorSweep, 0, 1000000, 50)        \
+  HR(gc_scavenger_old_to_new_pointers, V8.GCScavengerOldToNewPointers, 0,     \
+     1000000, 50)                                                             \
+  HR(gc_scavenger_roots, V8.GCScavengerRoots, 0, 1000000, 50)                 \
+  HR(gc_scavenger_semispace, V8.GCScavengerSemispace, 0, 1000000, 50)         \
+  HR(gc_scavenger_weak, V8.GCScavengerWeak, 0, 1000000, 50)                   \
+  /* Young generation survival in percent of the new space size. */           \
+  HR(gc_new_space_promotion_ratio, V8.GCNewSpacePromotionRatio, 0, 100, 101)  \
+  HR(gc_new_space_survival_ratio, V8.GCNewSpaceSurvivalRatio, 0, 100, 101)    \
   /* Asm/Wasm. */                                                             \
   HR(wasm_functions_per_module, V8.WasmFunctionsPerModule, 1, 10000, 51)
 
@@ -966,7 +980,13 @@ class RuntimeCallTimerScope {
   SC(pc_to_code, V8.PcToCode)                                         \
   SC(pc_to_code_cached, V8.PcToCodeCached)                            \
   /* The store-buffer implementation of the write barrier. */         \
-  SC(store_buffer_overflows, V8.StoreBufferOverflows)
+  SC(store_buffer_overflows, V8.StoreBufferOverflows)                 \
+  /* Allocation site pretenuring decisions. */                        \
+  SC(allocation_sites_tenured, V8.AllocationSitesTenured)             \
+  SC(allocation_sites_tenure_reset, V8.AllocationSitesTenureReset)    \
+  /* Chunks advised to use huge pages, and those that cannot. */      \
+  SC(huge_page_chunks, V8.HugePageChunks)                             \
+  SC(huge_page_fallback_chunks, V8.HugePageFallbackChunks)
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
   /* Number of code stubs. */                                                  \
@@ -1051,6 +1071,7 @@ class RuntimeCallTimerScope {
   SC(crankshaft_escape_allocs_replaced, V8.CrankshaftEscapeAllocsReplaced)     \
   SC(turbo_escape_loads_replaced, V8.TurboEscapeLoadsReplaced)                 \
   SC(crankshaft_escape_loads_replaced, V8.CrankshaftEscapeLoadsReplaced)       \
+  SC(turbo_zone_budget_exceeded, V8.TurboZoneBudgetExceeded)                   \
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
@@ -371,6 +371,26 @@ SideEffects SideEffectsTracker::ComputeChanges(HInstruction* instr) {
       }
     }
   }
+  if (result.ContainsFlag(kTypedArrayElements) ||
+      result.ContainsFlag(kExternalMemory)) {
+    // A typed array store with a constant key leaves the tracked elements of
+    // the same typed array that it doesn't overlap alone. Everything else may
+    // alias any tracked element.
+    TypedArrayElementAccess store;
+    bool is_tracked_store =
+        instr->IsStoreKeyed() && GetTypedArrayElementAccess(instr, &store);
+    for (index = 0; index < kNumberOfTypedArrayElements; ++index) {
+      if (is_tracked_store && index < num_typed_array_elements_) {
+        const TypedArrayElementAccess& load = typed_array_elements_[index];
+        if (load.elements == store.elements &&
+            (load.offset + load.size <= store.offset ||
+             store.offset + store.size <= load.offset)) {
+          continue;
+        }
+      }
+      result.AddSpecial(TypedArrayElement(index));
+    }
+  }
   return result;
 }
 
@@ -403,6 +423,17 @@ SideEffects SideEffectsTracker::ComputeDependsOn(HInstruction* instr) {
       }
     }
   }
+  if (result.ContainsFlag(kTypedArrayElements) && instr->IsLoadKeyed()) {
+    TypedArrayElementAccess load;
+    if (GetTypedArrayElementAccess(instr, &load) &&
+        ComputeTypedArrayElement(load, &index)) {
+      // Every instruction that changes typed array elements or external
+      // memory also changes the tracked element, see ComputeChanges.
+      result.RemoveFlag(kTypedArrayElements);
+      result.RemoveFlag(kExternalMemory);
+      result.AddSpecial(TypedArrayElement(index));
+    }
+  }
   return result;
 }
 
@@ -441,6 +472,15 @@ GVN_UNTRACKED_FLAG_LIST(DECLARE_FLAG)
       separator = ", ";
     }
   }
+  for (int index = 0; index < t->num_typed_array_elements_; ++index) {
+    if (te.effects.ContainsSpecial(t->TypedArrayElement(index))) {
+      const SideEffectsTracker::TypedArrayElementAccess& access =
+          t->typed_array_elements_[index];
+      os << separator << "[v" << access.elements->id() << " + "
+         << access.offset << "]";
+      separator = ", ";
+    }
+  }
   os << "]";
   return os;
 }
@@ -490,6 +530,70 @@ bool SideEffectsTracker::ComputeInobjectField(HObjectAccess access,
 }
 
 
+// static
+bool SideEffectsTracker::GetTypedArrayElementAccess(
+    HInstruction* instr, TypedArrayElementAccess* access) {
+  HValue* elements;
+  HValue* key;
+  ElementsKind elements_kind;
+  uint32_t base_offset;
+  if (instr->IsLoadKeyed()) {
+    HLoadKeyed* load = HLoadKeyed::cast(instr);
+    // SIMD accesses cover more than one element.
+    if (load->op() != kNumberOfBuiltinFunction) return false;
+    elements = load->elements();
+    key = load->key();
+    elements_kind = load->elements_kind();
+    base_offset = load->base_offset();
+  } else if (instr->IsStoreKeyed()) {
+    HStoreKeyed* store = HStoreKeyed::cast(instr);
+    if (store->op() != kNumberOfBuiltinFunction) return false;
+    elements = store->elements();
+    key = store->key();
+    elements_kind = store->elements_kind();
+    base_offset = store->base_offset();
+  } else {
+    return false;
+  }
+  if (!IsFixedTypedArrayElementsKind(elements_kind)) return false;
+  if (!key->IsInteger32Constant()) return false;
+  static const int kMaxKey = 1 << 20;
+  int32_t constant_key = key->GetInteger32Constant();
+  if (constant_key < 0 || constant_key >= kMaxKey) return false;
+  if (base_offset > static_cast<uint32_t>(kMaxInt / 2)) return false;
+  int shift = ElementsKindToShiftSize(elements_kind);
+  access->elements = elements;
+  access->offset = static_cast<int>(base_offset) + (constant_key << shift);
+  access->size = 1 << shift;
+  return true;
+}
+
+
+bool SideEffectsTracker::ComputeTypedArrayElement(
+    const TypedArrayElementAccess& access, int* index) {
+  for (int i = 0; i < num_typed_array_elements_; ++i) {
+    const TypedArrayElementAccess& other = typed_array_elements_[i];
+    if (access.elements == other.elements && access.offset == other.offset &&
+        access.size == other.size) {
+      *index = i;
+      return true;
+    }
+  }
+  if (num_typed_array_elements_ < kNumberOfTypedArrayElements) {
+    if (FLAG_trace_gvn) {
+      OFStream os(stdout);
+      os << "Tracking typed array element [v" << access.elements->id() << " + "
+         << access.offset << "] (mapped to index "
+         << num_typed_array_elements_ << ")" << std::endl;
+    }
+    *index = num_typed_array_elements_;
+    typed_array_elements_[num_typed_array_elements_++] = access;
+    return true;
+  }
+  return false;
+}
+
+
 HGlobalValueNumberingPhase::HGlobalValueNumberingPhase(HGraph* graph)
     : HPhase("H_Global value numbering", graph),
       removed_side_effects_(false),
@@ -61,10 +61,15 @@ struct TrackedEffects;
 // fashion, and represents them using the "special" dynamic side effects of the
 // SideEffects class (see above). This way unrelated global variable/inobject
 // field stores don't prevent hoisting and merging of global variable/inobject
-// field loads.
+// field loads. Typed array element loads with a constant key are tracked as
+// well, so that stores to other elements of the same typed array don't kill
+// them.
 class SideEffectsTracker final BASE_EMBEDDED {
  public:
-  SideEffectsTracker() : num_global_vars_(0), num_inobject_fields_(0) {}
+  SideEffectsTracker()
+      : num_global_vars_(0),
+        num_inobject_fields_(0),
+        num_typed_array_elements_(0) {}
   SideEffects ComputeChanges(HInstruction* instr);
   SideEffects ComputeDependsOn(HInstruction* instr);
 
@@ -73,6 +78,19 @@ class SideEffectsTracker final BASE_EMBEDDED {
   bool ComputeGlobalVar(Unique<PropertyCell> cell, int* index);
   bool ComputeInobjectField(HObjectAccess access, int* index);
 
+  // A plain typed array element access with a constant key. Two such
+  // accesses to the same elements value alias only if their byte ranges
+  // overlap; different elements values may be views on the same buffer.
+  struct TypedArrayElementAccess {
+    HValue* elements;
+    int offset;
+    int size;
+  };
+  static bool GetTypedArrayElementAccess(HInstruction* instr,
+                                         TypedArrayElementAccess* access);
+  bool ComputeTypedArrayElement(const TypedArrayElementAccess& access,
+                                int* index);
+
   static int GlobalVar(int index) {
     DCHECK(index >= 0);
     DCHECK(index < kNumberOfGlobalVars);
@@ -83,17 +101,29 @@ class SideEffectsTracker final BASE_EMBEDDED {
     DCHECK(index < kNumberOfInobjectFields);
     return index + kNumberOfGlobalVars;
   }
+  static int TypedArrayElement(int index) {
+    DCHECK(index >= 0);
+    DCHECK(index < kNumberOfTypedArrayElements);
+    return index + kNumberOfGlobalVars + kNumberOfInobjectFields;
+  }
 
   // Track up to four global vars.
   static const int kNumberOfGlobalVars = 4;
   Unique<PropertyCell> global_vars_[kNumberOfGlobalVars];
   int num_global_vars_;
 
+  // Track up to eight typed array elements.
+  static const int kNumberOfTypedArrayElements = 8;
+
   // Track up to n inobject fields.
-  static const int kNumberOfInobjectFields =
-      SideEffects::kNumberOfSpecials - kNumberOfGlobalVars;
+  static const int kNumberOfInobjectFields = SideEffects::kNumberOfSpecials -
+                                             kNumberOfGlobalVars -
+                                             kNumberOfTypedArrayElements;
   HObjectAccess inobject_fields_[kNumberOfInobjectFields];
   int num_inobject_fields_;
+
+  TypedArrayElementAccess typed_array_elements_[kNumberOfTypedArrayElements];
+  int num_typed_array_elements_;
 };
 
 
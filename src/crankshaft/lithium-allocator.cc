@@ -1112,6 +1112,7 @@ bool LAllocator::Allocate(LChunk* chunk) {
   PopulatePointerMaps();
   ConnectRanges();
   ResolveControlFlow();
+  if (FLAG_trace_alloc) TraceSpillMoves();
   return true;
 }
 
@@ -1285,6 +1286,61 @@ void LAllocator::ResolveControlFlow() {
 }
 
 
+static bool IsRegisterOperand(LOperand* operand) {
+  return operand->IsRegister() || operand->IsDoubleRegister() ||
+         operand->IsSIMD128Register();
+}
+
+
+static bool IsStackSlotOperand(LOperand* operand) {
+  return operand->IsStackSlot() || operand->IsDoubleStackSlot() ||
+         operand->IsSIMD128StackSlot();
+}
+
+
+void LAllocator::TraceSpillMoves() {
+  // Count the moves between registers and spill slots, grouped by the loop
+  // nesting depth of the block they end up in.
+  static const int kMaxLoopDepth = 4;
+  int stores[kMaxLoopDepth + 1] = {0};
+  int loads[kMaxLoopDepth + 1] = {0};
+  const ZoneList<HBasicBlock*>* blocks = graph_->blocks();
+  for (int i = 0; i < blocks->length(); ++i) {
+    HBasicBlock* block = blocks->at(i);
+    int depth = Min(block->LoopNestingDepth(), kMaxLoopDepth);
+    for (int index = block->first_instruction_index();
+         index <= block->last_instruction_index(); ++index) {
+      if (!IsGapAt(index)) continue;
+      LGap* gap = GapAt(index);
+      for (int pos = LGap::FIRST_INNER_POSITION;
+           pos <= LGap::LAST_INNER_POSITION; ++pos) {
+        LParallelMove* move =
+            gap->GetParallelMove(static_cast<LGap::InnerPosition>(pos));
+        if (move == NULL) continue;
+        ZoneList<LMoveOperands>* moves = move->move_operands();
+        for (int j = 0; j < moves->length(); ++j) {
+          LMoveOperands* cur = &moves->at(j);
+          if (cur->IsRedundant()) continue;
+          if (IsRegisterOperand(cur->source()) &&
+              IsStackSlotOperand(cur->destination())) {
+            stores[depth]++;
+          } else if (IsStackSlotOperand(cur->source()) &&
+                     IsRegisterOperand(cur->destination())) {
+            loads[depth]++;
+          }
+        }
+      }
+    }
+  }
+  for (int depth = 0; depth <= kMaxLoopDepth; ++depth) {
+    if (stores[depth] == 0 && loads[depth] == 0) continue;
+    TraceAlloc("Spill moves at loop depth %d%s: %d stores, %d reloads\n",
+               depth, depth == kMaxLoopDepth ? "+" : "", stores[depth],
+               loads[depth]);
+  }
+}
+
+
 void LAllocator::BuildLiveRanges() {
   LAllocatorPhase phase("L_Build live ranges", this);
   InitializeLivenessAnalysis();
@@ -2048,11 +2104,16 @@ void LAllocator::SplitAndSpillIntersecting(LiveRange* current) {
       LifetimePosition next_intersection = range->FirstIntersection(current);
       if (next_intersection.IsValid()) {
         UsePosition* next_pos = range->NextRegisterPosition(current->Start());
+        // As for active ranges, prefer spilling at the header of the
+        // outermost loop without register uses to keep spill stores out of
+        // the loop body.
+        LifetimePosition spill_pos = FindOptimalSpillingPos(range, split_pos);
         if (next_pos == NULL) {
-          SpillAfter(range, split_pos);
+          SpillAfter(range, spill_pos);
         } else {
           next_intersection = Min(next_intersection, next_pos->pos());
-          SpillBetween(range, split_pos, next_intersection);
+          SpillBetweenUntil(range, spill_pos, current->Start(),
+                            next_intersection);
         }
         if (!AllocationOk()) return;
         InactiveToHandled(range);
@@ -1506,7 +1506,7 @@ SourceGroup::~SourceGroup() {
 }
 
 
-void SourceGroup::Execute(Isolate* isolate) {
+void SourceGroup::Execute(Isolate* isolate, Global<String>* sources) {
   bool exception_was_thrown = false;
   for (int i = begin_offset_; i < end_offset_; ++i) {
     const char* arg = argv_[i];
@@ -1541,10 +1541,18 @@ void SourceGroup::Execute(Isolate* isolate) {
     Local<String> file_name =
         String::NewFromUtf8(isolate, arg, NewStringType::kNormal)
             .ToLocalChecked();
-    Local<String> source = ReadFile(isolate, arg);
-    if (source.IsEmpty()) {
-      printf("Error reading '%s'\n", arg);
-      Shell::Exit(1);
+    Global<String>* cached =
+        sources != NULL ? &sources[i - begin_offset_] : NULL;
+    Local<String> source;
+    if (cached != NULL && !cached->IsEmpty()) {
+      source = cached->Get(isolate);
+    } else {
+      source = ReadFile(isolate, arg);
+      if (source.IsEmpty()) {
+        printf("Error reading '%s'\n", arg);
+        Shell::Exit(1);
+      }
+      if (cached != NULL) cached->Reset(isolate, source);
     }
     Shell::options.script_executed = true;
     if (!Shell::ExecuteString(isolate, source, file_name, false, true,
@@ -1608,6 +1616,81 @@ void SourceGroup::ExecuteInThread() {
 }
 
 
+class LoadThread : public base::Thread {
+ public:
+  LoadThread(SourceGroup* group, double deadline)
+      : base::Thread(base::Thread::Options("LoadThread", 2 * MB)),
+        group_(group),
+        deadline_(deadline),
+        runs_(0),
+        seconds_(0) {}
+
+  virtual void Run() {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    // The files of the group are read on the first run only, so that later
+    // runs do not measure file system access.
+    Global<String>* sources = new Global<String>[group_->argument_count()];
+    double start = g_platform->MonotonicallyIncreasingTime();
+    double now = start;
+    do {
+      {
+        Isolate::Scope iscope(isolate);
+        HandleScope scope(isolate);
+        PerIsolateData data(isolate);
+        Local<Context> context = Shell::CreateEvaluationContext(isolate);
+        {
+          Context::Scope cscope(context);
+          PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+          group_->Execute(isolate, sources);
+        }
+      }
+      runs_++;
+      now = g_platform->MonotonicallyIncreasingTime();
+    } while (now < deadline_);
+    seconds_ = now - start;
+    delete[] sources;
+    isolate->Dispose();
+  }
+
+  int runs() const { return runs_; }
+  double seconds() const { return seconds_; }
+
+ private:
+  SourceGroup* group_;
+  double deadline_;
+  int runs_;
+  double seconds_;
+};
+
+
+int Shell::RunLoad() {
+  int count = options.load_threads;
+  double deadline = g_platform->MonotonicallyIncreasingTime() +
+                    options.load_duration_ms / 1000.0;
+  i::List<LoadThread*> threads(count);
+  for (int i = 0; i < count; ++i) {
+    threads.Add(new LoadThread(&options.isolate_sources[0], deadline));
+    threads[i]->Start();
+  }
+  double total = 0;
+  for (int i = 0; i < count; ++i) {
+    threads[i]->Join();
+    CHECK_LT(0, threads[i]->runs());
+    double rate = threads[i]->seconds() > 0
+                      ? threads[i]->runs() / threads[i]->seconds()
+                      : 0;
+    printf("Load thread %d: %d runs in %.3f s, %.1f runs/s\n", i,
+           threads[i]->runs(), threads[i]->seconds(), rate);
+    total += rate;
+    delete threads[i];
+  }
+  printf("Load total: %d threads, %.1f runs/s\n", count, total);
+  return 0;
+}
+
+
 void SourceGroup::StartExecuteInThread() {
   if (thread_ == NULL) {
     thread_ = new IsolateThread(this);
@@ -1967,6 +2050,16 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = NULL;
+    } else if (strncmp(argv[i], "--load-threads=", 15) == 0) {
+#ifdef V8_SHARED
+      printf("D8 with shared library does not support multi-threading\n");
+      return false;
+#endif  // V8_SHARED
+      options.load_threads = atoi(argv[i] + 15);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--load-duration=", 16) == 0) {
+      options.load_duration_ms = atoi(argv[i] + 16);
+      argv[i] = NULL;
     } else if (strncmp(argv[i], "--icu-data-file=", 16) == 0) {
       options.icu_data_file = argv[i] + 16;
       argv[i] = NULL;
@@ -2194,6 +2287,36 @@ bool Shell::SerializeValue(Isolate* isolate, Local<Value> value,
       externalized_shared_contents_.Add(contents);
     }
     out_data->WriteSharedArrayBufferContents(contents);
+  } else if (value->IsMap() || value->IsSet()) {
+    // Maps are written as their flattened [key, value, ...] entries and Sets
+    // as their keys, so the insertion order survives the round trip.
+    Local<Object> collection = Local<Object>::Cast(value);
+    if (FindInObjectList(collection, *seen_objects)) {
+      Throw(isolate, "Duplicated collections not supported");
+      return false;
+    }
+    seen_objects->Add(collection);
+    Local<Array> entries;
+    if (value->IsMap()) {
+      out_data->WriteTag(kSerializationTagMap);
+      entries = Local<Map>::Cast(value)->AsArray();
+    } else {
+      out_data->WriteTag(kSerializationTagSet);
+      entries = Local<Set>::Cast(value)->AsArray();
+    }
+    uint32_t length = entries->Length();
+    out_data->Write(length);
+    for (uint32_t i = 0; i < length; ++i) {
+      Local<Value> entry;
+      if (entries->Get(context, i).ToLocal(&entry)) {
+        if (!SerializeValue(isolate, entry, to_transfer, seen_objects,
+                            out_data))
+          return false;
+      } else {
+        Throw(isolate, "Failed to serialize collection entry.");
+        return false;
+      }
+    }
   } else if (value->IsObject()) {
     Local<Object> object = Local<Object>::Cast(value);
     if (FindInObjectList(object, *seen_objects)) {
@@ -2294,6 +2417,31 @@ MaybeLocal<Value> Shell::DeserializeValue(Isolate* isolate,
       result = object;
       break;
     }
+    case kSerializationTagMap: {
+      uint32_t length = data.Read<uint32_t>(offset);
+      CHECK_EQ(0u, length % 2);
+      Local<Map> map = Map::New(isolate);
+      for (uint32_t i = 0; i < length; i += 2) {
+        Local<Value> key;
+        CHECK(DeserializeValue(isolate, data, offset).ToLocal(&key));
+        Local<Value> value;
+        CHECK(DeserializeValue(isolate, data, offset).ToLocal(&value));
+        map->Set(isolate->GetCurrentContext(), key, value).ToLocalChecked();
+      }
+      result = map;
+      break;
+    }
+    case kSerializationTagSet: {
+      uint32_t length = data.Read<uint32_t>(offset);
+      Local<Set> set = Set::New(isolate);
+      for (uint32_t i = 0; i < length; ++i) {
+        Local<Value> key;
+        CHECK(DeserializeValue(isolate, data, offset).ToLocal(&key));
+        set->Add(isolate->GetCurrentContext(), key).ToLocalChecked();
+      }
+      result = set;
+      break;
+    }
     case kSerializationTagArrayBuffer: {
       int32_t byte_length = data.Read<int32_t>(offset);
       Local<ArrayBuffer> array_buffer = ArrayBuffer::New(isolate, byte_length);
@@ -2510,6 +2658,8 @@ int Shell::Main(int argc, char* argv[]) {
         bool last_run = i == options.stress_runs - 1;
         result = RunMain(isolate, argc, argv, last_run);
       }
+    } else if (options.load_threads > 0) {
+      result = RunLoad();
 #endif
     } else {
       bool last_run = true;
@@ -114,7 +114,11 @@ class SourceGroup {
 
   void End(int offset) { end_offset_ = offset; }
 
-  void Execute(Isolate* isolate);
+  int argument_count() const { return end_offset_ - begin_offset_; }
+
+  // If {sources} is given, it has one slot per argument of the group and
+  // caches the contents of the files, which are then read only once.
+  void Execute(Isolate* isolate, Global<String>* sources = NULL);
 
 #ifndef V8_SHARED
   void StartExecuteInThread();
@@ -164,6 +168,8 @@ enum SerializationTag {
   kSerializationTagArrayBuffer,
   kSerializationTagTransferredArrayBuffer,
   kSerializationTagTransferredSharedArrayBuffer,
+  kSerializationTagMap,
+  kSerializationTagSet,
 };
 
 
@@ -286,6 +292,8 @@ class ShellOptions {
         expected_to_throw(false),
         mock_arraybuffer_allocator(false),
         num_isolates(1),
+        load_threads(0),
+        load_duration_ms(1000),
         compile_options(v8::ScriptCompiler::kNoCompileOptions),
         isolate_sources(NULL),
         icu_data_file(NULL),
@@ -313,6 +321,10 @@ class ShellOptions {
   bool expected_to_throw;
   bool mock_arraybuffer_allocator;
   int num_isolates;
+  // With --load-threads=N, the first source group is run repeatedly in N
+  // isolates at once for --load-duration=ms and the runs/s are reported.
+  int load_threads;
+  int load_duration_ms;
   v8::ScriptCompiler::CompileOptions compile_options;
   SourceGroup* isolate_sources;
   const char* icu_data_file;
@@ -360,6 +372,7 @@ class Shell : public i::AllStatic {
                                             const SerializationData& data,
                                             int* offset);
   static void CleanupWorkers();
+  static int RunLoad();
   static int* LookupCounter(const char* name);
   static void* CreateHistogram(const char* name,
                                int min,
@@ -13,9 +13,8 @@ namespace v8 {
 namespace internal {
 
 template <typename Char>
-bool DateParser::Parse(Isolate* isolate, Vector<Char> str, FixedArray* out) {
+bool DateParser::Parse(Isolate* isolate, Vector<Char> str, double* out) {
   UnicodeCache* unicode_cache = isolate->unicode_cache();
-  DCHECK(out->length() >= OUTPUT_SIZE);
   InputReader<Char> in(unicode_cache, str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
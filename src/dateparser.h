@@ -15,7 +15,7 @@ namespace internal {
 class DateParser : public AllStatic {
  public:
   // Parse the string as a date. If parsing succeeds, return true after
-  // filling out the output array as follows (all integers are Smis):
+  // filling out the output array as follows (all integers are doubles):
   // [0]: year
   // [1]: month (0 = Jan, 1 = Feb, ...)
   // [2]: day
@@ -23,10 +23,10 @@ class DateParser : public AllStatic {
   // [4]: minute
   // [5]: second
   // [6]: millisecond
-  // [7]: UTC offset in seconds, or null value if no timezone specified
+  // [7]: UTC offset in seconds, or NaN if no timezone specified
   // If parsing fails, return false (content of output array is not defined).
   template <typename Char>
-  static bool Parse(Isolate* isolate, Vector<Char> str, FixedArray* output);
+  static bool Parse(Isolate* isolate, Vector<Char> str, double* output);
 
   enum {
     YEAR, MONTH, DAY, HOUR, MINUTE, SECOND, MILLISECOND, UTC_OFFSET, OUTPUT_SIZE
@@ -283,7 +283,7 @@ class DateParser : public AllStatic {
       return hour_ != kNone && minute_ == kNone && TimeComposer::IsMinute(n);
     }
     bool IsUTC() const { return hour_ == 0 && minute_ == 0; }
-    bool Write(FixedArray* output);
+    bool Write(double* output);
     bool IsEmpty() { return hour_ == kNone; }
    private:
     int sign_;
@@ -309,7 +309,7 @@ class DateParser : public AllStatic {
       return true;
     }
     void SetHourOffset(int n) { hour_offset_ = n; }
-    bool Write(FixedArray* output);
+    bool Write(double* output);
 
     static bool IsMinute(int x) { return Between(x, 0, 59); }
     static bool IsHour(int x) { return Between(x, 0, 23); }
@@ -338,7 +338,7 @@ class DateParser : public AllStatic {
       return false;
     }
     void SetNamedMonth(int n) { named_month_ = n; }
-    bool Write(FixedArray* output);
+    bool Write(double* output);
     void set_iso_date() { is_iso_date_ = true; }
     static bool IsMonth(int x) { return Between(x, 1, 12); }
     static bool IsDay(int x) { return Between(x, 1, 31); }
@@ -1305,13 +1305,14 @@ bool Debug::PrepareFunctionForBreakPoints(Handle<SharedFunctionInfo> shared) {
   List<Handle<JSFunction> > functions;
   List<Handle<JSGeneratorObject> > suspended_generators;
 
-  // Flush all optimized code maps. Note that the below heap iteration does not
-  // cover this, because the given function might have been inlined into code
-  // for which no JSFunction exists.
+  // Flush optimized code for or inlining the function from all optimized code
+  // maps. Note that the below heap iteration does not cover this, because the
+  // given function might have been inlined into code for which no JSFunction
+  // exists. Optimized code that does not contain the function stays cached.
   {
     SharedFunctionInfo::Iterator iterator(isolate_);
-    while (SharedFunctionInfo* shared = iterator.Next()) {
-      shared->ClearCodeFromOptimizedCodeMap();
+    while (SharedFunctionInfo* other = iterator.Next()) {
+      other->ClearCodeInliningFromOptimizedCodeMap(*shared);
     }
   }
 
@@ -248,8 +248,7 @@
     // nested functions serialized as parent followed by serialized children.
     var raw_compile_info = %LiveEditGatherCompileInfo(script, source);
 
-    // Sort function infos by start position field.
-    var compile_info = new GlobalArray();
+    var unsorted_info = new GlobalArray();
     var old_index_map = new GlobalArray();
     for (var i = 0; i < raw_compile_info.length; i++) {
       var info = new FunctionCompileInfo(raw_compile_info[i]);
@@ -258,25 +257,21 @@
       // particular script is a regular function.
       // For some functions we will restore this link later.
       %LiveEditFunctionSetScript(info.shared_function_info, UNDEFINED);
-      compile_info.push(info);
+      unsorted_info.push(info);
       old_index_map.push(i);
     }
 
-    for (var i = 0; i < compile_info.length; i++) {
-      var k = i;
-      for (var j = i + 1; j < compile_info.length; j++) {
-        if (compile_info[k].start_position > compile_info[j].start_position) {
-          k = j;
-        }
-      }
-      if (k != i) {
-        var temp_info = compile_info[k];
-        var temp_index = old_index_map[k];
-        compile_info[k] = compile_info[i];
-        old_index_map[k] = old_index_map[i];
-        compile_info[i] = temp_info;
-        old_index_map[i] = temp_index;
-      }
+    // Sort function infos by start position field. Large scripts have many
+    // thousands of functions, so this must not be quadratic. Ties keep the
+    // serialization order, in which a parent precedes its children.
+    old_index_map.sort(function(a, b) {
+      var delta = unsorted_info[a].start_position -
+          unsorted_info[b].start_position;
+      return delta != 0 ? delta : a - b;
+    });
+    var compile_info = new GlobalArray();
+    for (var i = 0; i < old_index_map.length; i++) {
+      compile_info.push(unsorted_info[old_index_map[i]]);
     }
 
     // After sorting update outer_index field using old_index_map. Also
@@ -799,21 +794,30 @@
   function FindLiveSharedInfos(old_code_tree, script) {
     var shared_raw_list = %LiveEditFindSharedFunctionInfosForScript(script);
 
-    var shared_infos = new GlobalArray();
+    // Index the shared infos by start position, so that looking them up for
+    // every node of the tree does not scan the whole list each time.
+    var shared_infos_by_start = new GlobalArray();
 
     for (var i = 0; i < shared_raw_list.length; i++) {
-      shared_infos.push(new SharedInfoWrapper(shared_raw_list[i]));
+      var wrapper = new SharedInfoWrapper(shared_raw_list[i]);
+      var bucket = shared_infos_by_start[wrapper.start_position];
+      if (!bucket) {
+        bucket = new GlobalArray();
+        shared_infos_by_start[wrapper.start_position] = bucket;
+      }
+      bucket.push(wrapper);
     }
 
     // Finds all SharedFunctionInfos that corresponds to compile info
     // in old version of the script.
     function FindFunctionInfos(compile_info) {
       var wrappers = [];
+      var bucket = shared_infos_by_start[compile_info.start_position];
+      if (!bucket) return;
 
-      for (var i = 0; i < shared_infos.length; i++) {
-        var wrapper = shared_infos[i];
-        if (wrapper.start_position == compile_info.start_position &&
-            wrapper.end_position == compile_info.end_position) {
+      for (var i = 0; i < bucket.length; i++) {
+        var wrapper = bucket[i];
+        if (wrapper.end_position == compile_info.end_position) {
           wrappers.push(wrapper);
         }
       }
@@ -2988,7 +2988,18 @@ Handle<JSArray> ElementsAccessor::Concat(Isolate* isolate, Arguments* args,
     bool is_holey = false;
     for (uint32_t i = 0; i < concat_size; i++) {
       Object* arg = (*args)[i];
-      ElementsKind arg_kind = JSArray::cast(arg)->GetElementsKind();
+      ElementsKind arg_kind;
+      if (arg->IsJSArray()) {
+        arg_kind = JSArray::cast(arg)->GetElementsKind();
+      } else {
+        arg_kind = arg->IsSmi() ? FAST_SMI_ELEMENTS
+                                : arg->IsHeapNumber() ? FAST_DOUBLE_ELEMENTS
+                                                      : FAST_ELEMENTS;
+        // Primitives are stored as they are, which never needs boxing.
+        result_elements_kind =
+            GetMoreGeneralElementsKind(result_elements_kind, arg_kind);
+        continue;
+      }
       has_raw_doubles = has_raw_doubles || IsFastDoubleElementsKind(arg_kind);
       is_holey = is_holey || IsFastHoleyElementsKind(arg_kind);
       result_elements_kind =
@@ -3015,9 +3026,20 @@ Handle<JSArray> ElementsAccessor::Concat(Isolate* isolate, Arguments* args,
   Handle<FixedArrayBase> storage(result_array->elements(), isolate);
   ElementsAccessor* accessor = ElementsAccessor::ForKind(result_elements_kind);
   for (uint32_t i = 0; i < concat_size; i++) {
+    Object* arg = (*args)[i];
+    if (!arg->IsJSArray()) {
+      DCHECK(!arg->IsJSReceiver());
+      if (IsFastDoubleElementsKind(result_elements_kind)) {
+        FixedDoubleArray::cast(*storage)->set(insertion_index, arg->Number());
+      } else {
+        FixedArray::cast(*storage)->set(insertion_index, arg);
+      }
+      insertion_index++;
+      continue;
+    }
     // It is crucial to keep |array| in a raw pointer form to avoid
     // performance degradation.
-    JSArray* array = JSArray::cast((*args)[i]);
+    JSArray* array = JSArray::cast(arg);
     uint32_t len = 0;
     array->length()->ToArrayLength(&len);
     if (len == 0) continue;
@@ -462,7 +462,16 @@ Object* StackGuard::HandleInterrupts() {
 
   if (CheckAndClearInterrupt(INSTALL_CODE)) {
     DCHECK(isolate_->concurrent_recompilation_enabled());
-    isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
+    OptimizingCompileDispatcher* dispatcher =
+        isolate_->optimizing_compile_dispatcher();
+    if (FLAG_concurrent_recompilation_install_budget > 0) {
+      // Spread the installation of many jobs over several interrupts.
+      dispatcher->InstallOptimizedFunctions(
+          isolate_->heap()->MonotonicallyIncreasingTimeInMs() +
+          FLAG_concurrent_recompilation_install_budget);
+    } else {
+      dispatcher->InstallOptimizedFunctions();
+    }
   }
 
   if (CheckAndClearInterrupt(API_INTERRUPT)) {
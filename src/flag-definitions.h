@@ -144,6 +144,11 @@ struct MaybeBoolFlag {
 #else
 # define ENABLE_NEON_DEFAULT false
 #endif
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+#define ENABLE_LOOP_SCHEDULING_DEFAULT true
+#else
+#define ENABLE_LOOP_SCHEDULING_DEFAULT false
+#endif
 #ifdef V8_OS_WIN
 # define ENABLE_LOG_COLOUR false
 #else
@@ -262,9 +267,15 @@ DEFINE_BOOL(compiled_keyed_generic_loads, false,
             "use optimizing compiler to generate keyed generic load stubs")
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(adaptive_allocation_site_pretenuring, false,
+            "tenure allocation sites with repeatedly high survival rates and "
+            "revisit don't-tenure decisions")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
+DEFINE_BOOL(scavenge_page_promotion, false,
+            "move new space pages below the age mark to old space during "
+            "scavenges if the promotion rate exceeds page_promotion_threshold")
 DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
@@ -304,6 +315,17 @@ DEFINE_BOOL(ignition_peephole, true, "use ignition peephole optimizer")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
+DEFINE_BOOL(ignition_elide_redundant_positions, false,
+            "don't record expression positions that repeat the previous "
+            "source position")
+DEFINE_IMPLICATION(optimize_for_size, ignition_elide_redundant_positions)
+DEFINE_BOOL(ignition_compact_registers, false,
+            "renumber temporary registers to remove unused frame slots")
+DEFINE_IMPLICATION(optimize_for_size, ignition_compact_registers)
+DEFINE_BOOL(ignition_skip_baseline, false,
+            "tier up hot interpreted functions that TurboFan can optimize "
+            "directly from their bytecode, without baseline code")
+DEFINE_IMPLICATION(ignition_skip_baseline, turbo_from_bytecode)
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(trace_ignition, false,
@@ -409,6 +431,14 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_INT(concurrent_recompilation_tasks, 0,
+           "the maximum number of concurrent compilation tasks "
+           "(0 for the number of available background threads)")
+DEFINE_INT(concurrent_recompilation_install_budget, 2,
+           "time budget in ms for installing optimized code per interrupt "
+           "(0 for no limit)")
+DEFINE_BOOL(concurrent_recompilation_idle_install, true,
+            "install optimized code during idle notifications")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
@@ -428,6 +458,10 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_INT(turbo_fast_regalloc_threshold, 20000,
+           "number of instructions above which live range splintering and "
+           "gap move optimization are skipped; the linear-scan allocator "
+           "itself is unchanged (0 to disable)")
 DEFINE_BOOL(turbo_loop_stackcheck, true, "enable stack checks in loops")
 DEFINE_STRING(turbo_filter, "~~", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
@@ -447,6 +481,9 @@ DEFINE_BOOL(turbo_verify, DEBUG_BOOL, "verify TurboFan graphs at each phase")
 DEFINE_BOOL(turbo_stats, false, "print TurboFan statistics")
 DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
+DEFINE_INT(turbo_zone_budget, 0,
+           "abandon TurboFan compile jobs whose zones allocate more than this "
+           "many MB (0 means unlimited)")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(turbo_type_feedback, false,
             "use typed feedback for representation inference in Turbofan")
@@ -459,6 +496,7 @@ DEFINE_BOOL(native_context_specialization, true,
             "enable native context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
 DEFINE_BOOL(loop_assignment_analysis, true, "perform loop assignment analysis")
 DEFINE_BOOL(turbo_profiling, false, "enable profiling in TurboFan")
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
@@ -467,6 +505,11 @@ DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_stress_loop_peeling, false,
             "stress loop peeling optimization")
+DEFINE_BOOL(turbo_loop_invariant_code_motion, false,
+            "hoist loop-invariant loads out of loops in TurboFan")
+DEFINE_BOOL(trace_turbo_vectorization, false,
+            "trace loops that are candidates for vectorization in TurboFan "
+            "(analysis only, no vector code is generated)")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_cache_shared_code, true, "cache context-independent code")
@@ -474,10 +517,14 @@ DEFINE_BOOL(turbo_preserve_shared_code, false, "keep context-independent code")
 DEFINE_BOOL(turbo_escape, false, "enable escape analysis")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(turbo_loop_instruction_scheduling, ENABLE_LOOP_SCHEDULING_DEFAULT,
+            "enable instruction scheduling of loop bodies in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_BOOL(turbo_store_elimination, false,
             "enable store-store elimination in TurboFan")
+DEFINE_BOOL(turbo_string_concat, false,
+            "fold string addition chains into a single runtime call")
 
 // Flags for native WebAssembly.
 DEFINE_BOOL(expose_wasm, false, "expose WASM interface to JavaScript")
@@ -496,6 +543,9 @@ DEFINE_BOOL(wasm_break_on_decoder_error, false,
             "debug break when wasm decoder encounters an error")
 DEFINE_BOOL(wasm_loop_assignment_analysis, true,
             "perform loop assignment analysis for WASM")
+DEFINE_BOOL(wasm_async_compilation, false,
+            "validate modules passed to WebAssembly.compile() on a background "
+            "thread")
 
 DEFINE_BOOL(validate_asm, false, "validate asm.js modules before compiling")
 DEFINE_BOOL(enable_simd_asmjs, false, "enable SIMD.js in asm.js stdlib")
@@ -672,6 +722,12 @@ DEFINE_BOOL(experimental_new_space_growth_heuristic, false,
 DEFINE_INT(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_INT(initial_old_space_size, 0, "initial old space size (in Mbytes)")
 DEFINE_INT(max_executable_size, 0, "max size of executable memory (in Mbytes)")
+DEFINE_BOOL(concurrent_array_buffer_freeing, true,
+            "free backing stores of dead array buffers found by the scavenger "
+            "on a background thread")
+DEFINE_BOOL(huge_pages, false,
+            "advise the OS to back the code range and large chunks with "
+            "transparent huge pages")
 DEFINE_BOOL(gc_global, false, "always perform global GCs")
 DEFINE_INT(gc_interval, -1, "garbage collect after <n> allocations")
 DEFINE_INT(retain_maps_for_n_gc, 2,
@@ -687,6 +743,9 @@ DEFINE_BOOL(trace_idle_notification, false,
             "print one trace line following each idle notification")
 DEFINE_BOOL(trace_idle_notification_verbose, false,
             "prints the heap state used by the idle notification")
+DEFINE_BOOL(idle_time_incremental_marking, true,
+            "start incremental marking in long idle periods when the old "
+            "generation is close to its allocation limit")
 DEFINE_BOOL(print_cumulative_gc_stat, false,
             "print cumulative GC statistics in name=value format on exit")
 DEFINE_BOOL(print_max_heap_committed, false,
@@ -707,6 +766,9 @@ DEFINE_BOOL(weak_embedded_maps_in_optimized_code, true,
 DEFINE_BOOL(weak_embedded_objects_in_optimized_code, true,
             "make objects embedded in optimized code weak")
 DEFINE_BOOL(flush_code, true, "flush code that we expect not to use again")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush bytecode of functions that have not run for several GCs")
+DEFINE_NEG_IMPLICATION(flush_bytecode, black_allocation)
 DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
@@ -722,6 +784,11 @@ DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_scavenge, false, "use parallel scavenge (experimental)")
+DEFINE_BOOL(young_generation_large_objects, false,
+            "allocate large objects in the young generation so that they "
+            "can die in a scavenge (experimental)")
+DEFINE_NEG_IMPLICATION(young_generation_large_objects, parallel_scavenge)
 DEFINE_BOOL(trace_incremental_marking, false,
             "trace progress of the incremental marking")
 DEFINE_BOOL(track_gc_object_stats, false,
@@ -743,6 +810,11 @@ DEFINE_BOOL(scavenge_reclaim_unmodified_objects, true,
             "remove unmodified and unreferenced objects")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_STRING(heap_growing_policy, "default",
+              "policy for growing the old generation (default, throughput)")
+DEFINE_FLOAT(heap_growing_target_gc_percent, 1.0,
+             "percentage of time the throughput heap growing policy targets "
+             "to spend in mark-compacts")
 
 // counters.cc
 DEFINE_INT(histogram_interval, 600000,
@@ -756,6 +828,11 @@ DEFINE_BOOL(trace_object_groups, false,
 DEFINE_BOOL(heap_profiler_trace_objects, false,
             "Dump heap object allocations/movements/size_updates")
 
+// allocation-tracker.cc
+DEFINE_BOOL(heap_profiler_aggregate_allocations, false,
+            "only aggregate tracked allocations per stack trace, without "
+            "attributing heap snapshot objects to their allocation traces")
+
 
 // sampling-heap-profiler.cc
 DEFINE_BOOL(sampling_heap_profiler_suppress_randomness, false,
@@ -886,6 +963,7 @@ DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sweeping)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compaction)
+DEFINE_NEG_IMPLICATION(predictable, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(predictable, memory_reducer)
 
 // mark-compact.cc
@@ -1110,6 +1188,7 @@ DEFINE_BOOL(print_unopt_code, false,
             "printing optimized code based on it")
 DEFINE_BOOL(print_code_verbose, false, "print more information for code")
 DEFINE_BOOL(print_builtin_code, false, "print generated code for builtins")
+DEFINE_BOOL(print_builtin_size, false, "print code size for builtins")
 
 #ifdef ENABLE_DISASSEMBLER
 DEFINE_BOOL(sodium, false,
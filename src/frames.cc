@@ -1691,6 +1691,7 @@ Code* InnerPointerToCodeCache::GcSafeFindCodeForInnerPointer(
   DCHECK_EQ(page->owner(), heap->code_space());
   heap->mark_compact_collector()->sweeper().SweepOrWaitUntilSweepingCompleted(
       page);
+  DCHECK(page->SweepingDone());
 
   Address addr = page->skip_list()->StartFor(inner_pointer);
 
@@ -1340,7 +1340,10 @@ void FullCodeGenerator::VisitTryCatchStatement(TryCatchStatement* stmt) {
   // Try block code. Sets up the exception handler chain.
   __ bind(&try_entry);
 
-  try_catch_depth_++;
+  // A catch block that keeps the pending message only rethrows, so it does
+  // not count towards the prediction that an exception is caught.
+  bool will_catch = stmt->clear_pending_message();
+  if (will_catch) try_catch_depth_++;
   int handler_index = NewHandlerTableEntry();
   EnterTryBlock(handler_index, &handler_entry);
   {
@@ -1348,7 +1351,7 @@ void FullCodeGenerator::VisitTryCatchStatement(TryCatchStatement* stmt) {
     Visit(stmt->try_block());
   }
   ExitTryBlock(handler_index);
-  try_catch_depth_--;
+  if (will_catch) try_catch_depth_--;
   __ bind(&exit);
 }
 
@@ -4,6 +4,7 @@
 
 #include "src/futex-emulation.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "src/base/macros.h"
@@ -16,25 +17,29 @@
 namespace v8 {
 namespace internal {
 
-base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
-    LAZY_INSTANCE_INITIALIZER;
+base::LazyInstance<FutexEmulation::WaitLists>::type
+    FutexEmulation::wait_lists_ = LAZY_INSTANCE_INITIALIZER;
 
 
 void FutexWaitListNode::NotifyWake() {
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable.
+  // Lock the mutex of the list this node waits in before notifying. We know
+  // that the mutex will have been unlocked if we are currently waiting on the
+  // condition variable.
   //
   // The mutex may also not be locked if the other thread is currently handling
   // interrupts, or if FutexEmulation::Wait was just called and the mutex
   // hasn't been locked yet. In either of those cases, we set the interrupted
   // flag to true, which will be tested after the mutex is re-locked.
-  base::LockGuard<base::Mutex> lock_guard(FutexEmulation::mutex_.Pointer());
+  //
+  // Wait queues the node before it sets waiting_, so if the node is not in
+  // any list yet, it is not waiting yet either.
+  FutexWaitList* wait_list = FutexEmulation::LockWaitList(this);
+  if (wait_list == nullptr) return;
   if (waiting_) {
     cond_.NotifyOne();
     interrupted_ = true;
   }
+  wait_list->mutex_.Unlock();
 }
 
 
@@ -51,6 +56,7 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
 
   node->prev_ = tail_;
   node->next_ = nullptr;
+  node->wait_list_.SetValue(this);
   tail_ = node;
 }
 
@@ -69,6 +75,28 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
   }
 
   node->prev_ = node->next_ = nullptr;
+  node->wait_list_.SetValue(nullptr);
+}
+
+
+FutexWaitList* FutexEmulation::GetWaitList(void* backing_store, size_t addr) {
+  // Waited-on addresses are 4-byte aligned, so drop the low bits.
+  uintptr_t key = (reinterpret_cast<uintptr_t>(backing_store) + addr) >> 2;
+  return &wait_lists_.Pointer()->lists[key % kNumWaitLists];
+}
+
+
+FutexWaitList* FutexEmulation::LockWaitList(FutexWaitListNode* node) {
+  FutexWaitList* wait_list = node->wait_list_.Value();
+  while (wait_list != nullptr) {
+    wait_list->mutex_.Lock();
+    FutexWaitList* current = node->wait_list_.Value();
+    if (current == wait_list) break;
+    // The node was requeued or removed before we got the lock.
+    wait_list->mutex_.Unlock();
+    wait_list = current;
+  }
+  return wait_list;
 }
 
 
@@ -81,9 +109,11 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   int32_t* p =
       reinterpret_cast<int32_t*>(static_cast<int8_t*>(backing_store) + addr);
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitList* wait_list = GetWaitList(backing_store, addr);
+  wait_list->mutex_.Lock();
 
   if (*p != value) {
+    wait_list->mutex_.Unlock();
     return Smi::FromInt(Result::kNotEqual);
   }
 
@@ -91,6 +121,11 @@ Object* FutexEmulation::Wait(Isolate* isolate,
 
   node->backing_store_ = backing_store;
   node->wait_addr_ = addr;
+  // Queue the node (which publishes its list with a release store) before
+  // setting waiting_. A NotifyWake that still sees no list therefore cannot
+  // have missed a waiting node, and one that sees the list blocks on its
+  // mutex until we wait and then sets interrupted_.
+  wait_list->AddNode(node);
   node->waiting_ = true;
 
   bool use_timeout = rel_timeout_ms != V8_INFINITY;
@@ -116,8 +151,6 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   base::TimeTicks timeout_time = start_time + rel_timeout;
   base::TimeTicks current_time = start_time;
 
-  wait_list_.Pointer()->AddNode(node);
-
   Object* result;
 
   while (true) {
@@ -125,18 +158,18 @@ Object* FutexEmulation::Wait(Isolate* isolate,
     node->interrupted_ = false;
 
     // Unlock the mutex here to prevent deadlock from lock ordering between
-    // mutex_ and mutexes locked by HandleInterrupts.
-    mutex_.Pointer()->Unlock();
+    // the wait list mutex and mutexes locked by HandleInterrupts.
+    wait_list->mutex_.Unlock();
 
     // Because the mutex is unlocked, we have to be careful about not dropping
     // an interrupt. The notification can happen in three different places:
     // 1) Before Wait is called: the notification will be dropped, but
     //    interrupted_ will be set to 1. This will be checked below.
-    // 2) After interrupted has been checked here, but before mutex_ is
-    //    acquired: interrupted is checked again below, with mutex_ locked.
-    //    Because the wakeup signal also acquires mutex_, we know it will not
-    //    be able to notify until mutex_ is released below, when waiting on the
-    //    condition variable.
+    // 2) After interrupted has been checked here, but before the mutex is
+    //    acquired: interrupted is checked again below, with the mutex locked.
+    //    Because the wakeup signal also acquires the mutex, we know it will
+    //    not be able to notify until the mutex is released below, when
+    //    waiting on the condition variable.
     // 3) After the mutex is released in the call to WaitFor(): this
     // notification will wake up the condition variable. node->waiting() will
     // be false, so we'll loop and then check interrupts.
@@ -144,15 +177,16 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       Object* interrupt_object = isolate->stack_guard()->HandleInterrupts();
       if (interrupt_object->IsException(isolate)) {
         result = interrupt_object;
-        mutex_.Pointer()->Lock();
+        wait_list = LockWaitList(node);
         break;
       }
     }
 
-    mutex_.Pointer()->Lock();
+    // The node may have been requeued to another list in the meantime.
+    wait_list = LockWaitList(node);
 
     if (node->interrupted_) {
-      // An interrupt occured while the mutex_ was unlocked. Don't wait yet.
+      // An interrupt occured while the mutex was unlocked. Don't wait yet.
       continue;
     }
 
@@ -172,17 +206,23 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       base::TimeDelta time_until_timeout = timeout_time - current_time;
       DCHECK(time_until_timeout.InMicroseconds() >= 0);
       bool wait_for_result =
-          node->cond_.WaitFor(mutex_.Pointer(), time_until_timeout);
+          node->cond_.WaitFor(&wait_list->mutex_, time_until_timeout);
       USE(wait_for_result);
     } else {
-      node->cond_.Wait(mutex_.Pointer());
+      node->cond_.Wait(&wait_list->mutex_);
     }
 
-    // Spurious wakeup, interrupt or timeout.
+    // Spurious wakeup, interrupt, timeout or requeue. If the node was moved
+    // to another list while we were waiting, switch to that list's mutex.
+    if (node->wait_list_.Value() != wait_list) {
+      wait_list->mutex_.Unlock();
+      wait_list = LockWaitList(node);
+    }
   }
 
-  wait_list_.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
   node->waiting_ = false;
+  wait_list->mutex_.Unlock();
 
   return result;
 }
@@ -196,8 +236,9 @@ Object* FutexEmulation::Wake(Isolate* isolate,
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitList* wait_list = GetWaitList(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+  FutexWaitListNode* node = wait_list->head_;
   while (node && num_waiters_to_wake > 0) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
       node->waiting_ = false;
@@ -224,29 +265,43 @@ Object* FutexEmulation::WakeOrRequeue(Isolate* isolate,
   int32_t* p =
       reinterpret_cast<int32_t*>(static_cast<int8_t*>(backing_store) + addr);
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
-  if (*p != value) {
-    return Smi::FromInt(Result::kNotEqual);
-  }
+  // Requeueing may move waiters to a different list, in which case both
+  // lists are locked, in address order to avoid deadlocks.
+  FutexWaitList* wait_list = GetWaitList(backing_store, addr);
+  FutexWaitList* wait_list2 = GetWaitList(backing_store, addr2);
+  FutexWaitList* first = std::min(wait_list, wait_list2);
+  FutexWaitList* second = std::max(wait_list, wait_list2);
+  base::LockGuard<base::Mutex> lock_guard(&first->mutex_);
+  if (second != first) second->mutex_.Lock();
 
-  // Wake |num_waiters_to_wake|
   int waiters_woken = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
-  while (node) {
-    if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
-      if (num_waiters_to_wake > 0) {
-        node->waiting_ = false;
-        node->cond_.NotifyOne();
-        --num_waiters_to_wake;
-        waiters_woken++;
-      } else {
-        node->wait_addr_ = addr2;
+  if (*p != value) {
+    waiters_woken = Result::kNotEqual;
+  } else {
+    // Wake |num_waiters_to_wake|
+    FutexWaitListNode* node = wait_list->head_;
+    while (node) {
+      FutexWaitListNode* next = node->next_;
+      if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
+        if (num_waiters_to_wake > 0) {
+          node->waiting_ = false;
+          node->cond_.NotifyOne();
+          --num_waiters_to_wake;
+          waiters_woken++;
+        } else {
+          node->wait_addr_ = addr2;
+          if (wait_list2 != wait_list) {
+            wait_list->RemoveNode(node);
+            wait_list2->AddNode(node);
+          }
+        }
       }
-    }
 
-    node = node->next_;
+      node = next;
+    }
   }
 
+  if (second != first) second->mutex_.Unlock();
   return Smi::FromInt(waiters_woken);
 }
 
@@ -257,10 +312,11 @@ Object* FutexEmulation::NumWaitersForTesting(Isolate* isolate,
   DCHECK(addr < NumberToSize(isolate, array_buffer->byte_length()));
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitList* wait_list = GetWaitList(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
 
   int waiters = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitListNode* node = wait_list->head_;
   while (node) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
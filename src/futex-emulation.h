@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include "src/allocation.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
@@ -34,11 +35,14 @@ namespace internal {
 class Isolate;
 class JSArrayBuffer;
 
+class FutexWaitList;
+
 class FutexWaitListNode {
  public:
   FutexWaitListNode()
       : prev_(nullptr),
         next_(nullptr),
+        wait_list_(nullptr),
         backing_store_(nullptr),
         wait_addr_(0),
         waiting_(false),
@@ -53,6 +57,11 @@ class FutexWaitListNode {
   base::ConditionVariable cond_;
   FutexWaitListNode* prev_;
   FutexWaitListNode* next_;
+  // The list this node is queued in, or nullptr. It only changes while the
+  // mutex of that list is held, and WakeOrRequeue may move the node to
+  // another list, so a thread that wants to lock the node's list has to
+  // re-check it after acquiring the mutex (see FutexEmulation::LockWaitList).
+  base::AtomicValue<FutexWaitList*> wait_list_;
   void* backing_store_;
   size_t wait_addr_;
   bool waiting_;
@@ -71,7 +80,9 @@ class FutexWaitList {
 
  private:
   friend class FutexEmulation;
+  friend class FutexWaitListNode;
 
+  base::Mutex mutex_;
   FutexWaitListNode* head_;
   FutexWaitListNode* tail_;
 
@@ -122,8 +133,22 @@ class FutexEmulation : public AllStatic {
  private:
   friend class FutexWaitListNode;
 
-  static base::LazyMutex mutex_;
-  static base::LazyInstance<FutexWaitList>::type wait_list_;
+  // Waiters are spread over several lists by address, each with its own
+  // mutex, so that threads waiting on and waking unrelated addresses do not
+  // contend on a single lock.
+  static const int kNumWaitLists = 64;
+
+  struct WaitLists {
+    FutexWaitList lists[kNumWaitLists];
+  };
+
+  static FutexWaitList* GetWaitList(void* backing_store, size_t addr);
+
+  // Locks and returns the list |node| is currently queued in, or returns
+  // nullptr if it is not queued.
+  static FutexWaitList* LockWaitList(FutexWaitListNode* node);
+
+  static base::LazyInstance<WaitLists>::type wait_lists_;
 };
 }  // namespace internal
 }  // namespace v8
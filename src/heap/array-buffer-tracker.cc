@@ -5,6 +5,7 @@
 #include "src/heap/array-buffer-tracker.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/heap.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -35,7 +36,8 @@ void LocalArrayBufferTracker::Free() {
 }
 
 template <typename Callback>
-void LocalArrayBufferTracker::Process(Callback callback) {
+void LocalArrayBufferTracker::Process(Callback callback,
+                                      ArrayBufferFreer* freer) {
   JSArrayBuffer* new_buffer = nullptr;
   size_t freed_memory = 0;
   for (TrackingMap::iterator it = array_buffers_.begin();
@@ -59,8 +61,12 @@ void LocalArrayBufferTracker::Process(Callback callback) {
       if (target_page->InNewSpace()) target_page->mutex()->Unlock();
       it = array_buffers_.erase(it);
     } else if (result == kRemoveEntry) {
-      heap_->isolate()->array_buffer_allocator()->Free(it->second.first,
-                                                       it->second.second);
+      if (freer != nullptr) {
+        freer->Add(it->second);
+      } else {
+        heap_->isolate()->array_buffer_allocator()->Free(it->second.first,
+                                                         it->second.second);
+      }
       freed_memory += it->second.second;
       it = array_buffers_.erase(it);
     } else {
@@ -75,12 +81,16 @@ void LocalArrayBufferTracker::Process(Callback callback) {
 
 void ArrayBufferTracker::FreeDeadInNewSpace(Heap* heap) {
   DCHECK_EQ(heap->gc_state(), Heap::HeapState::SCAVENGE);
+  ArrayBufferFreer* freer = FLAG_concurrent_array_buffer_freeing
+                                ? heap->array_buffer_freer()
+                                : nullptr;
   for (Page* page : NewSpacePageRange(heap->new_space()->FromSpaceStart(),
                                       heap->new_space()->FromSpaceEnd())) {
-    bool empty = ProcessBuffers(page, kUpdateForwardedRemoveOthers);
+    bool empty = ProcessBuffers(page, kUpdateForwardedRemoveOthers, freer);
     CHECK(empty);
   }
   heap->account_external_memory_concurrently_freed();
+  if (freer != nullptr) freer->FreeConcurrently();
 }
 
 void ArrayBufferTracker::FreeDead(Page* page) {
@@ -103,7 +113,8 @@ void ArrayBufferTracker::FreeAll(Page* page) {
   }
 }
 
-bool ArrayBufferTracker::ProcessBuffers(Page* page, ProcessingMode mode) {
+bool ArrayBufferTracker::ProcessBuffers(Page* page, ProcessingMode mode,
+                                        ArrayBufferFreer* freer) {
   LocalArrayBufferTracker* tracker = page->local_tracker();
   if (tracker == nullptr) return true;
 
@@ -118,7 +129,8 @@ bool ArrayBufferTracker::ProcessBuffers(Page* page, ProcessingMode mode) {
         return mode == kUpdateForwardedKeepOthers
                    ? LocalArrayBufferTracker::kKeepEntry
                    : LocalArrayBufferTracker::kRemoveEntry;
-      });
+      },
+      freer);
   return tracker->IsEmpty();
 }
 
@@ -132,5 +144,46 @@ bool ArrayBufferTracker::IsTracked(JSArrayBuffer* buffer) {
   }
 }
 
+class ArrayBufferFreer::FreeBackingStoresTask : public v8::Task {
+ public:
+  FreeBackingStoresTask(ArrayBufferFreer* freer,
+                        v8::ArrayBuffer::Allocator* allocator,
+                        std::vector<LocalArrayBufferTracker::Value>* stores)
+      : freer_(freer), allocator_(allocator) {
+    backing_stores_.swap(*stores);
+  }
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    for (const LocalArrayBufferTracker::Value& store : backing_stores_) {
+      allocator_->Free(store.first, store.second);
+    }
+    freer_->pending_freeing_tasks_semaphore_.Signal();
+  }
+
+  ArrayBufferFreer* freer_;
+  v8::ArrayBuffer::Allocator* allocator_;
+  std::vector<LocalArrayBufferTracker::Value> backing_stores_;
+  DISALLOW_COPY_AND_ASSIGN(FreeBackingStoresTask);
+};
+
+void ArrayBufferFreer::FreeConcurrently() {
+  if (backing_stores_.empty()) return;
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new FreeBackingStoresTask(this,
+                                heap_->isolate()->array_buffer_allocator(),
+                                &backing_stores_),
+      v8::Platform::kShortRunningTask);
+  concurrent_freeing_tasks_active_++;
+}
+
+void ArrayBufferFreer::WaitUntilCompleted() {
+  while (concurrent_freeing_tasks_active_ > 0) {
+    pending_freeing_tasks_semaphore_.Wait();
+    concurrent_freeing_tasks_active_--;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,14 +6,17 @@
 #define V8_HEAP_ARRAY_BUFFER_TRACKER_H_
 
 #include <unordered_map>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
 #include "src/globals.h"
 
 namespace v8 {
 namespace internal {
 
+class ArrayBufferFreer;
 class Heap;
 class JSArrayBuffer;
 class Page;
@@ -34,7 +37,9 @@ class ArrayBufferTracker : public AllStatic {
   inline static void Unregister(Heap* heap, JSArrayBuffer* buffer);
 
   // Frees all backing store pointers for dead JSArrayBuffers in new space.
-  // Does not take any locks and can only be called during Scavenge.
+  // Does not take any locks and can only be called during Scavenge. With
+  // --concurrent-array-buffer-freeing the backing stores are released on a
+  // background thread.
   static void FreeDeadInNewSpace(Heap* heap);
 
   // Frees all backing store pointers for dead JSArrayBuffer on a given page.
@@ -47,8 +52,11 @@ class ArrayBufferTracker : public AllStatic {
   static void FreeAll(Page* page);
 
   // Processes all array buffers on a given page. |mode| specifies the action
-  // to perform on the buffers. Returns whether the tracker is empty or not.
-  static bool ProcessBuffers(Page* page, ProcessingMode mode);
+  // to perform on the buffers. Backing stores of removed buffers are added to
+  // |freer| if present, or freed right away otherwise. Returns whether the
+  // tracker is empty or not.
+  static bool ProcessBuffers(Page* page, ProcessingMode mode,
+                             ArrayBufferFreer* freer = nullptr);
 
   // Returns whether a buffer is currently tracked.
   static bool IsTracked(JSArrayBuffer* buffer);
@@ -76,12 +84,13 @@ class LocalArrayBufferTracker {
   void Free();
 
   // Processes buffers one by one. The CallbackResult of the callback decides
-  // what action to take on the buffer.
+  // what action to take on the buffer. Backing stores of removed buffers are
+  // handed to |freer| if present.
   //
   // Callback should be of type:
   //   CallbackResult fn(JSArrayBuffer* buffer, JSArrayBuffer** new_buffer);
   template <typename Callback>
-  inline void Process(Callback callback);
+  inline void Process(Callback callback, ArrayBufferFreer* freer);
 
   bool IsEmpty() { return array_buffers_.empty(); }
 
@@ -96,6 +105,38 @@ class LocalArrayBufferTracker {
   TrackingMap array_buffers_;
 };
 
+// ArrayBufferFreer collects backing stores of dead array buffers and releases
+// them in batches on a background thread, keeping calls into the
+// ArrayBuffer::Allocator off the main thread.
+class ArrayBufferFreer {
+ public:
+  explicit ArrayBufferFreer(Heap* heap)
+      : heap_(heap),
+        pending_freeing_tasks_semaphore_(0),
+        concurrent_freeing_tasks_active_(0) {}
+
+  void Add(const LocalArrayBufferTracker::Value& backing_store) {
+    backing_stores_.push_back(backing_store);
+  }
+
+  // Posts a task that frees all backing stores added so far.
+  void FreeConcurrently();
+
+  // Blocks until all posted tasks are done. Needs to be called before the
+  // isolate is torn down.
+  void WaitUntilCompleted();
+
+ private:
+  class FreeBackingStoresTask;
+
+  Heap* heap_;
+  std::vector<LocalArrayBufferTracker::Value> backing_stores_;
+  base::Semaphore pending_freeing_tasks_semaphore_;
+  int concurrent_freeing_tasks_active_;
+
+  DISALLOW_COPY_AND_ASSIGN(ArrayBufferFreer);
+};
+
 }  // namespace internal
 }  // namespace v8
 #endif  // V8_HEAP_ARRAY_BUFFER_TRACKER_H_
@@ -43,6 +43,7 @@ void GCIdleTimeHeapState::Print() {
   PrintF("contexts_disposal_rate=%f ", contexts_disposal_rate);
   PrintF("size_of_objects=%" PRIuS " ", size_of_objects);
   PrintF("incremental_marking_stopped=%d ", incremental_marking_stopped);
+  PrintF("can_start_incremental_marking=%d ", can_start_incremental_marking);
 }
 
 size_t GCIdleTimeHandler::EstimateMarkingStepSize(
@@ -119,6 +120,8 @@ GCIdleTimeAction GCIdleTimeHandler::NothingOrDone(double idle_time_in_ms) {
 // request, we finalize sweeping here.
 // (5) If incremental marking is in progress, we perform a marking step. Note,
 // that this currently may trigger a full garbage collection.
+// (6) If incremental marking is stopped, the heap asks for it to be started,
+// and we got a long idle period, we start marking and perform a step.
 GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
                                             GCIdleTimeHeapState heap_state) {
   if (static_cast<int>(idle_time_in_ms) <= 0) {
@@ -139,7 +142,15 @@ GCIdleTimeAction GCIdleTimeHandler::Compute(double idle_time_in_ms,
     return NothingOrDone(idle_time_in_ms);
   }
 
-  if (!FLAG_incremental_marking || heap_state.incremental_marking_stopped) {
+  if (!FLAG_incremental_marking) {
+    return GCIdleTimeAction::Done();
+  }
+
+  if (heap_state.incremental_marking_stopped) {
+    if (heap_state.can_start_incremental_marking &&
+        idle_time_in_ms >= kMinIdleTimeToStartIncrementalMarking) {
+      return GCIdleTimeAction::IncrementalStep();
+    }
     return GCIdleTimeAction::Done();
   }
 
@@ -63,6 +63,7 @@ class GCIdleTimeHeapState {
   double contexts_disposal_rate;
   size_t size_of_objects;
   bool incremental_marking_stopped;
+  bool can_start_incremental_marking;
 };
 
 
@@ -103,6 +104,11 @@ class GCIdleTimeHandler {
 
   static const int kMinBackgroundIdleTime = 900;
 
+  // Incremental marking is only started in idle time if we got at least this
+  // much idle time, i.e. when there is currently no rendering going on.
+  static const size_t kMinIdleTimeToStartIncrementalMarking =
+      kMaxScheduledIdleTime;
+
   // An allocation throughput below kLowAllocationThroughput bytes/ms is
   // considered low
   static const size_t kLowAllocationThroughput = 1000;
@@ -294,6 +294,8 @@ void GCTracer::Stop(GarbageCollector collector) {
     combined_mark_compact_speed_cache_ = 0.0;
   }
 
+  RecordPhaseHistograms();
+
   // TODO(ernstm): move the code below out of GCTracer.
 
   double spent_in_mutator = Max(current_.start_time - previous_.end_time, 0.0);
@@ -323,6 +325,28 @@ void GCTracer::Stop(GarbageCollector collector) {
 }
 
 
+void GCTracer::RecordPhaseHistograms() const {
+  Counters* counters = heap_->isolate()->counters();
+#define ADD_PHASE_SAMPLE(histogram, scope) \
+  counters->histogram()->AddSample(        \
+      static_cast<int>(current_.scopes[Scope::scope] * 1000));
+  if (current_.type == Event::SCAVENGER) {
+    ADD_PHASE_SAMPLE(gc_scavenger_old_to_new_pointers,
+                     SCAVENGER_OLD_TO_NEW_POINTERS)
+    ADD_PHASE_SAMPLE(gc_scavenger_roots, SCAVENGER_ROOTS)
+    ADD_PHASE_SAMPLE(gc_scavenger_semispace, SCAVENGER_SEMISPACE)
+    ADD_PHASE_SAMPLE(gc_scavenger_weak, SCAVENGER_WEAK)
+  } else {
+    ADD_PHASE_SAMPLE(gc_mark_compactor_clear, MC_CLEAR)
+    ADD_PHASE_SAMPLE(gc_mark_compactor_evacuate, MC_EVACUATE)
+    ADD_PHASE_SAMPLE(gc_mark_compactor_finish, MC_FINISH)
+    ADD_PHASE_SAMPLE(gc_mark_compactor_mark, MC_MARK)
+    ADD_PHASE_SAMPLE(gc_mark_compactor_sweep, MC_SWEEP)
+  }
+#undef ADD_PHASE_SAMPLE
+}
+
+
 void GCTracer::SampleAllocation(double current_ms,
                                 size_t new_space_counter_bytes,
                                 size_t old_generation_counter_bytes) {
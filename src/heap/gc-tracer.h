@@ -375,6 +375,10 @@ class GCTracer {
   void ResetForTesting();
 
  private:
+  // Report the phase times of the current event to the embedder through the
+  // GC phase histograms in counters.h.
+  void RecordPhaseHistograms() const;
+
   // Print one detailed trace line in name=value format.
   // TODO(ernstm): Move to Heap.
   void PrintNVP() const;
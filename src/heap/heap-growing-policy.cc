@@ -0,0 +1,62 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap-growing-policy.h"
+
+#include <cstring>
+
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+const double ThroughputHeapGrowingPolicy::kMaxGrowingFactor = 8.0;
+
+// static
+HeapGrowingPolicy* HeapGrowingPolicy::New() {
+  if (strcmp(FLAG_heap_growing_policy, "throughput") == 0) {
+    return new ThroughputHeapGrowingPolicy(
+        FLAG_heap_growing_target_gc_percent / 100.0);
+  }
+  if (strcmp(FLAG_heap_growing_policy, "default") != 0) {
+    PrintF("Unknown heap growing policy '%s', using default.\n",
+           FLAG_heap_growing_policy);
+  }
+  return new DefaultHeapGrowingPolicy();
+}
+
+// static
+double HeapGrowingPolicy::FactorForMutatorUtilization(
+    double gc_speed, double mutator_speed, double mutator_utilization,
+    double min_factor, double max_factor) {
+  if (gc_speed == 0 || mutator_speed == 0) return max_factor;
+
+  const double speed_ratio = gc_speed / mutator_speed;
+  const double mu = mutator_utilization;
+
+  const double a = speed_ratio * (1 - mu);
+  const double b = speed_ratio * (1 - mu) - mu;
+
+  // The factor is a / b, but we need to check for small b first.
+  double factor = (a < b * max_factor) ? a / b : max_factor;
+  factor = Min(factor, max_factor);
+  factor = Max(factor, min_factor);
+  return factor;
+}
+
+double DefaultHeapGrowingPolicy::GrowingFactor(double gc_speed,
+                                               double mutator_speed) const {
+  return Heap::HeapGrowingFactor(gc_speed, mutator_speed);
+}
+
+double ThroughputHeapGrowingPolicy::GrowingFactor(double gc_speed,
+                                                  double mutator_speed) const {
+  return FactorForMutatorUtilization(gc_speed, mutator_speed,
+                                     1 - target_gc_fraction_,
+                                     Heap::kMinHeapGrowingFactor,
+                                     kMaxGrowingFactor);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,80 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_HEAP_GROWING_POLICY_H_
+#define V8_HEAP_HEAP_GROWING_POLICY_H_
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// A heap growing policy decides by which factor the old generation may grow
+// after a mark-compact before the next mark-compact is started. The heap
+// feeds it with the mark-compact speed and the old generation allocation
+// throughput measured by the GCTracer.
+class HeapGrowingPolicy {
+ public:
+  virtual ~HeapGrowingPolicy() {}
+
+  // Creates the policy selected by --heap-growing-policy.
+  static HeapGrowingPolicy* New();
+
+  virtual const char* name() const = 0;
+
+  // Returns the heap growing factor for the given GC speed and mutator speed,
+  // both in bytes per ms.
+  virtual double GrowingFactor(double gc_speed, double mutator_speed) const = 0;
+
+  // Returns true if the heap may further limit the factor on memory
+  // constrained devices and when the memory reducer is active.
+  virtual bool LimitsGrowthForMemory() const = 0;
+
+  // Returns the factor that achieves the given mutator utilization if the GC
+  // speed and the mutator speed remain the same until the next GC, clamped to
+  // [min_factor, max_factor]. See Heap::HeapGrowingFactor for the derivation.
+  static double FactorForMutatorUtilization(double gc_speed,
+                                            double mutator_speed,
+                                            double mutator_utilization,
+                                            double min_factor,
+                                            double max_factor);
+};
+
+// Targets a mutator utilization of Heap::kTargetMutatorUtilization and keeps
+// the heap small on memory constrained devices.
+class DefaultHeapGrowingPolicy final : public HeapGrowingPolicy {
+ public:
+  DefaultHeapGrowingPolicy() {}
+
+  const char* name() const override { return "default"; }
+  double GrowingFactor(double gc_speed, double mutator_speed) const override;
+  bool LimitsGrowthForMemory() const override { return true; }
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(DefaultHeapGrowingPolicy);
+};
+
+// Trades memory for fewer full GCs on machines with plenty of memory. Targets
+// spending at most the given fraction of time in mark-compacts.
+class ThroughputHeapGrowingPolicy final : public HeapGrowingPolicy {
+ public:
+  static const double kMaxGrowingFactor;
+
+  explicit ThroughputHeapGrowingPolicy(double target_gc_fraction)
+      : target_gc_fraction_(target_gc_fraction) {}
+
+  const char* name() const override { return "throughput"; }
+  double GrowingFactor(double gc_speed, double mutator_speed) const override;
+  bool LimitsGrowthForMemory() const override { return false; }
+
+ private:
+  const double target_gc_fraction_;
+
+  DISALLOW_COPY_AND_ASSIGN(ThroughputHeapGrowingPolicy);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_HEAP_GROWING_POLICY_H_
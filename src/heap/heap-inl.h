@@ -213,7 +213,20 @@ AllocationResult Heap::AllocateRaw(int size_in_bytes, AllocationSpace space,
   HeapObject* object = nullptr;
   AllocationResult allocation;
   if (NEW_SPACE == space) {
-    if (large_object) {
+    if (large_object && FLAG_young_generation_large_objects) {
+      // Young large objects are bounded by the new space capacity, so that
+      // they trigger a scavenge like regular new space allocations do.
+      intptr_t young_size = lo_space_->SizeOfYoungObjects();
+      if (young_size > 0 &&
+          young_size + size_in_bytes > new_space_.Capacity()) {
+        return AllocationResult::Retry(NEW_SPACE);
+      }
+      allocation = lo_space_->AllocateRawInYoungGeneration(size_in_bytes);
+      if (allocation.To(&object)) {
+        OnAllocationEvent(object, size_in_bytes);
+      }
+      return allocation;
+    } else if (large_object) {
       space = LO_SPACE;
     } else {
       allocation = new_space_.AllocateRaw(size_in_bytes, alignment);
@@ -503,11 +516,16 @@ bool Heap::PurgeLeftTrimmedObject(Object** object) {
 
 template <Heap::FindMementoMode mode>
 AllocationMemento* Heap::FindAllocationMemento(HeapObject* object) {
+  return FindAllocationMemento<mode>(object, object->map());
+}
+
+template <Heap::FindMementoMode mode>
+AllocationMemento* Heap::FindAllocationMemento(HeapObject* object, Map* map) {
   // Check if there is potentially a memento behind the object. If
   // the last word of the memento is on another page we return
   // immediately.
   Address object_address = object->address();
-  Address memento_address = object_address + object->Size();
+  Address memento_address = object_address + object->SizeFromMap(map);
   Address last_memento_word_address = memento_address + kPointerSize;
   if (!Page::OnSamePage(object_address, last_memento_word_address)) {
     return nullptr;
@@ -552,11 +570,18 @@ AllocationMemento* Heap::FindAllocationMemento(HeapObject* object) {
 template <Heap::UpdateAllocationSiteMode mode>
 void Heap::UpdateAllocationSite(HeapObject* object,
                                 base::HashMap* pretenuring_feedback) {
+  UpdateAllocationSite<mode>(object->map(), object, pretenuring_feedback);
+}
+
+template <Heap::UpdateAllocationSiteMode mode>
+void Heap::UpdateAllocationSite(Map* map, HeapObject* object,
+                                base::HashMap* pretenuring_feedback) {
   DCHECK(InFromSpace(object));
   if (!FLAG_allocation_site_pretenuring ||
-      !AllocationSite::CanTrack(object->map()->instance_type()))
+      !AllocationSite::CanTrack(map->instance_type()))
     return;
-  AllocationMemento* memento_candidate = FindAllocationMemento<kForGC>(object);
+  AllocationMemento* memento_candidate =
+      FindAllocationMemento<kForGC>(object, map);
   if (memento_candidate == nullptr) return;
 
   if (mode == kGlobal) {
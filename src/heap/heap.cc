@@ -20,6 +20,7 @@
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
+#include "src/heap/heap-growing-policy.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
@@ -78,6 +79,7 @@ Heap::Heap()
       max_semi_space_size_(8 * (kPointerSize / 4) * MB),
       initial_semispace_size_(Page::kPageSize),
       max_old_generation_size_(700ul * (kPointerSize / 4) * MB),
+      initial_max_old_generation_size_(max_old_generation_size_),
       initial_old_generation_size_(max_old_generation_size_ /
                                    kInitalOldGenerationLimitFactor),
       old_generation_size_configured_(false),
@@ -140,6 +142,8 @@ Heap::Heap()
       incremental_marking_(nullptr),
       gc_idle_time_handler_(nullptr),
       memory_reducer_(nullptr),
+      heap_growing_policy_(nullptr),
+      array_buffer_freer_(nullptr),
       object_stats_(nullptr),
       scavenge_job_(nullptr),
       idle_scavenge_observer_(nullptr),
@@ -573,6 +577,7 @@ void Heap::ProcessPretenuringFeedback() {
         allocation_mementos_found += found_count;
         if (site->DigestPretenuringFeedback(maximum_size_scavenge)) {
           trigger_deoptimization = true;
+          isolate_->counters()->allocation_sites_tenured()->Increment();
         }
         if (site->GetPretenureMode() == TENURED) {
           tenure_decisions++;
@@ -1244,6 +1249,10 @@ void Heap::UpdateSurvivalStatistics(int start_new_space_size) {
 
   double survival_rate = promotion_ratio_ + semi_space_copied_rate_;
   tracer()->AddSurvivalRatio(survival_rate);
+  isolate()->counters()->gc_new_space_promotion_ratio()->AddSample(
+      static_cast<int>(promotion_ratio_));
+  isolate()->counters()->gc_new_space_survival_ratio()->AddSample(
+      static_cast<int>(survival_rate));
   if (survival_rate > kYoungSurvivalRateHighThreshold) {
     high_survival_rate_period_length_++;
   } else {
@@ -1459,6 +1468,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  RegExpResultsCache::Clear(regexp_replace_cache());
 
   isolate_->compilation_cache()->MarkCompactPrologue();
 
@@ -1627,6 +1637,14 @@ void Heap::Scavenge() {
 
   scavenge_collector_->SelectScavengingVisitorsTable();
 
+  base::SmartPointer<ParallelScavenger> parallel_scavenger;
+  if (scavenge_collector_->CanScavengeInParallel()) {
+    parallel_scavenger.Reset(new ParallelScavenger(
+        this,
+        scavenge_collector_->NumberOfParallelScavengeTasks(new_space_.Size()),
+        scavenge_collector_->parallel_scavenge_semaphore()));
+  }
+
   if (UsingEmbedderHeapTracer()) {
     // Register found wrappers with embedder so it can add them to its marking
     // deque and correctly manage the case when v8 scavenger collects the
@@ -1638,6 +1656,7 @@ void Heap::Scavenge() {
   // live objects.
   new_space_.Flip();
   new_space_.ResetAllocationInfo();
+  lo_space_->FlipYoungObjects();
 
   // We need to sweep newly copied objects which can be either in the
   // to space or promoted to the old generation.  For to-space
@@ -1660,13 +1679,33 @@ void Heap::Scavenge() {
   promotion_queue_.Initialize();
 
   PromotionMode promotion_mode = CurrentPromotionMode();
-  ScavengeVisitor scavenge_visitor(this);
+  ScavengeVisitor serial_scavenge_visitor(this);
+  ObjectVisitor& scavenge_visitor =
+      parallel_scavenger.is_empty()
+          ? static_cast<ObjectVisitor&>(serial_scavenge_visitor)
+          : *parallel_scavenger->main_thread_visitor();
+  // Processes all objects copied so far, either by Cheney's algorithm or in
+  // parallel.
+  auto process_copied_objects = [&]() {
+    if (parallel_scavenger.is_empty()) {
+      new_space_front =
+          DoScavenge(&scavenge_visitor, new_space_front, promotion_mode);
+    } else {
+      parallel_scavenger->Process();
+      new_space_front = new_space_.top();
+    }
+  };
 
   if (FLAG_scavenge_reclaim_unmodified_objects) {
     isolate()->global_handles()->IdentifyWeakUnmodifiedObjects(
         &IsUnmodifiedHeapObject);
   }
 
+  bool pages_promoted = false;
+  if (parallel_scavenger.is_empty() && ShouldPromoteNewSpacePagesInScavenge()) {
+    pages_promoted = PromoteNewSpacePagesInScavenge();
+  }
+
   {
     // Copy roots.
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
@@ -1676,21 +1715,25 @@ void Heap::Scavenge() {
   {
     // Copy objects reachable from the old generation.
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
-    RememberedSet<OLD_TO_NEW>::Iterate(this, [this](Address addr) {
-      return Scavenger::CheckAndScavengeObject(this, addr);
-    });
-
-    RememberedSet<OLD_TO_NEW>::IterateTyped(
-        this, [this](SlotType type, Address host_addr, Address addr) {
-          return UpdateTypedSlotHelper::UpdateTypedSlot(
-              isolate(), type, addr, [this](Object** addr) {
-                // We expect that objects referenced by code are long living.
-                // If we do not force promotion, then we need to clear
-                // old_to_new slots in dead code objects after mark-compact.
-                return Scavenger::CheckAndScavengeObject(
-                    this, reinterpret_cast<Address>(addr));
-              });
-        });
+    if (!parallel_scavenger.is_empty()) {
+      parallel_scavenger->ScavengeOldToNewSlots();
+    } else {
+      RememberedSet<OLD_TO_NEW>::Iterate(this, [this](Address addr) {
+        return Scavenger::CheckAndScavengeObject(this, addr);
+      });
+
+      RememberedSet<OLD_TO_NEW>::IterateTyped(
+          this, [this](SlotType type, Address host_addr, Address addr) {
+            return UpdateTypedSlotHelper::UpdateTypedSlot(
+                isolate(), type, addr, [this](Object** addr) {
+                  // We expect that objects referenced by code are long living.
+                  // If we do not force promotion, then we need to clear
+                  // old_to_new slots in dead code objects after mark-compact.
+                  return Scavenger::CheckAndScavengeObject(
+                      this, reinterpret_cast<Address>(addr));
+                });
+          });
+    }
   }
 
   {
@@ -1712,8 +1755,7 @@ void Heap::Scavenge() {
 
   {
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_SEMISPACE);
-    new_space_front =
-        DoScavenge(&scavenge_visitor, new_space_front, promotion_mode);
+    process_copied_objects();
   }
 
   if (FLAG_scavenge_reclaim_unmodified_objects) {
@@ -1722,14 +1764,12 @@ void Heap::Scavenge() {
 
     isolate()->global_handles()->IterateNewSpaceWeakUnmodifiedRoots(
         &scavenge_visitor);
-    new_space_front =
-        DoScavenge(&scavenge_visitor, new_space_front, promotion_mode);
+    process_copied_objects();
   } else {
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OBJECT_GROUPS);
     while (isolate()->global_handles()->IterateObjectGroups(
         &scavenge_visitor, &IsUnscavengedHeapObject)) {
-      new_space_front =
-          DoScavenge(&scavenge_visitor, new_space_front, promotion_mode);
+      process_copied_objects();
     }
     isolate()->global_handles()->RemoveObjectGroups();
     isolate()->global_handles()->RemoveImplicitRefGroups();
@@ -1739,8 +1779,12 @@ void Heap::Scavenge() {
 
     isolate()->global_handles()->IterateNewSpaceWeakIndependentRoots(
         &scavenge_visitor);
-    new_space_front =
-        DoScavenge(&scavenge_visitor, new_space_front, promotion_mode);
+    process_copied_objects();
+  }
+
+  if (!parallel_scavenger.is_empty()) {
+    parallel_scavenger->Finalize();
+    new_space_front = new_space_.top();
   }
 
   UpdateNewSpaceReferencesInExternalStringTable(
@@ -1760,6 +1804,14 @@ void Heap::Scavenge() {
 
   ArrayBufferTracker::FreeDeadInNewSpace(this);
 
+  // Replace the from space pages that were moved to old space.
+  if (pages_promoted && !new_space_.Rebalance()) {
+    FatalProcessOutOfMemory("NewSpace::Rebalance");
+  }
+
+  // Young large objects that were not promoted are dead.
+  lo_space_->FreeDeadYoungObjects();
+
   // Update how much has survived scavenge.
   IncrementYoungSurvivorsCounter(static_cast<int>(
       (PromotedSpaceSizeOfObjects() - survived_watermark) + new_space_.Size()));
@@ -1770,8 +1822,62 @@ void Heap::Scavenge() {
 }
 
 
+bool Heap::ShouldPromoteNewSpacePagesInScavenge() {
+  // The scavenger has no mark bits to compute the live bytes of a page.
+  // Instead, the promotion rate of the last scavenge, i.e., the percentage of
+  // survivors that survived again, is used to predict how much of the area
+  // below the age mark is still alive.
+  return FLAG_scavenge_page_promotion && incremental_marking()->IsStopped() &&
+         promotion_rate_ >= FLAG_page_promotion_threshold;
+}
+
+
+bool Heap::PromoteNewSpacePagesInScavenge() {
+  DCHECK(incremental_marking()->IsStopped());
+  Page* age_mark_page = Page::FromAllocationAreaAddress(new_space_.age_mark());
+  List<Page*> pages;
+  for (Page* page : NewSpacePageRange(new_space_.FromSpaceStart(),
+                                      new_space_.FromSpaceEnd())) {
+    if (page == age_mark_page) break;
+    DCHECK(page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK));
+    pages.Add(page);
+  }
+  if (pages.is_empty()) return false;
+
+  for (int i = 0; i < pages.length(); i++) {
+    Page* page = pages[i];
+    page->Unlink();
+    Page::ConvertNewToOld(page, old_space());
+    // The page is not swept before the next mark-compact, so account for its
+    // whole area as allocated.
+    old_space()->Allocate(page->area_size());
+  }
+
+  // Pointers are only visited after all pages have been moved, so that
+  // references between moved pages are not treated as from space pointers.
+  for (int i = 0; i < pages.length(); i++) {
+    Page* page = pages[i];
+    Address current = page->area_start();
+    while (current < page->area_end()) {
+      HeapObject* object = HeapObject::FromAddress(current);
+      int size = object->Size();
+      if (!object->IsFiller()) {
+        IteratePromotedObject(object, size, false, &Scavenger::ScavengeObject);
+        IncrementPromotedObjectsSize(size);
+      }
+      current += size;
+    }
+  }
+  return true;
+}
+
+
 String* Heap::UpdateNewSpaceReferenceInExternalStringTableEntry(Heap* heap,
                                                                 Object** p) {
+  // Young large objects are promoted in place, see
+  // Scavenger::PromoteLargeObject.
+  if (!heap->InFromSpace(*p)) return String::cast(*p);
+
   MapWord first_word = HeapObject::cast(*p)->map_word();
 
   if (!first_word.IsForwardingAddress()) {
@@ -1867,6 +1973,7 @@ void Heap::ResetAllAllocationSitesDependentCode(PretenureFlag flag) {
       casted->ResetPretenureDecision();
       casted->set_deopt_dependent_code(true);
       marked = true;
+      isolate_->counters()->allocation_sites_tenure_reset()->Increment();
       RemoveAllocationSitePretenuringFeedback(casted);
     }
     cur = casted->weak_next();
@@ -2767,11 +2874,13 @@ void Heap::CreateInitialObjects() {
   set_single_character_string_cache(
       *factory->NewFixedArray(String::kMaxOneByteCharCode + 1, TENURED));
 
-  // Allocate cache for string split and regexp-multiple.
+  // Allocate cache for string split, regexp-multiple and regexp-replace.
   set_string_split_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
+  set_regexp_replace_cache(*factory->NewFixedArray(
+      RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
 
   // Allocate cache for external strings pointing to native source code.
   set_natives_source_cache(
@@ -3079,6 +3188,7 @@ AllocationResult Heap::AllocateBytecodeArray(int length,
   instance->set_frame_size(frame_size);
   instance->set_parameter_count(parameter_count);
   instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
+  instance->ResetAge();
   instance->set_constant_pool(constant_pool);
   instance->set_handler_table(empty_fixed_array());
   instance->set_source_position_table(empty_byte_array());
@@ -3255,6 +3365,8 @@ void Heap::RightTrimFixedArray(FixedArrayBase* object, int elements_to_trim) {
   // of the object changed significantly.
   if (!lo_space()->Contains(object)) {
     CreateFillerObjectAt(new_end, bytes_to_trim, ClearRecordedSlots::kYes);
+  } else if (InNewSpace(object)) {
+    lo_space()->ShrinkYoungObject(bytes_to_trim);
   }
 
   // Initialize header of the trimmed array. We are storing the new length
@@ -3421,6 +3533,7 @@ AllocationResult Heap::CopyBytecodeArray(BytecodeArray* bytecode_array) {
   copy->set_handler_table(bytecode_array->handler_table());
   copy->set_source_position_table(bytecode_array->source_position_table());
   copy->set_interrupt_budget(bytecode_array->interrupt_budget());
+  copy->ResetAge();
   bytecode_array->CopyBytecodesTo(copy);
   return copy;
 }
@@ -4243,10 +4356,28 @@ GCIdleTimeHeapState Heap::ComputeHeapState() {
       tracer()->ContextDisposalRateInMilliseconds();
   heap_state.size_of_objects = static_cast<size_t>(SizeOfObjects());
   heap_state.incremental_marking_stopped = incremental_marking()->IsStopped();
+  heap_state.can_start_incremental_marking =
+      FLAG_idle_time_incremental_marking &&
+      heap_state.incremental_marking_stopped &&
+      incremental_marking()->CanBeActivated() &&
+      ShouldStartIdleTimeIncrementalMarking();
   return heap_state;
 }
 
 
+bool Heap::ShouldStartIdleTimeIncrementalMarking() {
+  // Start marking once the old generation has used up half of the headroom
+  // that was granted at the last mark-compact, so that a long idle period can
+  // absorb most of the marking work before the allocation limit is hit.
+  intptr_t size_at_last_gc =
+      static_cast<intptr_t>(old_generation_size_at_last_gc_);
+  intptr_t headroom = old_generation_allocation_limit_ - size_at_last_gc;
+  if (headroom <= 0) return true;
+  intptr_t growth = PromotedSpaceSizeOfObjects() - size_at_last_gc;
+  return growth >= headroom / 2;
+}
+
+
 bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
                                  GCIdleTimeHeapState heap_state,
                                  double deadline_in_ms) {
@@ -4256,6 +4387,11 @@ bool Heap::PerformIdleTimeAction(GCIdleTimeAction action,
       result = true;
       break;
     case DO_INCREMENTAL_STEP: {
+      if (incremental_marking()->IsStopped()) {
+        DCHECK(heap_state.can_start_incremental_marking);
+        StartIncrementalMarking(kNoGCFlags, kNoGCCallbackFlags,
+                                "idle notification: start marking");
+      }
       if (incremental_marking()->incremental_marking_job()->IdleTaskPending()) {
         result = true;
       } else {
@@ -4447,6 +4583,10 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
   MemoryPressureLevel previous = memory_pressure_level_.Value();
   memory_pressure_level_.SetValue(level);
+  if (level != MemoryPressureLevel::kNone) {
+    // Zone segments kept for reuse are not needed to make progress.
+    isolate()->allocator()->ReleasePooledSegments();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -4939,6 +5079,7 @@ bool Heap::ConfigureHeap(int max_semi_space_size, int max_old_space_size,
   max_old_generation_size_ =
       Max(static_cast<intptr_t>(paged_space_count * Page::kPageSize),
           max_old_generation_size_);
+  initial_max_old_generation_size_ = max_old_generation_size_;
 
   // The max executable size must be less than or equal to the max old
   // generation size.
@@ -5038,7 +5179,8 @@ void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
 
 intptr_t Heap::PromotedSpaceSizeOfObjects() {
   return old_space_->SizeOfObjects() + code_space_->SizeOfObjects() +
-         map_space_->SizeOfObjects() + lo_space_->SizeOfObjects();
+         map_space_->SizeOfObjects() + lo_space_->SizeOfObjects() -
+         lo_space_->SizeOfYoungObjects();
 }
 
 
@@ -5095,20 +5237,9 @@ const double Heap::kTargetMutatorUtilization = 0.97;
 //   F * (R * (1 - MU) - MU) / (R * (1 - MU)) = 1
 //   F = R * (1 - MU) / (R * (1 - MU) - MU)
 double Heap::HeapGrowingFactor(double gc_speed, double mutator_speed) {
-  if (gc_speed == 0 || mutator_speed == 0) return kMaxHeapGrowingFactor;
-
-  const double speed_ratio = gc_speed / mutator_speed;
-  const double mu = kTargetMutatorUtilization;
-
-  const double a = speed_ratio * (1 - mu);
-  const double b = speed_ratio * (1 - mu) - mu;
-
-  // The factor is a / b, but we need to check for small b first.
-  double factor =
-      (a < b * kMaxHeapGrowingFactor) ? a / b : kMaxHeapGrowingFactor;
-  factor = Min(factor, kMaxHeapGrowingFactor);
-  factor = Max(factor, kMinHeapGrowingFactor);
-  return factor;
+  return HeapGrowingPolicy::FactorForMutatorUtilization(
+      gc_speed, mutator_speed, kTargetMutatorUtilization,
+      kMinHeapGrowingFactor, kMaxHeapGrowingFactor);
 }
 
 
@@ -5129,24 +5260,30 @@ void Heap::SetOldGenerationAllocationLimit(intptr_t old_gen_size,
                                            double mutator_speed) {
   const double kConservativeHeapGrowingFactor = 1.3;
 
-  double factor = HeapGrowingFactor(gc_speed, mutator_speed);
+  double factor = heap_growing_policy_->GrowingFactor(gc_speed, mutator_speed);
 
   if (FLAG_trace_gc_verbose) {
     PrintIsolate(isolate_,
-                 "Heap growing factor %.1f based on mu=%.3f, speed_ratio=%.f "
+                 "Heap growing factor %.1f based on %s policy, speed_ratio=%.f "
                  "(gc=%.f, mutator=%.f)\n",
-                 factor, kTargetMutatorUtilization, gc_speed / mutator_speed,
-                 gc_speed, mutator_speed);
+                 factor, heap_growing_policy_->name(),
+                 gc_speed / mutator_speed, gc_speed, mutator_speed);
   }
 
-  // We set the old generation growing factor to 2 to grow the heap slower on
-  // memory-constrained devices.
-  if (max_old_generation_size_ <= kMaxOldSpaceSizeMediumMemoryDevice ||
-      FLAG_optimize_for_size) {
-    factor = Min(factor, kMaxHeapGrowingFactorMemoryConstrained);
+  if (heap_growing_policy_->LimitsGrowthForMemory()) {
+    // We set the old generation growing factor to 2 to grow the heap slower
+    // on memory-constrained devices.
+    if (max_old_generation_size_ <= kMaxOldSpaceSizeMediumMemoryDevice ||
+        FLAG_optimize_for_size) {
+      factor = Min(factor, kMaxHeapGrowingFactorMemoryConstrained);
+    }
+
+    if (memory_reducer_->ShouldGrowHeapSlowly()) {
+      factor = Min(factor, kConservativeHeapGrowingFactor);
+    }
   }
 
-  if (memory_reducer_->ShouldGrowHeapSlowly() || optimize_for_memory_usage_) {
+  if (optimize_for_memory_usage_) {
     factor = Min(factor, kConservativeHeapGrowingFactor);
   }
 
@@ -5173,7 +5310,7 @@ void Heap::SetOldGenerationAllocationLimit(intptr_t old_gen_size,
 void Heap::DampenOldGenerationAllocationLimit(intptr_t old_gen_size,
                                               double gc_speed,
                                               double mutator_speed) {
-  double factor = HeapGrowingFactor(gc_speed, mutator_speed);
+  double factor = heap_growing_policy_->GrowingFactor(gc_speed, mutator_speed);
   intptr_t limit = CalculateOldGenerationAllocationLimit(factor, old_gen_size);
   if (limit < old_generation_allocation_limit_) {
     if (FLAG_trace_gc_verbose) {
@@ -5306,6 +5443,9 @@ bool Heap::SetUp() {
   gc_idle_time_handler_ = new GCIdleTimeHandler();
 
   memory_reducer_ = new MemoryReducer(this);
+  heap_growing_policy_ = HeapGrowingPolicy::New();
+
+  array_buffer_freer_ = new ArrayBufferFreer(this);
 
   object_stats_ = new ObjectStats(this);
   object_stats_->ClearObjectStats(true);
@@ -5406,6 +5546,12 @@ void Heap::TearDown() {
 
   UpdateMaximumCommitted();
 
+  if (array_buffer_freer_ != nullptr) {
+    array_buffer_freer_->WaitUntilCompleted();
+    delete array_buffer_freer_;
+    array_buffer_freer_ = nullptr;
+  }
+
   if (FLAG_print_cumulative_gc_stat) {
     PrintF("\n");
     PrintF("gc_count=%d ", gc_count_);
@@ -5460,6 +5606,9 @@ void Heap::TearDown() {
   delete gc_idle_time_handler_;
   gc_idle_time_handler_ = nullptr;
 
+  delete heap_growing_policy_;
+  heap_growing_policy_ = nullptr;
+
   if (memory_reducer_ != nullptr) {
     memory_reducer_->TearDown();
     delete memory_reducer_;
@@ -5539,6 +5688,48 @@ void Heap::RemoveGCPrologueCallback(v8::Isolate::GCCallback callback) {
 }
 
 
+void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                    void* data) {
+  DCHECK(callback != NULL);
+  near_heap_limit_callbacks_.Add(NearHeapLimitCallbackPair(callback, data));
+}
+
+
+void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                       size_t heap_limit) {
+  DCHECK(callback != NULL);
+  for (int i = 0; i < near_heap_limit_callbacks_.length(); ++i) {
+    if (near_heap_limit_callbacks_[i].callback == callback) {
+      near_heap_limit_callbacks_.Remove(i);
+      if (heap_limit != 0) {
+        // Never go below what is already in use, or the next allocation in
+        // the old generation would fail right away.
+        intptr_t limit = Max(static_cast<intptr_t>(heap_limit),
+                             OldGenerationCapacity() + Page::kPageSize);
+        max_old_generation_size_ = Min(max_old_generation_size_,
+                                       RoundUp(limit, Page::kPageSize));
+      }
+      return;
+    }
+  }
+  UNREACHABLE();
+}
+
+
+bool Heap::InvokeNearHeapLimitCallback() {
+  if (near_heap_limit_callbacks_.is_empty()) return false;
+  const NearHeapLimitCallbackPair& pair = near_heap_limit_callbacks_.last();
+  size_t heap_limit =
+      pair.callback(pair.data, static_cast<size_t>(max_old_generation_size_),
+                    static_cast<size_t>(initial_max_old_generation_size_));
+  if (heap_limit <= static_cast<size_t>(max_old_generation_size_)) {
+    return false;
+  }
+  max_old_generation_size_ = static_cast<intptr_t>(heap_limit);
+  return true;
+}
+
+
 void Heap::AddGCEpilogueCallback(v8::Isolate::GCCallback callback,
                                  GCType gc_type, bool pass_isolate) {
   DCHECK(callback != NULL);
@@ -175,6 +175,7 @@ using v8::MemoryPressureLevel;
   V(FixedArray, single_character_string_cache, SingleCharacterStringCache)     \
   V(FixedArray, string_split_cache, StringSplitCache)                          \
   V(FixedArray, regexp_multiple_cache, RegExpMultipleCache)                    \
+  V(FixedArray, regexp_replace_cache, RegExpReplaceCache)                      \
   V(Object, instanceof_cache_function, InstanceofCacheFunction)                \
   V(Object, instanceof_cache_map, InstanceofCacheMap)                          \
   V(Object, instanceof_cache_answer, InstanceofCacheAnswer)                    \
@@ -308,11 +309,13 @@ using v8::MemoryPressureLevel;
 
 // Forward declarations.
 class AllocationObserver;
+class ArrayBufferFreer;
 class ArrayBufferTracker;
 class GCIdleTimeAction;
 class GCIdleTimeHandler;
 class GCIdleTimeHeapState;
 class GCTracer;
+class HeapGrowingPolicy;
 class HeapObjectsFilter;
 class HeapStats;
 class HistogramTimer;
@@ -756,6 +759,12 @@ class Heap {
   template <FindMementoMode mode>
   inline AllocationMemento* FindAllocationMemento(HeapObject* object);
 
+  // Same as above, but takes the map of {object} explicitly. Used when the map
+  // word of {object} may be concurrently replaced by a forwarding address.
+  template <FindMementoMode mode>
+  inline AllocationMemento* FindAllocationMemento(HeapObject* object,
+                                                  Map* map);
+
   // Returns false if not able to reserve.
   bool ReserveSpace(Reservation* reservations);
 
@@ -968,6 +977,8 @@ class Heap {
 
   MemoryAllocator* memory_allocator() { return memory_allocator_; }
 
+  ArrayBufferFreer* array_buffer_freer() { return array_buffer_freer_; }
+
   PromotionQueue* promotion_queue() { return &promotion_queue_; }
 
   inline Isolate* isolate();
@@ -1365,6 +1376,15 @@ class Heap {
                              GCType gc_type_filter, bool pass_isolate = true);
   void RemoveGCEpilogueCallback(v8::Isolate::GCCallback callback);
 
+  void AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                void* data);
+  void RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
+                                   size_t heap_limit);
+
+  // Gives the most recently added near-heap-limit callback a chance to raise
+  // the old generation limit. Returns true if the limit was raised.
+  bool InvokeNearHeapLimitCallback();
+
   void CallGCPrologueCallbacks(GCType gc_type, GCCallbackFlags flags);
   void CallGCEpilogueCallbacks(GCType gc_type, GCCallbackFlags flags);
 
@@ -1404,6 +1424,11 @@ class Heap {
   inline void UpdateAllocationSite(HeapObject* object,
                                    base::HashMap* pretenuring_feedback);
 
+  // Same as above, but takes the map of {object} explicitly.
+  template <UpdateAllocationSiteMode mode>
+  inline void UpdateAllocationSite(Map* map, HeapObject* object,
+                                   base::HashMap* pretenuring_feedback);
+
   // Removes an entry from the global pretenuring storage.
   inline void RemoveAllocationSitePretenuringFeedback(AllocationSite* site);
 
@@ -1510,6 +1535,14 @@ class Heap {
     bool pass_isolate;
   };
 
+  struct NearHeapLimitCallbackPair {
+    NearHeapLimitCallbackPair(v8::NearHeapLimitCallback callback, void* data)
+        : callback(callback), data(data) {}
+
+    v8::NearHeapLimitCallback callback;
+    void* data;
+  };
+
   typedef String* (*ExternalStringTableUpdaterCallback)(Heap* heap,
                                                         Object** pointer);
 
@@ -1667,6 +1700,10 @@ class Heap {
 
   GCIdleTimeHeapState ComputeHeapState();
 
+  // Returns true if the old generation grew enough since the last
+  // mark-compact for idle time to be spent on starting incremental marking.
+  bool ShouldStartIdleTimeIncrementalMarking();
+
   bool PerformIdleTimeAction(GCIdleTimeAction action,
                              GCIdleTimeHeapState heap_state,
                              double deadline_in_ms);
@@ -1731,6 +1768,16 @@ class Heap {
   Address DoScavenge(ObjectVisitor* scavenge_visitor, Address new_space_front,
                      PromotionMode promotion_mode);
 
+  // Returns whether the scavenger should move whole new space pages below the
+  // age mark to old space instead of copying their objects.
+  bool ShouldPromoteNewSpacePagesInScavenge();
+
+  // Moves all from space pages below the age mark to old space and scavenges
+  // the pointers of the objects on them. All objects on those pages are
+  // treated as live until the next mark-compact. Returns whether any page
+  // was moved.
+  bool PromoteNewSpacePagesInScavenge();
+
   void UpdateNewSpaceReferencesInExternalStringTable(
       ExternalStringTableUpdaterCallback updater_func);
 
@@ -2035,6 +2082,9 @@ class Heap {
   int max_semi_space_size_;
   int initial_semispace_size_;
   intptr_t max_old_generation_size_;
+  // The limit configured at setup, before any near-heap-limit callback
+  // raised it.
+  intptr_t initial_max_old_generation_size_;
   intptr_t initial_old_generation_size_;
   bool old_generation_size_configured_;
   intptr_t max_executable_size_;
@@ -2135,6 +2185,8 @@ class Heap {
   List<GCCallbackPair> gc_epilogue_callbacks_;
   List<GCCallbackPair> gc_prologue_callbacks_;
 
+  List<NearHeapLimitCallbackPair> near_heap_limit_callbacks_;
+
   // Total RegExp code ever generated
   double total_regexp_code_generated_;
 
@@ -2197,6 +2249,10 @@ class Heap {
 
   MemoryReducer* memory_reducer_;
 
+  HeapGrowingPolicy* heap_growing_policy_;
+
+  ArrayBufferFreer* array_buffer_freer_;
+
   ObjectStats* object_stats_;
 
   ScavengeJob* scavenge_job_;
@@ -366,7 +366,11 @@ void IncrementalMarking::DeactivateIncrementalWriteBarrier() {
   DeactivateIncrementalWriteBarrierForSpace(heap_->new_space());
 
   for (LargePage* lop : *heap_->lo_space()) {
-    SetOldSpacePageFlags(lop, false, false);
+    if (lop->InNewSpace()) {
+      SetNewSpacePageFlags(lop, false);
+    } else {
+      SetOldSpacePageFlags(lop, false, false);
+    }
   }
 }
 
@@ -392,7 +396,11 @@ void IncrementalMarking::ActivateIncrementalWriteBarrier() {
   ActivateIncrementalWriteBarrier(heap_->new_space());
 
   for (LargePage* lop : *heap_->lo_space()) {
-    SetOldSpacePageFlags(lop, true, is_compacting_);
+    if (lop->InNewSpace()) {
+      SetNewSpacePageFlags(lop, true);
+    } else {
+      SetOldSpacePageFlags(lop, true, is_compacting_);
+    }
   }
 }
 
@@ -541,7 +549,7 @@ void IncrementalMarking::StartMarking() {
   PatchIncrementalMarkingRecordWriteStubs(heap_, mode);
 
   heap_->mark_compact_collector()->EnsureMarkingDequeIsCommittedAndInitialize(
-      MarkCompactCollector::kMaxMarkingDequeSize);
+      heap_->mark_compact_collector()->MarkingDequeSizeForHeap());
 
   ActivateIncrementalWriteBarrier();
 
@@ -1173,6 +1181,10 @@ intptr_t IncrementalMarking::Step(intptr_t allocated_bytes,
     intptr_t bytes_to_process =
         marking_speed_ *
         Max(allocated_, write_barriers_invoked_since_last_step_);
+    if (marking == DO_NOT_FORCE_MARKING) {
+      // Forced steps are sized by their callers, e.g. to fit into idle time.
+      bytes_to_process = Max(bytes_to_process, StepSizeToMakeProgress());
+    }
     allocated_ = 0;
     write_barriers_invoked_since_last_step_ = 0;
 
@@ -1234,6 +1246,22 @@ int64_t IncrementalMarking::SpaceLeftInOldSpace() {
 }
 
 
+intptr_t IncrementalMarking::StepSizeToMakeProgress() {
+  intptr_t step_size = static_cast<intptr_t>(
+      old_generation_space_used_at_start_of_incremental_ / kTargetStepCount);
+  double marking_speed_in_bytes_per_ms =
+      heap_->tracer()->IncrementalMarkingSpeedInBytesPerMillisecond();
+  if (marking_speed_in_bytes_per_ms > 0) {
+    // Do not let a single step exceed kMaxStepSizeInMs.
+    step_size = Min(step_size, static_cast<intptr_t>(
+                                   GCIdleTimeHandler::EstimateMarkingStepSize(
+                                       kMaxStepSizeInMs,
+                                       marking_speed_in_bytes_per_ms)));
+  }
+  return Max(step_size, kMinStepSizeInBytes);
+}
+
+
 bool IncrementalMarking::IsIdleMarkingDelayCounterLimitReached() {
   return idle_marking_delay_counter_ > kMaxIdleMarkingDelayCounter;
 }
@@ -133,6 +133,15 @@ class IncrementalMarking {
   static const intptr_t kMarkingSpeedAccelleration = 2;
   static const intptr_t kMaxMarkingSpeed = 1000;
 
+  // Independently of the allocation rate, allocation-driven steps mark at
+  // least 1/kTargetStepCount of the old generation live at the start of
+  // marking, so that marking finishes within that many steps even if the
+  // mutator allocates faster than the marker would otherwise keep up with.
+  static const intptr_t kTargetStepCount = 128;
+  static const intptr_t kMinStepSizeInBytes = 64 * KB;
+  // Upper bound for the duration of such a step.
+  static const int kMaxStepSizeInMs = 1;
+
   // This is the upper bound for how many times we allow finalization of
   // incremental marking to be postponed.
   static const size_t kMaxIdleMarkingDelayCounter = 3;
@@ -185,7 +194,7 @@ class IncrementalMarking {
     SetOldSpacePageFlags(chunk, IsMarking(), IsCompacting());
   }
 
-  inline void SetNewSpacePageFlags(Page* chunk) {
+  inline void SetNewSpacePageFlags(MemoryChunk* chunk) {
     SetNewSpacePageFlags(chunk, IsMarking());
   }
 
@@ -235,6 +244,10 @@ class IncrementalMarking {
 
   int64_t SpaceLeftInOldSpace();
 
+  // Returns the number of bytes a step has to mark to make progress
+  // independently of the allocation rate. See kTargetStepCount.
+  intptr_t StepSizeToMakeProgress();
+
   void SpeedUp();
 
   void ResetStepCounters();
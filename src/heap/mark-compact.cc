@@ -61,6 +61,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       have_code_to_deoptimize_(false),
       marking_deque_memory_(NULL),
       marking_deque_memory_committed_(0),
+      scanned_weak_collections_(Smi::FromInt(0)),
       code_flusher_(nullptr),
       embedder_heap_tracer_(nullptr),
       sweeper_(heap) {
@@ -878,6 +879,10 @@ void MarkCompactCollector::Prepare() {
   }
   heap()->account_external_memory_concurrently_freed();
 
+  if (FLAG_young_generation_large_objects) {
+    PromoteYoungLargeObjects();
+  }
+
 #ifdef VERIFY_HEAP
   if (!was_marked_incrementally_ && FLAG_verify_heap) {
     VerifyMarkbitsAreClean();
@@ -1045,6 +1050,77 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
 }
 
 
+namespace {
+
+// Resets the bytecode age of all functions that are currently executing in
+// the interpreter.
+class BytecodeAgeResettingVisitor : public ThreadVisitor {
+ public:
+  void VisitThread(Isolate* isolate, ThreadLocalTop* top) override {
+    for (StackFrameIterator it(isolate, top); !it.done(); it.Advance()) {
+      if (!it.frame()->is_interpreted()) continue;
+      reinterpret_cast<InterpretedFrame*>(it.frame())
+          ->GetBytecodeArray()
+          ->ResetAge();
+    }
+  }
+};
+
+}  // namespace
+
+
+void CodeFlusher::ProcessBytecodeCandidates() {
+  if (bytecode_candidates_.is_empty()) return;
+
+  BytecodeAgeResettingVisitor visitor;
+  visitor.VisitThread(isolate_, isolate_->thread_local_top());
+  isolate_->thread_manager()->IterateArchivedThreads(&visitor);
+
+  Builtins* builtins = isolate_->builtins();
+  Code* lazy_compile = builtins->builtin(Builtins::kCompileLazy);
+  Code* trampoline = builtins->builtin(Builtins::kInterpreterEntryTrampoline);
+  MarkingParity parity =
+      isolate_->heap()->mark_compact_collector()->marking_parity();
+
+  for (int i = 0; i < bytecode_candidates_.length(); i++) {
+    SharedFunctionInfo* candidate = bytecode_candidates_[i];
+
+    // Candidates left over from an aborted incremental marking might have
+    // died in the meantime.
+    if (Marking::IsWhite(Marking::MarkBitFrom(candidate))) continue;
+
+    // The function might have been tiered up or instrumented since it was
+    // added as a candidate.
+    if (!candidate->HasBytecodeArray() || candidate->code() != trampoline ||
+        candidate->HasDebugInfo()) {
+      continue;
+    }
+    BytecodeArray* bytecode = candidate->bytecode_array();
+    bytecode->MakeOlder(parity);
+    if (!bytecode->IsOld()) continue;
+
+    if (FLAG_trace_code_flushing) {
+      PrintF("[code-flushing clears bytecode: ");
+      candidate->ShortPrint();
+      PrintF(" - size: %d]\n", bytecode->SizeIncludingMetadata());
+    }
+    // Always flush the optimized code map if there is one.
+    if (!candidate->OptimizedCodeMapIsCleared()) {
+      candidate->ClearOptimizedCodeMap();
+    }
+    candidate->set_code(lazy_compile);
+    candidate->ClearBytecodeArray();
+
+    Object** code_slot =
+        HeapObject::RawField(candidate, SharedFunctionInfo::kCodeOffset);
+    isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, code_slot,
+                                                           *code_slot);
+  }
+
+  bytecode_candidates_.Clear();
+}
+
+
 void CodeFlusher::EvictCandidate(SharedFunctionInfo* shared_info) {
   // Make sure previous flushing decisions are revisited.
   isolate_->heap()->incremental_marking()->IterateBlackObject(shared_info);
@@ -1628,6 +1704,20 @@ class RecordMigratedSlotVisitor final : public ObjectVisitor {
   MarkCompactCollector* collector_;
 };
 
+void MarkCompactCollector::PromoteYoungLargeObjects() {
+  // The new space pointer updating after evacuation only visits new space
+  // pages. Young large objects are therefore promoted up front and their
+  // slots are recorded like the ones of migrated objects.
+  RecordMigratedSlotVisitor record_visitor(this);
+  for (LargePage* page : *heap()->lo_space()) {
+    if (!page->InNewSpace()) continue;
+    heap()->lo_space()->PromoteYoungObject(page);
+    HeapObject* object = page->GetObject();
+    object->IterateBody(object->map()->instance_type(), object->Size(),
+                        &record_visitor);
+  }
+}
+
 class MarkCompactCollector::HeapObjectVisitor {
  public:
   virtual ~HeapObjectVisitor() {}
@@ -1636,12 +1726,25 @@ class MarkCompactCollector::HeapObjectVisitor {
 
 class MarkCompactCollector::EvacuateVisitorBase
     : public MarkCompactCollector::HeapObjectVisitor {
+ public:
+  // Flushes the instruction cache for code objects that were moved since the
+  // last call.
+  void FlushMovedCode() {
+    if (moved_code_start_ != moved_code_end_) {
+      Assembler::FlushICache(heap_->isolate(), moved_code_start_,
+                             moved_code_end_ - moved_code_start_);
+    }
+    moved_code_start_ = moved_code_end_ = nullptr;
+  }
+
  protected:
   enum MigrationMode { kFast, kProfiled };
 
   EvacuateVisitorBase(Heap* heap, CompactionSpaceCollection* compaction_spaces)
       : heap_(heap),
         compaction_spaces_(compaction_spaces),
+        moved_code_start_(nullptr),
+        moved_code_end_(nullptr),
         profiling_(
             heap->isolate()->is_profiling() ||
             heap->isolate()->logger()->is_logging_code_events() ||
@@ -1695,7 +1798,8 @@ class MarkCompactCollector::EvacuateVisitorBase
                 CodeMoveEvent(AbstractCode::cast(src), dst_addr));
       }
       heap_->CopyBlock(dst_addr, src_addr, size);
-      Code::cast(dst)->Relocate(dst_addr - src_addr);
+      Code::cast(dst)->Relocate(dst_addr - src_addr, false);
+      RecordMovedCode(dst_addr, size);
       RecordMigratedSlotVisitor visitor(heap_->mark_compact_collector());
       dst->IterateBodyFast(dst->map()->instance_type(), size, &visitor);
     } else {
@@ -1729,8 +1833,21 @@ class MarkCompactCollector::EvacuateVisitorBase
   }
 #endif  // VERIFY_HEAP
 
+  // Moved code is not flushed object by object. Code evacuated into the same
+  // linear allocation area is contiguous, so it is collected into a single
+  // range that is flushed once it stops growing.
+  inline void RecordMovedCode(Address start, int size) {
+    if (start != moved_code_end_) {
+      FlushMovedCode();
+      moved_code_start_ = start;
+    }
+    moved_code_end_ = start + size;
+  }
+
   Heap* heap_;
   CompactionSpaceCollection* compaction_spaces_;
+  Address moved_code_start_;
+  Address moved_code_end_;
   bool profiling_;
 };
 
@@ -2172,6 +2289,18 @@ void MarkCompactCollector::EnsureMarkingDequeIsReserved() {
 }
 
 
+size_t MarkCompactCollector::MarkingDequeSizeForHeap() {
+  // One byte of marking deque per kHeapBytesPerDequeByte bytes of old
+  // generation, i.e., the default size covers old generations up to 1 GB.
+  const intptr_t kHeapBytesPerDequeByte = 256;
+  size_t wanted_size = static_cast<size_t>(
+      heap()->PromotedSpaceSizeOfObjects() / kHeapBytesPerDequeByte);
+  if (wanted_size <= kDefaultMarkingDequeSize) return kDefaultMarkingDequeSize;
+  if (wanted_size >= kMaxMarkingDequeSize) return kMaxMarkingDequeSize;
+  return base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(wanted_size));
+}
+
+
 void MarkCompactCollector::EnsureMarkingDequeIsCommitted(size_t max_size) {
   // If the marking deque is too small, we try to allocate a bigger one.
   // If that fails, make do with a smaller one.
@@ -2310,8 +2439,7 @@ void MarkCompactCollector::MarkLiveObjects() {
   state_ = MARK_LIVE_OBJECTS;
 #endif
 
-  EnsureMarkingDequeIsCommittedAndInitialize(
-      MarkCompactCollector::kMaxMarkingDequeSize);
+  EnsureMarkingDequeIsCommittedAndInitialize(MarkingDequeSizeForHeap());
 
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_MARK_PREPARE_CODE_FLUSH);
@@ -2634,6 +2762,7 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 
   int to_trim = enum_cache->length() - live_enum;
   if (to_trim <= 0) return;
+  descriptors->ClearEnumCacheKeys();
   heap_->RightTrimFixedArray<Heap::SEQUENTIAL_TO_SWEEPER>(
       descriptors->GetEnumCache(), to_trim);
 
@@ -2644,25 +2773,54 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 }
 
 
+bool MarkCompactCollector::ProcessEphemeron(ObjectHashTable* table,
+                                            int entry) {
+  if (!MarkCompactCollector::IsMarked(HeapObject::cast(table->KeyAt(entry)))) {
+    return false;
+  }
+  Object** key_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(entry));
+  RecordSlot(table, key_slot, *key_slot);
+  Object** value_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(entry));
+  MarkCompactMarkingVisitor::MarkObjectByPointer(this, table, value_slot);
+  return true;
+}
+
+
+void MarkCompactCollector::ScanWeakCollectionTable(ObjectHashTable* table) {
+  for (int i = 0; i < table->Capacity(); i++) {
+    if (!ProcessEphemeron(table, i)) {
+      Ephemeron ephemeron = {table, i};
+      pending_ephemerons_.Add(ephemeron);
+    }
+  }
+}
+
+
 void MarkCompactCollector::ProcessWeakCollections() {
+  // Revisit the entries whose keys were unmarked last time, dropping the ones
+  // that are resolved now. This keeps every round proportional to the number
+  // of unresolved entries rather than to the size of all tables.
+  int pending = 0;
+  for (int i = 0; i < pending_ephemerons_.length(); i++) {
+    Ephemeron ephemeron = pending_ephemerons_[i];
+    if (!ProcessEphemeron(ephemeron.table, ephemeron.entry)) {
+      pending_ephemerons_[pending++] = ephemeron;
+    }
+  }
+  pending_ephemerons_.Rewind(pending);
+
+  // Scan the tables of collections encountered since the last round.
   Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::FromInt(0)) {
+  Object* scanned = scanned_weak_collections_;
+  scanned_weak_collections_ = weak_collection_obj;
+  while (weak_collection_obj != scanned) {
     JSWeakCollection* weak_collection =
         reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
     DCHECK(MarkCompactCollector::IsMarked(weak_collection));
     if (weak_collection->table()->IsHashTable()) {
-      ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
-      for (int i = 0; i < table->Capacity(); i++) {
-        if (MarkCompactCollector::IsMarked(HeapObject::cast(table->KeyAt(i)))) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(table, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          MarkCompactMarkingVisitor::MarkObjectByPointer(this, table,
-                                                         value_slot);
-        }
-      }
+      ScanWeakCollectionTable(ObjectHashTable::cast(weak_collection->table()));
     }
     weak_collection_obj = weak_collection->next();
   }
@@ -2689,6 +2847,8 @@ void MarkCompactCollector::ClearWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::FromInt(0));
+  pending_ephemerons_.Clear();
+  scanned_weak_collections_ = Smi::FromInt(0);
 }
 
 
@@ -2701,6 +2861,8 @@ void MarkCompactCollector::AbortWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::FromInt(0));
+  pending_ephemerons_.Clear();
+  scanned_weak_collections_ = Smi::FromInt(0);
 }
 
 
@@ -3192,6 +3354,7 @@ bool MarkCompactCollector::Evacuator::EvacuatePage(Page* page) {
 }
 
 void MarkCompactCollector::Evacuator::Finalize() {
+  old_space_visitor_.FlushMovedCode();
   heap()->old_space()->MergeCompactionSpace(compaction_spaces_.Get(OLD_SPACE));
   heap()->code_space()->MergeCompactionSpace(
       compaction_spaces_.Get(CODE_SPACE));
@@ -3380,9 +3543,9 @@ int MarkCompactCollector::Sweeper::RawSweep(PagedSpace* space, Page* p,
   Address free_start = p->area_start();
   DCHECK(reinterpret_cast<intptr_t>(free_start) % (32 * kPointerSize) == 0);
 
-  // If we use the skip list for code space pages, we have to lock the skip
-  // list because it could be accessed concurrently by the runtime or the
-  // deoptimizer.
+  // The skip list of code space pages is rebuilt while sweeping. It is only
+  // read by the runtime or the deoptimizer after the page was swept, see
+  // SweepOrWaitUntilSweepingCompleted, which synchronizes on the page mutex.
   SkipList* skip_list = p->skip_list();
   if ((skip_list_mode == REBUILD_SKIP_LIST) && skip_list) {
     skip_list->Clear();
@@ -3572,7 +3735,12 @@ void MarkCompactCollector::EvacuateNewSpaceAndCandidates() {
   // Give pages that are queued to be freed back to the OS. Note that filtering
   // slots only handles old space (for unboxed doubles), and thus map space can
   // still contain stale pointers. We only free the chunks after pointer updates
-  // to still have access to page headers.
+  // to still have access to page headers. Pooled pages are released as well
+  // when the GC was triggered to reduce memory.
+  heap()->memory_allocator()->unmapper()->set_max_pooled_chunks(
+      heap()->ShouldReduceMemory()
+          ? 0
+          : MemoryAllocator::Unmapper::kMaxPooledChunks);
   heap()->memory_allocator()->unmapper()->FreeQueuedChunks();
 
   {
@@ -281,11 +281,16 @@ class CodeFlusher {
   inline void AddCandidate(SharedFunctionInfo* shared_info);
   inline void AddCandidate(JSFunction* function);
 
+  // Bytecode candidates are strongly marked. Their bytecode is aged after
+  // marking and dropped once it is old, so it's collected by the next GC.
+  inline void AddBytecodeCandidate(SharedFunctionInfo* shared_info);
+
   void EvictCandidate(SharedFunctionInfo* shared_info);
   void EvictCandidate(JSFunction* function);
 
   void ProcessCandidates() {
     ProcessSharedFunctionInfoCandidates();
+    ProcessBytecodeCandidates();
     ProcessJSFunctionCandidates();
   }
 
@@ -294,6 +299,7 @@ class CodeFlusher {
  private:
   void ProcessJSFunctionCandidates();
   void ProcessSharedFunctionInfoCandidates();
+  void ProcessBytecodeCandidates();
 
   static inline JSFunction** GetNextCandidateSlot(JSFunction* candidate);
   static inline JSFunction* GetNextCandidate(JSFunction* candidate);
@@ -311,6 +317,9 @@ class CodeFlusher {
   Isolate* isolate_;
   JSFunction* jsfunction_candidates_head_;
   SharedFunctionInfo* shared_function_info_candidates_head_;
+  // Shared function infos live in old space, so they don't move before the
+  // candidates are processed.
+  List<SharedFunctionInfo*> bytecode_candidates_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeFlusher);
 };
@@ -589,9 +598,18 @@ class MarkCompactCollector {
 
   MarkingDeque* marking_deque() { return &marking_deque_; }
 
-  static const size_t kMaxMarkingDequeSize = 4 * MB;
+  // Only 64-bit heaps get large enough to overflow a 4 MB marking deque
+  // regularly; do not reserve the address space on 32-bit.
+  static const size_t kMaxMarkingDequeSize =
+      kPointerSize == kInt64Size ? 32 * MB : 4 * MB;
+  static const size_t kDefaultMarkingDequeSize = 4 * MB;
   static const size_t kMinMarkingDequeSize = 256 * KB;
 
+  // Returns the size of the marking deque to use for marking the current
+  // heap. Every overflow of the deque forces a rescan of the whole heap for
+  // grey objects, so large heaps get a larger deque.
+  size_t MarkingDequeSizeForHeap();
+
   void EnsureMarkingDequeIsCommittedAndInitialize(size_t max_size) {
     if (!marking_deque_.in_use()) {
       EnsureMarkingDequeIsCommitted(max_size);
@@ -744,6 +762,10 @@ class MarkCompactCollector {
   // Clear non-live references in weak cells, transition and descriptor arrays,
   // and deoptimize dependent code of non-live maps.
   void ClearNonLiveReferences();
+
+  // Promotes all large objects in the young generation in place and records
+  // their slots, see --young-generation-large-objects.
+  void PromoteYoungLargeObjects();
   void MarkDependentCodeForDeoptimization(DependentCode* list);
   // Find non-live targets of simple transitions in the given list. Clear
   // transitions to non-live targets and if needed trim descriptors arrays.
@@ -759,8 +781,14 @@ class MarkCompactCollector {
 
   // Mark all values associated with reachable keys in weak collections
   // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
+  // the marking stack.  Each table is scanned once, the first time it is
+  // seen; entries whose key is still unmarked are kept as pending ephemerons
+  // and only those are revisited on later rounds.
   void ProcessWeakCollections();
+  void ScanWeakCollectionTable(ObjectHashTable* table);
+  // Marks the value of the given entry if its key is marked. Returns false if
+  // the key is still unmarked.
+  bool ProcessEphemeron(ObjectHashTable* table, int entry);
 
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
@@ -866,6 +894,17 @@ class MarkCompactCollector {
   MarkingDeque marking_deque_;
   std::vector<std::pair<void*, void*>> wrappers_to_trace_;
 
+  // Entries of encountered weak collections whose key was not yet marked when
+  // last looked at, see ProcessWeakCollections.
+  struct Ephemeron {
+    ObjectHashTable* table;
+    int entry;
+  };
+  List<Ephemeron> pending_ephemerons_;
+  // Head of the encountered weak collections list at the time of the last
+  // scan. Collections are prepended, so everything before it is new.
+  Object* scanned_weak_collections_;
+
   CodeFlusher* code_flusher_;
 
   EmbedderHeapTracer* embedder_heap_tracer_;
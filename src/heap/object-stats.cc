@@ -151,6 +151,12 @@ void ObjectStatsCollector::CountFixedArray(
   }
 }
 
+bool ObjectStatsCollector::ShouldCollectStatistics(HeapObject* obj) {
+  MemoryChunk* chunk = MemoryChunk::FromAddress(obj->address());
+  return !chunk->IsFlagSet(MemoryChunk::HAS_PROGRESS_BAR) ||
+         chunk->progress_bar() == 0;
+}
+
 void ObjectStatsCollector::CollectStatistics(StaticVisitorBase::VisitorId id,
                                              Map* map, HeapObject* obj) {
   // Record any type specific statistics here.
@@ -243,9 +249,10 @@ void MarkCompactObjectStatsVisitor::Initialize(
 
 template <MarkCompactObjectStatsVisitor::VisitorId id>
 void MarkCompactObjectStatsVisitor::Visit(Map* map, HeapObject* obj) {
-  ObjectStatsCollector::CollectStatistics(id, map, obj);
+  bool collect = ObjectStatsCollector::ShouldCollectStatistics(obj);
+  if (collect) ObjectStatsCollector::CollectStatistics(id, map, obj);
   table_.GetVisitorById(id)(map, obj);
-  ObjectStatsCollector::CollectFixedArrayStatistics(obj);
+  if (collect) ObjectStatsCollector::CollectFixedArrayStatistics(obj);
 }
 
 void IncrementalMarkingObjectStatsVisitor::Initialize(
@@ -260,9 +267,10 @@ void IncrementalMarkingObjectStatsVisitor::Initialize(
 
 template <IncrementalMarkingObjectStatsVisitor::VisitorId id>
 void IncrementalMarkingObjectStatsVisitor::Visit(Map* map, HeapObject* obj) {
-  ObjectStatsCollector::CollectStatistics(id, map, obj);
+  bool collect = ObjectStatsCollector::ShouldCollectStatistics(obj);
+  if (collect) ObjectStatsCollector::CollectStatistics(id, map, obj);
   table_.GetVisitorById(id)(map, obj);
-  ObjectStatsCollector::CollectFixedArrayStatistics(obj);
+  if (collect) ObjectStatsCollector::CollectFixedArrayStatistics(obj);
 }
 
 }  // namespace internal
@@ -83,6 +83,11 @@ class ObjectStats {
 
 class ObjectStatsCollector {
  public:
+  // Returns false if {obj} has already been recorded in the current cycle.
+  // This is the case for large arrays that are scanned incrementally using a
+  // progress bar, which are visited once per scanned chunk.
+  static bool ShouldCollectStatistics(HeapObject* obj);
+
   static void CollectStatistics(StaticVisitorBase::VisitorId id, Map* map,
                                 HeapObject* obj);
   static void CollectFixedArrayStatistics(HeapObject* obj);
@@ -470,6 +470,11 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
       VisitSharedFunctionInfoWeakCode(heap, object);
       return;
     }
+    if (IsFlushableBytecode(heap, shared)) {
+      // Unlike code, the bytecode is marked strongly here and only dropped
+      // after marking, see CodeFlusher::ProcessBytecodeCandidates.
+      collector->code_flusher()->AddBytecodeCandidate(shared);
+    }
   }
   VisitSharedFunctionInfoStrongCode(heap, object);
 }
@@ -496,9 +501,23 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSFunction(Map* map,
       // Treat the reference to the code object weakly.
       VisitJSFunctionWeakCode(map, object);
       return;
+    } else if (IsFlushableBytecode(heap, function)) {
+      // The function runs in the interpreter entry trampoline, which is never
+      // flushed. Treat the code weakly nevertheless, in order to reset the
+      // function to lazy compilation if its bytecode gets flushed.
+      collector->code_flusher()->AddCandidate(function);
+      VisitJSFunctionWeakCode(map, object);
+      return;
     } else {
       // Visit all unoptimized code objects to prevent flushing them.
       StaticVisitor::MarkObject(heap, function->shared()->code());
+      // Optimized code deoptimizes into the interpreter, so keep the
+      // bytecode around unless the function is not compiled yet.
+      if (function->shared()->HasBytecodeArray() &&
+          function->code() !=
+              heap->isolate()->builtins()->builtin(Builtins::kCompileLazy)) {
+        function->shared()->bytecode_array()->ResetAge();
+      }
     }
   }
   VisitJSFunctionStrongCode(map, object);
@@ -657,6 +676,44 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
 }
 
 
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsFlushableBytecode(
+    Heap* heap, JSFunction* function) {
+  // We do not flush bytecode for optimized functions.
+  if (function->code() != function->shared()->code()) {
+    return false;
+  }
+
+  return IsFlushableBytecode(heap, function->shared());
+}
+
+
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsFlushableBytecode(
+    Heap* heap, SharedFunctionInfo* shared_info) {
+  if (!FLAG_flush_bytecode || !shared_info->HasBytecodeArray()) {
+    return false;
+  }
+
+  // The function must only run in the interpreter.
+  if (shared_info->code() !=
+      heap->isolate()->builtins()->builtin(
+          Builtins::kInterpreterEntryTrampoline)) {
+    return false;
+  }
+
+  // The same restrictions as for flushing unoptimized code apply, see above.
+  if (!HasSourceCode(heap, shared_info) || shared_info->IsApiFunction() ||
+      !shared_info->allows_lazy_compilation() || shared_info->is_resumable() ||
+      shared_info->is_toplevel() || shared_info->IsBuiltin() ||
+      shared_info->HasDebugInfo() || shared_info->dont_flush()) {
+    return false;
+  }
+
+  return true;
+}
+
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoStrongCode(
     Heap* heap, HeapObject* object) {
@@ -46,7 +46,8 @@ class PageParallelJob {
         items_(nullptr),
         num_items_(0),
         num_tasks_(0),
-        pending_tasks_(semaphore) {}
+        pending_tasks_(semaphore),
+        num_available_items_(0) {}
 
   ~PageParallelJob() {
     Item* item = items_;
@@ -76,11 +77,15 @@ class PageParallelJob {
     if (num_items_ == 0) return;
     DCHECK_GE(num_tasks, 1);
     uint32_t task_ids[kMaxNumberOfTasks];
-    const int max_num_tasks = Min(
-        kMaxNumberOfTasks,
+    // Worker threads that are busy with other tasks of this isolate would
+    // only start our tasks once they are done, so don't count them.
+    const int idle_threads =
         static_cast<int>(
-            V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()));
+            V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()) -
+        cancelable_task_manager_->NumberOfRunningTasks();
+    const int max_num_tasks = Min(kMaxNumberOfTasks, idle_threads);
     num_tasks_ = Max(1, Min(num_tasks, max_num_tasks));
+    num_available_items_.SetValue(num_items_);
     int items_per_task = (num_items_ + num_tasks_ - 1) / num_tasks_;
     int start_index = 0;
     Task* main_task = nullptr;
@@ -89,7 +94,8 @@ class PageParallelJob {
         start_index -= num_items_;
       }
       Task* task = new Task(heap_, items_, num_items_, start_index,
-                            pending_tasks_, per_task_data_callback(i));
+                            &num_available_items_, pending_tasks_,
+                            per_task_data_callback(i));
       task_ids[i] = task->id();
       if (i > 0) {
         V8::GetCurrentPlatform()->CallOnBackgroundThread(
@@ -135,12 +141,14 @@ class PageParallelJob {
   class Task : public CancelableTask {
    public:
     Task(Heap* heap, Item* items, int num_items, int start_index,
+         base::AtomicNumber<int>* num_available_items,
          base::Semaphore* on_finish, typename JobTraits::PerTaskData data)
         : CancelableTask(heap->isolate()),
           heap_(heap),
           items_(items),
           num_items_(num_items),
           start_index_(start_index),
+          num_available_items_(num_available_items),
           on_finish_(on_finish),
           data_(data) {}
 
@@ -155,8 +163,14 @@ class PageParallelJob {
       while (skip-- > 0) {
         current = current->next;
       }
-      for (int i = 0; i < num_items_; i++) {
+      // Stop as soon as every page has been claimed, or once somebody tried
+      // to abort this task while it was running, instead of walking the rest
+      // of the list. Either way late tasks finish and can be joined quickly.
+      for (int i = 0; i < num_items_ && num_available_items_->Value() > 0 &&
+                      CancelAttempts() == 0;
+           i++) {
         if (current->state.TrySetValue(kAvailable, kProcessing)) {
+          num_available_items_->Increment(-1);
           bool success = JobTraits::ProcessPageInParallel(
               heap_, data_, current->chunk, current->data);
           current->state.SetValue(success ? kFinished : kFailed);
@@ -174,6 +188,7 @@ class PageParallelJob {
     Item* items_;
     int num_items_;
     int start_index_;
+    base::AtomicNumber<int>* num_available_items_;
     base::Semaphore* on_finish_;
     typename JobTraits::PerTaskData data_;
     DISALLOW_COPY_AND_ASSIGN(Task);
@@ -185,6 +200,7 @@ class PageParallelJob {
   int num_items_;
   int num_tasks_;
   base::Semaphore* pending_tasks_;
+  base::AtomicNumber<int> num_available_items_;
   DISALLOW_COPY_AND_ASSIGN(PageParallelJob);
 };
 
@@ -28,6 +28,14 @@ void Scavenger::ScavengeObject(HeapObject** p, HeapObject* object) {
     return;
   }
 
+  // Young large objects are promoted in place. They are checked first since
+  // looking for an allocation memento behind them would read past the end of
+  // their page.
+  if (IsYoungLargeObject(object)) {
+    PromoteLargeObject(object->GetHeap(), object);
+    return;
+  }
+
   object->GetHeap()->UpdateAllocationSite<Heap::kGlobal>(
       object, object->GetHeap()->global_pretenuring_feedback_);
 
@@ -37,6 +45,12 @@ void Scavenger::ScavengeObject(HeapObject** p, HeapObject* object) {
   return ScavengeObjectSlow(p, object);
 }
 
+bool Scavenger::IsYoungLargeObject(HeapObject* object) {
+  return FLAG_young_generation_large_objects &&
+         MemoryChunk::FromAddress(object->address())->owner()->identity() ==
+             LO_SPACE;
+}
+
 SlotCallbackResult Scavenger::CheckAndScavengeObject(Heap* heap,
                                                      Address slot_address) {
   Object** slot = reinterpret_cast<Object**>(slot_address);
@@ -4,12 +4,20 @@
 
 #include "src/heap/scavenger.h"
 
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/cancelable-task.h"
 #include "src/contexts.h"
 #include "src/heap/heap.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/page-parallel-job.h"
+#include "src/heap/remembered-set.h"
 #include "src/heap/scavenger-inl.h"
+#include "src/heap/spaces-inl.h"
 #include "src/isolate.h"
 #include "src/log.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -382,17 +390,60 @@ void Scavenger::ScavengeObjectSlow(HeapObject** p, HeapObject* object) {
   MapWord first_word = object->map_word();
   SLOW_DCHECK(!first_word.IsForwardingAddress());
   Map* map = first_word.ToMap();
+  if (IsYoungLargeObject(object)) {
+    PromoteLargeObject(map->GetHeap(), object);
+    return;
+  }
   Scavenger* scavenger = map->GetHeap()->scavenge_collector_;
   scavenger->scavenging_visitors_table_.GetVisitor(map)(map, p, object);
 }
 
 
+void Scavenger::PromoteLargeObject(Heap* heap, HeapObject* object) {
+  // Young large objects are never copied. Promoting the page in place also
+  // takes the object out of from space, so that it is not considered dead
+  // afterwards. Its pointers are processed like the ones of any other
+  // promoted object.
+  LargePage* page =
+      static_cast<LargePage*>(MemoryChunk::FromAddress(object->address()));
+  int object_size = object->Size();
+  heap->lo_space()->PromoteYoungObject(page);
+  heap->promotion_queue()->insert(
+      object, object_size, Marking::IsBlack(Marking::MarkBitFrom(object)));
+  heap->IncrementPromotedObjectsSize(object_size);
+}
+
+
+bool Scavenger::IsLoggingAndProfiling() {
+  return FLAG_verify_predictable || isolate()->logger()->is_logging() ||
+         isolate()->is_profiling() ||
+         (isolate()->heap_profiler() != NULL &&
+          isolate()->heap_profiler()->is_tracking_object_moves());
+}
+
+
+bool Scavenger::CanScavengeInParallel() {
+  return FLAG_parallel_scavenge &&
+         !heap()->incremental_marking()->IsMarking() &&
+         !IsLoggingAndProfiling();
+}
+
+
+int Scavenger::NumberOfParallelScavengeTasks(intptr_t new_space_size) {
+  // Scavenging speed is dominated by the amount of surviving objects, which
+  // is not known up front. Use one task per megabyte of allocated new space,
+  // limited by the available background threads.
+  const intptr_t kBytesPerTask = 1 * MB;
+  const int available_cores =
+      1 + static_cast<int>(
+              V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  const int wanted_tasks = 1 + static_cast<int>(new_space_size / kBytesPerTask);
+  return Min(available_cores, wanted_tasks);
+}
+
+
 void Scavenger::SelectScavengingVisitorsTable() {
-  bool logging_and_profiling =
-      FLAG_verify_predictable || isolate()->logger()->is_logging() ||
-      isolate()->is_profiling() ||
-      (isolate()->heap_profiler() != NULL &&
-       isolate()->heap_profiler()->is_tracking_object_moves());
+  bool logging_and_profiling = IsLoggingAndProfiling();
 
   if (!heap()->incremental_marking()->IsMarking()) {
     if (!logging_and_profiling) {
@@ -451,5 +502,514 @@ void ScavengeVisitor::ScavengePointer(Object** p) {
                             reinterpret_cast<HeapObject*>(object));
 }
 
+
+// Global pool of copied objects that still need to be visited. Tasks that run
+// out of local work block in {Steal} until other tasks share work, or until
+// all tasks are idle, which terminates processing.
+class ParallelScavenger::Worklist {
+ public:
+  static const int kStealBatchSize = 64;
+
+  Worklist() : active_tasks_(0), done_(false), pool_size_(0) {}
+
+  // Prepares the pool for another round of processing.
+  void Reset() {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    DCHECK(pool_.is_empty());
+    active_tasks_ = 0;
+    done_ = false;
+  }
+
+  // Registers a task that starts processing. Returns false if processing has
+  // already been finished by the other tasks.
+  bool Enter() {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (done_) return false;
+    active_tasks_++;
+    return true;
+  }
+
+  // Returns true if the pool is empty, i.e., idle tasks may wait for work.
+  bool IsEmpty() { return pool_size_.Value() == 0; }
+
+  // Moves {count} objects from {local} into the pool.
+  void Share(List<HeapObject*>* local, int count) {
+    DCHECK_LE(count, local->length());
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    for (int i = 0; i < count; i++) {
+      pool_.Add(local->RemoveLast());
+    }
+    pool_size_.SetValue(pool_.length());
+    cv_.NotifyAll();
+  }
+
+  // Refills {local} from the pool. Returns false once the pool is empty and
+  // all other tasks ran out of work as well.
+  bool Steal(List<HeapObject*>* local) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    DCHECK_GT(active_tasks_, 0);
+    active_tasks_--;
+    while (pool_.is_empty()) {
+      if (done_ || active_tasks_ == 0) {
+        done_ = true;
+        cv_.NotifyAll();
+        return false;
+      }
+      cv_.Wait(&mutex_);
+    }
+    active_tasks_++;
+    int count = Min(pool_.length(), kStealBatchSize);
+    for (int i = 0; i < count; i++) {
+      local->Add(pool_.RemoveLast());
+    }
+    pool_size_.SetValue(pool_.length());
+    return true;
+  }
+
+ private:
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  List<HeapObject*> pool_;
+  int active_tasks_;
+  bool done_;
+  base::AtomicNumber<int> pool_size_;
+};
+
+
+class ParallelScavenger::LocalScavenger {
+ public:
+  LocalScavenger(Heap* heap, Worklist* worklist)
+      : heap_(heap),
+        worklist_(worklist),
+        buffer_(LocalAllocationBuffer::InvalidBuffer()),
+        compaction_spaces_(heap),
+        local_pretenuring_feedback_(base::HashMap::PointersMatch,
+                                    kInitialLocalPretenuringFeedbackCapacity),
+        new_space_exhausted_(false),
+        promoted_size_(0),
+        semispace_copied_size_(0) {}
+
+  // Copies {object} unless another task already did so and updates {slot} to
+  // point to the copy.
+  inline void ScavengeObject(HeapObject** slot, HeapObject* object);
+
+  // Parallel counterpart of Scavenger::CheckAndScavengeObject.
+  inline SlotCallbackResult CheckAndScavengeObject(Address slot_address);
+
+  // Visits copied objects until all tasks ran out of work. The caller needs
+  // to have entered the worklist.
+  void Run();
+
+  // Merges locally cached data into the heap.
+  void Finalize();
+
+ private:
+  static const intptr_t kLabSize = 8 * KB;
+  static const int kMaxLabObjectSize = 256;
+  static const int kShareThreshold = 64;
+  static const int kInitialLocalPretenuringFeedbackCapacity = 256;
+
+  static inline AllocationAlignment RequiredAlignment(Map* map) {
+    switch (map->visitor_id()) {
+      case StaticVisitorBase::kVisitFixedDoubleArray:
+      case StaticVisitorBase::kVisitFixedFloat64Array:
+        return kDoubleAligned;
+      default:
+        return kWordAligned;
+    }
+  }
+
+  inline HeapObject* AllocateTarget(HeapObject* object, int size,
+                                    AllocationAlignment alignment,
+                                    bool* promoted);
+  inline AllocationResult AllocateInNewSpace(int size,
+                                             AllocationAlignment alignment);
+  inline void IterateObject(HeapObject* object);
+
+  Heap* heap_;
+  Worklist* worklist_;
+  List<HeapObject*> local_worklist_;
+  LocalAllocationBuffer buffer_;
+  CompactionSpaceCollection compaction_spaces_;
+  base::HashMap local_pretenuring_feedback_;
+  bool new_space_exhausted_;
+  intptr_t promoted_size_;
+  intptr_t semispace_copied_size_;
+
+  friend class ParallelScavenger;
+};
+
+
+// Visits the body of a copied object. Slots of promoted objects that still
+// point into new space are recorded in the OLD_TO_NEW remembered set. This is
+// safe because promoted objects live on pages owned by this task's
+// CompactionSpace.
+class ParallelScavenger::ObjectBodyVisitor final : public ObjectVisitor {
+ public:
+  ObjectBodyVisitor(Heap* heap, bool record_slots)
+      : heap_(heap), scavenger_(nullptr), record_slots_(record_slots) {}
+
+  void set_scavenger(LocalScavenger* scavenger) {
+    scavenger_ = scavenger;
+  }
+
+  inline void VisitPointers(Object** start, Object** end) final;
+
+  // Code objects never live in new space.
+  inline void VisitCodeEntry(Address code_entry_slot) final {}
+
+ private:
+  Heap* heap_;
+  LocalScavenger* scavenger_;
+  bool record_slots_;
+};
+
+
+void ParallelScavenger::LocalScavenger::ScavengeObject(HeapObject** slot,
+                                                       HeapObject* object) {
+  DCHECK(heap_->InFromSpace(object));
+  MapWord map_word = object->synchronized_map_word();
+  if (map_word.IsForwardingAddress()) {
+    *slot = map_word.ToForwardingAddress();
+    return;
+  }
+
+  // AllocationMementos are unrooted and shouldn't survive a scavenge.
+  Map* map = map_word.ToMap();
+  DCHECK(map != heap_->allocation_memento_map());
+
+  // Same shortcut as ScavengingVisitor::EvacuateShortcutCandidate: a flat
+  // ConsString is replaced by its first part. The fields of a from-space
+  // object are never updated, so reading them races with no other task.
+  if (IsShortcutCandidate(map->instance_type()) &&
+      ConsString::cast(object)->unchecked_second() == heap_->empty_string()) {
+    HeapObject* target =
+        HeapObject::cast(ConsString::cast(object)->unchecked_first());
+    if (heap_->InNewSpace(target)) ScavengeObject(&target, target);
+    if (!object->synchronized_compare_and_swap_map_word(
+            map_word, MapWord::FromForwardingAddress(target))) {
+      // Another task forwarded the string in the meantime.
+      *slot = object->synchronized_map_word().ToForwardingAddress();
+      return;
+    }
+    *slot = target;
+    return;
+  }
+
+  int size = object->SizeFromMap(map);
+  bool promoted = false;
+  HeapObject* target =
+      AllocateTarget(object, size, RequiredAlignment(map), &promoted);
+
+  heap_->CopyBlock(target->address(), object->address(), size);
+  // The map word of the source may already have been replaced by another
+  // task, so the copy needs the map we dispatched on.
+  target->set_map_word(MapWord::FromMap(map));
+
+  if (!object->synchronized_compare_and_swap_map_word(
+          map_word, MapWord::FromForwardingAddress(target))) {
+    // Another task copied the object in the meantime.
+    heap_->CreateFillerObjectAt(target->address(), size,
+                                ClearRecordedSlots::kNo);
+    *slot = object->synchronized_map_word().ToForwardingAddress();
+    return;
+  }
+
+  heap_->UpdateAllocationSite<Heap::kCached>(map, object,
+                                             &local_pretenuring_feedback_);
+  if (promoted) {
+    promoted_size_ += size;
+  } else {
+    semispace_copied_size_ += size;
+  }
+  *slot = target;
+  local_worklist_.Add(target);
+}
+
+
+SlotCallbackResult ParallelScavenger::LocalScavenger::CheckAndScavengeObject(
+    Address slot_address) {
+  Object** slot = reinterpret_cast<Object**>(slot_address);
+  Object* object = *slot;
+  if (heap_->InFromSpace(object)) {
+    ScavengeObject(reinterpret_cast<HeapObject**>(slot),
+                   reinterpret_cast<HeapObject*>(object));
+    // See Scavenger::CheckAndScavengeObject.
+    if (heap_->InToSpace(*slot)) {
+      return KEEP_SLOT;
+    }
+  } else {
+    DCHECK(!heap_->InNewSpace(object));
+  }
+  return REMOVE_SLOT;
+}
+
+
+HeapObject* ParallelScavenger::LocalScavenger::AllocateTarget(
+    HeapObject* object, int size, AllocationAlignment alignment,
+    bool* promoted) {
+  HeapObject* target = nullptr;
+  if (!heap_->ShouldBePromoted<DEFAULT_PROMOTION>(object->address(), size)) {
+    // A semi-space copy may fail due to fragmentation. In that case, we
+    // try to promote the object.
+    if (AllocateInNewSpace(size, alignment).To(&target)) return target;
+  }
+  if (compaction_spaces_.Get(OLD_SPACE)->AllocateRaw(size, alignment)
+          .To(&target)) {
+    *promoted = true;
+    return target;
+  }
+  // If promotion failed, we try to copy the object to the other semi-space.
+  if (heap_->new_space()->AllocateRawSynchronized(size, alignment)
+          .To(&target)) {
+    return target;
+  }
+  FatalProcessOutOfMemory("ParallelScavenger: semi-space copy\n");
+  return nullptr;
+}
+
+
+AllocationResult ParallelScavenger::LocalScavenger::AllocateInNewSpace(
+    int size, AllocationAlignment alignment) {
+  if (new_space_exhausted_) return AllocationResult::Retry(NEW_SPACE);
+  if (size > kMaxLabObjectSize) {
+    return heap_->new_space()->AllocateRawSynchronized(size, alignment);
+  }
+  AllocationResult allocation;
+  if (buffer_.IsValid()) {
+    allocation = buffer_.AllocateRawAligned(size, alignment);
+    if (!allocation.IsRetry()) return allocation;
+  }
+  AllocationResult result =
+      heap_->new_space()->AllocateRawSynchronized(kLabSize, kWordAligned);
+  LocalAllocationBuffer saved_old_buffer = buffer_;
+  buffer_ = LocalAllocationBuffer::FromResult(heap_, result, kLabSize);
+  if (!buffer_.IsValid()) {
+    new_space_exhausted_ = true;
+    return AllocationResult::Retry(NEW_SPACE);
+  }
+  buffer_.TryMerge(&saved_old_buffer);
+  return buffer_.AllocateRawAligned(size, alignment);
+}
+
+
+void ParallelScavenger::LocalScavenger::IterateObject(HeapObject* object) {
+  Map* map = object->map();
+  ObjectBodyVisitor visitor(heap_, !heap_->InNewSpace(object));
+  visitor.set_scavenger(this);
+  object->IterateBody(map->instance_type(), object->SizeFromMap(map),
+                      &visitor);
+}
+
+
+void ParallelScavenger::LocalScavenger::Run() {
+  do {
+    while (!local_worklist_.is_empty()) {
+      IterateObject(local_worklist_.RemoveLast());
+      if (local_worklist_.length() > kShareThreshold && worklist_->IsEmpty()) {
+        worklist_->Share(&local_worklist_, local_worklist_.length() / 2);
+      }
+    }
+  } while (worklist_->Steal(&local_worklist_));
+}
+
+
+void ParallelScavenger::LocalScavenger::Finalize() {
+  // Closing the buffer fills its unused remainder.
+  buffer_ = LocalAllocationBuffer::InvalidBuffer();
+  heap_->old_space()->MergeCompactionSpace(compaction_spaces_.Get(OLD_SPACE));
+  heap_->IncrementPromotedObjectsSize(promoted_size_);
+  heap_->IncrementSemiSpaceCopiedObjectSize(semispace_copied_size_);
+  heap_->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
+}
+
+
+void ParallelScavenger::ObjectBodyVisitor::VisitPointers(Object** start,
+                                                         Object** end) {
+  for (Object** p = start; p < end; p++) {
+    Object* object = *p;
+    if (!heap_->InFromSpace(object)) continue;
+    scavenger_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                               reinterpret_cast<HeapObject*>(object));
+    if (record_slots_ && heap_->InToSpace(*p)) {
+      Address slot_address = reinterpret_cast<Address>(p);
+      RememberedSet<OLD_TO_NEW>::Insert(Page::FromAddress(slot_address),
+                                        slot_address);
+    }
+  }
+}
+
+
+// Copies objects referenced from roots using the main thread's scavenger.
+class ParallelScavenger::RootVisitor final : public ObjectVisitor {
+ public:
+  RootVisitor(Heap* heap, LocalScavenger* scavenger)
+      : heap_(heap), scavenger_(scavenger) {}
+
+  void VisitPointer(Object** p) final { ScavengePointer(p); }
+
+  void VisitPointers(Object** start, Object** end) final {
+    for (Object** p = start; p < end; p++) ScavengePointer(p);
+  }
+
+ private:
+  inline void ScavengePointer(Object** p) {
+    Object* object = *p;
+    if (!heap_->InNewSpace(object)) return;
+    if (heap_->PurgeLeftTrimmedObject(p)) return;
+    scavenger_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                               reinterpret_cast<HeapObject*>(object));
+  }
+
+  Heap* heap_;
+  LocalScavenger* scavenger_;
+};
+
+
+class ParallelScavenger::Task : public CancelableTask {
+ public:
+  Task(Isolate* isolate, LocalScavenger* scavenger, Worklist* worklist,
+       base::Semaphore* on_finish)
+      : CancelableTask(isolate),
+        scavenger_(scavenger),
+        worklist_(worklist),
+        on_finish_(on_finish) {}
+
+  virtual ~Task() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    if (worklist_->Enter()) scavenger_->Run();
+    on_finish_->Signal();
+  }
+
+  LocalScavenger* scavenger_;
+  Worklist* worklist_;
+  base::Semaphore* on_finish_;
+
+  DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+
+// Scavenges the OLD_TO_NEW slots of a page. Each page is processed by exactly
+// one task, so its slot sets can be filtered without synchronization. Slots of
+// promoted objects are only recorded when copied objects are visited in
+// {Process}, i.e., after all slot sets have been iterated.
+class ParallelScavenger::OldToNewSlotsJobTraits {
+ public:
+  typedef int PerPageData;  // Per page data is not used in this job.
+  typedef LocalScavenger* PerTaskData;
+
+  static bool ProcessPageInParallel(Heap* heap, LocalScavenger* scavenger,
+                                    MemoryChunk* chunk, PerPageData) {
+    RememberedSet<OLD_TO_NEW>::Iterate(chunk, [scavenger](Address addr) {
+      return scavenger->CheckAndScavengeObject(addr);
+    });
+    Isolate* isolate = heap->isolate();
+    RememberedSet<OLD_TO_NEW>::IterateTyped(
+        chunk, [isolate, scavenger](SlotType type, Address host_addr,
+                                    Address addr) {
+          return UpdateTypedSlotHelper::UpdateTypedSlot(
+              isolate, type, addr, [scavenger](Object** addr) {
+                return scavenger->CheckAndScavengeObject(
+                    reinterpret_cast<Address>(addr));
+              });
+        });
+    return true;
+  }
+
+  static const bool NeedSequentialFinalization = false;
+  static void FinalizePageSequentially(Heap*, MemoryChunk*, bool, PerPageData) {
+  }
+};
+
+
+ParallelScavenger::ParallelScavenger(Heap* heap, int num_tasks,
+                                     base::Semaphore* semaphore)
+    : heap_(heap),
+      num_tasks_(Max(1, Min(num_tasks, kMaxNumberOfTasks))),
+      pending_tasks_(semaphore),
+      worklist_(new Worklist()) {
+  // Promoted objects are allocated in CompactionSpaces, which are only safe to
+  // refill from the old space while no sweeper tasks are running. The full GC
+  // completes sweeping before evacuating for the same reason.
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+  for (int i = 0; i < num_tasks_; i++) {
+    local_scavengers_[i] = new LocalScavenger(heap, worklist_);
+  }
+  main_thread_visitor_ = new RootVisitor(heap, local_scavengers_[0]);
+}
+
+
+ParallelScavenger::~ParallelScavenger() {
+  delete main_thread_visitor_;
+  for (int i = 0; i < num_tasks_; i++) {
+    delete local_scavengers_[i];
+  }
+  delete worklist_;
+}
+
+
+ObjectVisitor* ParallelScavenger::main_thread_visitor() {
+  return main_thread_visitor_;
+}
+
+
+void ParallelScavenger::ScavengeOldToNewSlots() {
+  static const int kPagesPerTask = 4;
+  PageParallelJob<OldToNewSlotsJobTraits> job(
+      heap_, heap_->isolate()->cancelable_task_manager(), pending_tasks_);
+  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+      heap_, [&job](MemoryChunk* chunk) { job.AddPage(chunk, 0); });
+  int num_pages = job.NumberOfPages();
+  int num_tasks =
+      Min(num_tasks_, (num_pages + kPagesPerTask - 1) / kPagesPerTask);
+  job.Run(num_tasks, [this](int i) { return local_scavengers_[i]; });
+}
+
+
+void ParallelScavenger::Process() {
+  worklist_->Reset();
+  // Background tasks may hold objects copied while scavenging slots. They are
+  // moved to the shared pool as a task does not necessarily get to run again.
+  for (int i = 1; i < num_tasks_; i++) {
+    List<HeapObject*>* local = &local_scavengers_[i]->local_worklist_;
+    if (!local->is_empty()) worklist_->Share(local, local->length());
+  }
+  // The main thread holds the work copied from roots so far and needs to be
+  // registered before any background task may observe an idle worklist.
+  bool entered = worklist_->Enter();
+  DCHECK(entered);
+  USE(entered);
+
+  uint32_t task_ids[kMaxNumberOfTasks];
+  for (int i = 1; i < num_tasks_; i++) {
+    Task* task = new Task(heap_->isolate(), local_scavengers_[i], worklist_,
+                          pending_tasks_);
+    task_ids[i] = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+
+  // Contribute on main thread.
+  local_scavengers_[0]->Run();
+
+  // Wait for background tasks.
+  for (int i = 1; i < num_tasks_; i++) {
+    if (!heap_->isolate()->cancelable_task_manager()->TryAbort(task_ids[i])) {
+      pending_tasks_->Wait();
+    }
+  }
+}
+
+
+void ParallelScavenger::Finalize() {
+  for (int i = 0; i < num_tasks_; i++) {
+    DCHECK(local_scavengers_[i]->local_worklist_.is_empty());
+    local_scavengers_[i]->Finalize();
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
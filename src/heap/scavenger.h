@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_SCAVENGER_H_
 #define V8_HEAP_SCAVENGER_H_
 
+#include "src/base/platform/semaphore.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/slot-set.h"
 
@@ -16,7 +17,8 @@ typedef void (*ScavengingCallback)(Map* map, HeapObject** slot,
 
 class Scavenger {
  public:
-  explicit Scavenger(Heap* heap) : heap_(heap) {}
+  explicit Scavenger(Heap* heap)
+      : heap_(heap), parallel_scavenge_semaphore_(0) {}
 
   // Initializes static visitor dispatch tables.
   static void Initialize();
@@ -32,16 +34,93 @@ class Scavenger {
   // Slow part of {ScavengeObject} above.
   static void ScavengeObjectSlow(HeapObject** p, HeapObject* object);
 
+  // Promotes a young large object, see --young-generation-large-objects.
+  static void PromoteLargeObject(Heap* heap, HeapObject* object);
+
+  // Returns true if {object} is a young large object, using the owner of its
+  // page rather than a lookup in the large object space.
+  static inline bool IsYoungLargeObject(HeapObject* object);
+
   // Chooses an appropriate static visitor table depending on the current state
   // of the heap (i.e. incremental marking, logging and profiling).
   void SelectScavengingVisitorsTable();
 
+  // Returns true if the current scavenge can be performed by the
+  // ParallelScavenger, i.e., neither marks need to be transferred nor object
+  // moves need to be logged.
+  bool CanScavengeInParallel();
+
+  // Returns the number of tasks to use for scavenging a new space holding
+  // {new_space_size} bytes.
+  int NumberOfParallelScavengeTasks(intptr_t new_space_size);
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
+  // The semaphore has to live as long as the isolate. See PageParallelJob.
+  base::Semaphore* parallel_scavenge_semaphore() {
+    return &parallel_scavenge_semaphore_;
+  }
+
  private:
+  bool IsLoggingAndProfiling();
+
   Heap* heap_;
   VisitorDispatchTable<ScavengingCallback> scavenging_visitors_table_;
+  base::Semaphore parallel_scavenge_semaphore_;
+};
+
+
+// Copies live new space objects using the main thread and background tasks.
+// Each task allocates semi-space copies from its own LocalAllocationBuffer and
+// promotes into its own CompactionSpace, which are merged back by {Finalize}.
+// Forwarding addresses are installed with a compare-and-swap on the map word,
+// so that an object reachable from several tasks is copied exactly once.
+// Copied objects are kept on task-local worklists; surplus work is shared
+// through a global pool that idle tasks steal from.
+class ParallelScavenger {
+ public:
+  ParallelScavenger(Heap* heap, int num_tasks, base::Semaphore* semaphore);
+  ~ParallelScavenger();
+
+  // Visitor used for roots on the main thread. Copied objects are processed
+  // by the next call to {Process}.
+  ObjectVisitor* main_thread_visitor();
+
+  // Scavenges objects referenced from the OLD_TO_NEW remembered set, including
+  // typed slots on code pages. Pages are distributed over all tasks, each of
+  // which copies into its own buffers. Copied objects are processed by the
+  // next call to {Process}.
+  void ScavengeOldToNewSlots();
+
+  // Processes copied objects until their transitive closure in new space has
+  // been copied. Blocks until all background tasks finished.
+  void Process();
+
+  // Merges task-local state back into the heap. Needs to be called on the
+  // main thread after the last call to {Process}.
+  void Finalize();
+
+  int num_tasks() const { return num_tasks_; }
+
+ private:
+  class LocalScavenger;
+  class ObjectBodyVisitor;
+  class OldToNewSlotsJobTraits;
+  class RootVisitor;
+  class Task;
+  class Worklist;
+
+  static const int kMaxNumberOfTasks = 8;
+
+  Heap* heap_;
+  int num_tasks_;
+  base::Semaphore* pending_tasks_;
+  Worklist* worklist_;
+  LocalScavenger* local_scavengers_[kMaxNumberOfTasks];
+  RootVisitor* main_thread_visitor_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelScavenger);
 };
 
 
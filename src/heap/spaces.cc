@@ -382,6 +382,11 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   while ((chunk = GetMemoryChunkSafe<kNonRegular>()) != nullptr) {
     allocator_->PerformFreeMemory(chunk);
   }
+  // Pooled chunks are already uncommitted and only need to be unmapped.
+  while ((chunk = GetSurplusPooledMemoryChunkSafe()) != nullptr) {
+    allocator_->FreeMemory(reinterpret_cast<Address>(chunk),
+                           MemoryChunk::kPageSize, NOT_EXECUTABLE);
+  }
 }
 
 void MemoryAllocator::Unmapper::ReconsiderDelayedChunks() {
@@ -748,11 +753,27 @@ MemoryChunk* MemoryAllocator::AllocateChunk(intptr_t reserve_area_size,
                          owner);
   }
 
+  if (FLAG_huge_pages) AdviseHugePages(base, area_end - base);
+
   return MemoryChunk::Initialize(heap, base, chunk_size, area_start, area_end,
                                  executable, owner, &reservation);
 }
 
 
+void MemoryAllocator::AdviseHugePages(Address start, size_t size) {
+  const intptr_t kHugePageSize = 2 * MB;
+  bool in_code_range = code_range()->valid() && code_range()->contains(start);
+  bool spans_huge_page =
+      RoundUp(start, kHugePageSize) + kHugePageSize <= start + size;
+  if ((in_code_range || spans_huge_page) &&
+      base::OS::AdviseHugePages(start, size)) {
+    isolate_->counters()->huge_page_chunks()->Increment();
+  } else {
+    isolate_->counters()->huge_page_fallback_chunks()->Increment();
+  }
+}
+
+
 void Page::ResetFreeListStatistics() {
   wasted_memory_ = 0;
   available_in_free_list_ = 0;
@@ -851,6 +872,9 @@ template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kRegular, PagedSpace>(
     intptr_t size, PagedSpace* owner, Executability executable);
 template Page*
+MemoryAllocator::AllocatePage<MemoryAllocator::kPooled, PagedSpace>(
+    intptr_t size, PagedSpace* owner, Executability executable);
+template Page*
 MemoryAllocator::AllocatePage<MemoryAllocator::kRegular, SemiSpace>(
     intptr_t size, SemiSpace* owner, Executability executable);
 template Page*
@@ -1211,7 +1235,13 @@ bool PagedSpace::Expand() {
 
   if (!heap()->CanExpandOldGeneration(size)) return false;
 
-  Page* p = heap()->memory_allocator()->AllocatePage(size, this, executable());
+  Page* p = nullptr;
+  if (size == Page::kAllocatableMemory && executable() == NOT_EXECUTABLE) {
+    p = heap()->memory_allocator()->AllocatePage<MemoryAllocator::kPooled>(
+        size, this, executable());
+  } else {
+    p = heap()->memory_allocator()->AllocatePage(size, this, executable());
+  }
   if (p == nullptr) return false;
 
   AccountCommitted(static_cast<intptr_t>(p->size()));
@@ -1279,7 +1309,12 @@ void PagedSpace::ReleasePage(Page* page) {
   }
 
   AccountUncommitted(static_cast<intptr_t>(page->size()));
-  heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  if (page->size() == static_cast<size_t>(Page::kPageSize) &&
+      executable() == NOT_EXECUTABLE) {
+    heap()->memory_allocator()->Free<MemoryAllocator::kPooledAndQueue>(page);
+  } else {
+    heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  }
 
   DCHECK(Capacity() > 0);
   accounting_stats_.ShrinkSpace(AreaSize());
@@ -2297,7 +2332,8 @@ void FreeListCategory::Invalidate() {
   type_ = kInvalidCategory;
 }
 
-FreeList::FreeList(PagedSpace* owner) : owner_(owner), wasted_bytes_(0) {
+FreeList::FreeList(PagedSpace* owner)
+    : owner_(owner), wasted_bytes_(0), non_empty_categories_(0) {
   for (int i = kFirstCategory; i < kNumberOfCategories; i++) {
     categories_[i] = nullptr;
   }
@@ -2311,6 +2347,7 @@ void FreeList::Reset() {
   for (int i = kFirstCategory; i < kNumberOfCategories; i++) {
     categories_[i] = nullptr;
   }
+  non_empty_categories_ = 0;
   ResetStats();
 }
 
@@ -2391,19 +2428,26 @@ FreeSpace* FreeList::FindNodeFor(int size_in_bytes, int* node_size) {
 
   // First try the allocation fast path: try to allocate the minimum element
   // size of a free list category. This operation is constant time.
+  // Only category types that have linked categories are visited.
   FreeListCategoryType type =
       SelectFastAllocationFreeListCategoryType(size_in_bytes);
-  for (int i = type; i < kHuge; i++) {
+  uint32_t candidates =
+      non_empty_categories_ & ~((1u << type) - 1) & ((1u << kHuge) - 1);
+  while (candidates != 0) {
+    int i = base::bits::CountTrailingZeros32(candidates);
+    candidates &= candidates - 1;
     node = FindNodeIn(static_cast<FreeListCategoryType>(i), node_size);
     if (node != nullptr) return node;
   }
 
   // Next search the huge list for free list nodes. This takes linear time in
   // the number of huge elements.
-  node = SearchForNodeInList(kHuge, node_size, size_in_bytes);
-  if (node != nullptr) {
-    DCHECK(IsVeryLong() || Available() == SumFreeLists());
-    return node;
+  if (HasCategoriesOfType(kHuge)) {
+    node = SearchForNodeInList(kHuge, node_size, size_in_bytes);
+    if (node != nullptr) {
+      DCHECK(IsVeryLong() || Available() == SumFreeLists());
+      return node;
+    }
   }
 
   // We need a huge block of memory, but we didn't find anything in the huge
@@ -2536,6 +2580,7 @@ bool FreeList::AddCategory(FreeListCategory* category) {
   }
   category->set_next(top);
   categories_[type] = category;
+  non_empty_categories_ |= 1u << type;
   return true;
 }
 
@@ -2546,6 +2591,9 @@ void FreeList::RemoveCategory(FreeListCategory* category) {
   // Common double-linked list removal.
   if (top == category) {
     categories_[type] = category->next();
+    if (categories_[type] == nullptr) {
+      non_empty_categories_ &= ~(1u << type);
+    }
   }
   if (category->prev() != nullptr) {
     category->prev()->set_next(category->next());
@@ -2956,6 +3004,7 @@ LargeObjectSpace::LargeObjectSpace(Heap* heap, AllocationSpace id)
       size_(0),
       page_count_(0),
       objects_size_(0),
+      young_objects_size_(0),
       chunk_map_(base::HashMap::PointersMatch, 1024) {}
 
 LargeObjectSpace::~LargeObjectSpace() {}
@@ -2966,6 +3015,7 @@ bool LargeObjectSpace::SetUp() {
   size_ = 0;
   page_count_ = 0;
   objects_size_ = 0;
+  young_objects_size_ = 0;
   chunk_map_.Clear();
   return true;
 }
@@ -2990,9 +3040,39 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
     return AllocationResult::Retry(identity());
   }
 
+  LargePage* page = AllocateLargePage(object_size, executable);
+  if (page == NULL) return AllocationResult::Retry(identity());
+
+  HeapObject* object = page->GetObject();
+  heap()->incremental_marking()->OldSpaceStep(object_size);
+  AllocationStep(object->address(), object_size);
+  return object;
+}
+
+
+AllocationResult LargeObjectSpace::AllocateRawInYoungGeneration(
+    int object_size) {
+  LargePage* page = AllocateLargePage(object_size, NOT_EXECUTABLE);
+  if (page == NULL) return AllocationResult::Retry(NEW_SPACE);
+
+  // Turn the page into a to space page. Pointers to it have to be recorded
+  // by the write barrier, pointers from it only while marking.
+  page->ClearFlag(MemoryChunk::POINTERS_FROM_HERE_ARE_INTERESTING);
+  page->SetFlag(MemoryChunk::IN_TO_SPACE);
+  heap()->incremental_marking()->SetNewSpacePageFlags(page);
+  young_objects_size_ += object_size;
+
+  HeapObject* object = page->GetObject();
+  AllocationStep(object->address(), object_size);
+  return object;
+}
+
+
+LargePage* LargeObjectSpace::AllocateLargePage(int object_size,
+                                               Executability executable) {
   LargePage* page = heap()->memory_allocator()->AllocateLargePage(
       object_size, this, executable);
-  if (page == NULL) return AllocationResult::Retry(identity());
+  if (page == NULL) return NULL;
   DCHECK(page->area_size() >= object_size);
 
   size_ += static_cast<int>(page->size());
@@ -3023,10 +3103,36 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
         heap()->fixed_array_map();
     reinterpret_cast<Object**>(object->address())[1] = Smi::FromInt(0);
   }
+  return page;
+}
 
-  heap()->incremental_marking()->OldSpaceStep(object_size);
-  AllocationStep(object->address(), object_size);
-  return object;
+
+void LargeObjectSpace::FlipYoungObjects() {
+  for (LargePage* page : *this) {
+    if (page->InToSpace()) {
+      page->ClearFlag(MemoryChunk::IN_TO_SPACE);
+      page->SetFlag(MemoryChunk::IN_FROM_SPACE);
+    }
+  }
+}
+
+
+void LargeObjectSpace::PromoteYoungObject(LargePage* page) {
+  DCHECK(page->InNewSpace());
+  DCHECK_EQ(this, page->owner());
+  page->ClearFlag(MemoryChunk::IN_FROM_SPACE);
+  page->ClearFlag(MemoryChunk::IN_TO_SPACE);
+  heap()->incremental_marking()->SetOldSpacePageFlags(page);
+  young_objects_size_ -= page->GetObject()->Size();
+}
+
+
+void LargeObjectSpace::FreeDeadYoungObjects() {
+  FreeObjectsIf([](HeapObject* object) {
+    return MemoryChunk::FromAddress(object->address())->InFromSpace();
+  });
+  // Surviving young objects have all been promoted.
+  young_objects_size_ = 0;
 }
 
 
@@ -3079,13 +3185,21 @@ void LargeObjectSpace::ClearMarkingStateOfLiveObjects() {
 
 
 void LargeObjectSpace::FreeUnmarkedObjects() {
+  FreeObjectsIf([](HeapObject* object) {
+    MarkBit mark_bit = Marking::MarkBitFrom(object);
+    DCHECK(!Marking::IsGrey(mark_bit));
+    return !Marking::IsBlack(mark_bit);
+  });
+}
+
+
+template <typename Callback>
+void LargeObjectSpace::FreeObjectsIf(Callback should_free) {
   LargePage* previous = NULL;
   LargePage* current = first_page_;
   while (current != NULL) {
     HeapObject* object = current->GetObject();
-    MarkBit mark_bit = Marking::MarkBitFrom(object);
-    DCHECK(!Marking::IsGrey(mark_bit));
-    if (Marking::IsBlack(mark_bit)) {
+    if (!should_free(object)) {
       previous = current;
       current = current->next_page();
     } else {
@@ -503,6 +503,10 @@ class MemoryChunk {
 
   static const intptr_t kFlagsOffset = kSizeOffset + kPointerSize;
 
+  static const intptr_t kAreaStartOffset = kFlagsOffset + kIntptrSize;
+
+  static const intptr_t kAreaEndOffset = kAreaStartOffset + kPointerSize;
+
   static const intptr_t kLiveBytesOffset =
       kSizeOffset + kPointerSize  // size_t size
       + kIntptrSize               // intptr_t flags_
@@ -1123,6 +1127,11 @@ class Space : public Malloced {
 class MemoryChunkValidator {
   // Computed offsets should match the compiler generated ones.
   STATIC_ASSERT(MemoryChunk::kSizeOffset == offsetof(MemoryChunk, size_));
+  STATIC_ASSERT(MemoryChunk::kFlagsOffset == offsetof(MemoryChunk, flags_));
+  STATIC_ASSERT(MemoryChunk::kAreaStartOffset ==
+                offsetof(MemoryChunk, area_start_));
+  STATIC_ASSERT(MemoryChunk::kAreaEndOffset ==
+                offsetof(MemoryChunk, area_end_));
   STATIC_ASSERT(MemoryChunk::kLiveBytesOffset ==
                 offsetof(MemoryChunk, live_byte_count_));
   STATIC_ASSERT(MemoryChunk::kOldToNewSlotsOffset ==
@@ -1301,8 +1310,13 @@ class MemoryAllocator {
    public:
     class UnmapFreeMemoryTask;
 
+    // Upper bound for the number of reserved but uncommitted pages kept for
+    // reuse.
+    static const int kMaxPooledChunks = 64;
+
     explicit Unmapper(MemoryAllocator* allocator)
         : allocator_(allocator),
+          max_pooled_chunks_(kMaxPooledChunks),
           pending_unmapping_tasks_semaphore_(0),
           concurrent_unmapping_tasks_active_(0) {}
 
@@ -1332,6 +1346,13 @@ class MemoryAllocator {
       return chunk;
     }
 
+    // Sets the number of pooled chunks that survive the next unmapping cycle.
+    // Surplus chunks are released to the OS by the unmapping task.
+    void set_max_pooled_chunks(int max_pooled_chunks) {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      max_pooled_chunks_ = max_pooled_chunks;
+    }
+
     void FreeQueuedChunks();
     bool WaitUntilCompleted();
 
@@ -1364,11 +1385,22 @@ class MemoryAllocator {
       return chunk;
     }
 
+    MemoryChunk* GetSurplusPooledMemoryChunkSafe() {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      if (chunks_[kPooled].size() <= static_cast<size_t>(max_pooled_chunks_)) {
+        return nullptr;
+      }
+      MemoryChunk* chunk = chunks_[kPooled].back();
+      chunks_[kPooled].pop_back();
+      return chunk;
+    }
+
     void ReconsiderDelayedChunks();
     void PerformFreeMemoryOnQueuedChunks();
 
     base::Mutex mutex_;
     MemoryAllocator* allocator_;
+    int max_pooled_chunks_;
     std::list<MemoryChunk*> chunks_[kNumberOfChunkQueues];
     // Delayed chunks cannot be processed in the current unmapping cycle because
     // of dependencies such as an active sweeper.
@@ -1514,6 +1546,11 @@ class MemoryAllocator {
   // bookkeeping and calls the allocation callback.
   void PreFreeMemory(MemoryChunk* chunk);
 
+  // Advises the OS to back [start, start + size[ with huge pages. Chunks in
+  // the code range are contiguous and may be merged into huge pages by the
+  // OS. Other chunks need to span at least one aligned huge page.
+  void AdviseHugePages(Address start, size_t size);
+
   // FreeMemory can be called concurrently when PreFree was executed before.
   void PerformFreeMemory(MemoryChunk* chunk);
 
@@ -2001,10 +2038,20 @@ class FreeList {
 
   FreeListCategory* top(FreeListCategoryType type) { return categories_[type]; }
 
+  // Returns true if at least one category of the given |type| is linked into
+  // this free list. Linked categories may still turn out to be empty.
+  bool HasCategoriesOfType(FreeListCategoryType type) {
+    return (non_empty_categories_ & (1u << type)) != 0;
+  }
+
   PagedSpace* owner_;
   base::AtomicNumber<intptr_t> wasted_bytes_;
   FreeListCategory* categories_[kNumberOfCategories];
 
+  // Bit i is set iff categories_[i] is not nullptr. Allows the allocation fast
+  // path to skip empty category types without touching the lists.
+  uint32_t non_empty_categories_;
+
   friend class FreeListCategory;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(FreeList);
@@ -3061,6 +3108,31 @@ class LargeObjectSpace : public Space {
   MUST_USE_RESULT AllocationResult
       AllocateRaw(int object_size, Executability executable);
 
+  // Allocates a large object in the young generation, see
+  // --young-generation-large-objects. The page of the object is flagged as
+  // to space, so that the object is treated as a new space object until the
+  // next scavenge either promotes it in place or frees its page.
+  MUST_USE_RESULT AllocationResult
+      AllocateRawInYoungGeneration(int object_size);
+
+  // Moves all young large objects to from space at the start of a scavenge.
+  void FlipYoungObjects();
+
+  // Promotes the young large object on {page} in place by turning the page
+  // into an old generation page.
+  void PromoteYoungObject(LargePage* page);
+
+  // Frees the pages of young large objects that were not promoted during a
+  // scavenge.
+  void FreeDeadYoungObjects();
+
+  // Size of the large objects that are still in the young generation. These
+  // are included in SizeOfObjects().
+  intptr_t SizeOfYoungObjects() { return young_objects_size_; }
+
+  // Accounts for a young large object that was right-trimmed by {bytes}.
+  void ShrinkYoungObject(int bytes) { young_objects_size_ -= bytes; }
+
   // Available bytes for objects in this space.
   inline intptr_t Available() override;
 
@@ -3116,11 +3188,18 @@ class LargeObjectSpace : public Space {
 #endif
 
  private:
+  LargePage* AllocateLargePage(int object_size, Executability executable);
+
+  // Frees the pages of all objects for which {should_free} returns true.
+  template <typename Callback>
+  void FreeObjectsIf(Callback should_free);
+
   // The head of the linked list of large object chunks.
   LargePage* first_page_;
   intptr_t size_;          // allocated bytes
   int page_count_;         // number of chunks
   intptr_t objects_size_;  // size of objects
+  intptr_t young_objects_size_;  // size of objects in the young generation
   // Map MemoryChunk::kAlignment-aligned chunks to large pages covering them
   base::HashMap chunk_map_;
 
@@ -92,9 +92,12 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
+  // Load, keyed load, store and keyed store handlers all share these tables,
+  // so size them for applications with thousands of maps. The generated
+  // probes only depend on the sizes through the masks derived from them.
+  static const int kPrimaryTableBits = 12;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  static const int kSecondaryTableBits = 10;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   static int PrimaryOffsetForTesting(Name* name, Code::Flags flags, Map* map) {
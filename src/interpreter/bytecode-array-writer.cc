@@ -18,6 +18,8 @@ BytecodeArrayWriter::BytecodeArrayWriter(
     : isolate_(isolate),
       bytecodes_(zone),
       max_register_count_(0),
+      register_operand_locations_(zone),
+      referenced_registers_(zone),
       unbound_jumps_(0),
       source_position_table_builder_(isolate, zone),
       constant_array_builder_(constant_array_builder) {
@@ -36,6 +38,10 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
 
   int bytecode_size = static_cast<int>(bytecodes()->size());
 
+  if (FLAG_ignition_compact_registers) {
+    CompactTemporaryRegisters(fixed_register_count, handler_table);
+  }
+
   // All locals need a frame slot for the debugger, but may not be
   // present in generated code.
   int frame_size_for_locals = fixed_register_count * kPointerSize;
@@ -94,17 +100,125 @@ void BytecodeArrayWriter::BindLabel(const BytecodeLabel& target,
   label->bind_to(target.offset());
 }
 
+namespace {
+
+// The debugger looks up break locations for these bytecodes by their (possibly
+// expression) source positions, so they always keep their entries.
+bool IsDebugBreakLocation(Bytecode bytecode) {
+  return Bytecodes::IsCallOrNew(bytecode) || bytecode == Bytecode::kReturn ||
+         bytecode == Bytecode::kDebugger;
+}
+
+}  // namespace
+
 void BytecodeArrayWriter::UpdateSourcePositionTable(
     const BytecodeNode* const node) {
   int bytecode_offset = static_cast<int>(bytecodes()->size());
   const BytecodeSourceInfo& source_info = node->source_info();
   if (source_info.is_valid()) {
+    // An expression position that repeats the previously recorded source
+    // position doesn't change the result of any position lookup.
+    if (FLAG_ignition_elide_redundant_positions &&
+        !source_info.is_statement() &&
+        !IsDebugBreakLocation(node->bytecode()) &&
+        source_position_table_builder()->IsCurrentPosition(
+            source_info.source_position())) {
+      return;
+    }
     source_position_table_builder()->AddPosition(bytecode_offset,
                                                  source_info.source_position(),
                                                  source_info.is_statement());
   }
 }
 
+void BytecodeArrayWriter::RecordRegisterOperand(size_t operand_offset,
+                                                OperandSize operand_size,
+                                                Register reg, int count) {
+  max_register_count_ = std::max(max_register_count_, reg.index() + count);
+  if (!FLAG_ignition_compact_registers || reg.index() < 0 || count == 0) {
+    return;
+  }
+  register_operand_locations_.push_back({operand_offset, operand_size});
+  if (referenced_registers_.size() < static_cast<size_t>(max_register_count_)) {
+    referenced_registers_.resize(max_register_count_, false);
+  }
+  for (int i = 0; i < count; ++i) {
+    referenced_registers_[reg.index() + i] = true;
+  }
+}
+
+void BytecodeArrayWriter::CompactTemporaryRegisters(
+    int fixed_register_count, Handle<FixedArray> handler_table) {
+  // Temporaries that were allocated but never made it into the bytecode
+  // (e.g. because the register optimizer replaced them with an equivalent
+  // register) leave holes in the frame. Renumber the referenced temporaries
+  // downwards to close those holes. Register operands only ever get smaller
+  // in magnitude, so every operand still fits in its original width and no
+  // bytecode, jump offset or source position moves. Register ranges (pairs,
+  // triples and lists) are contiguous and fully referenced, so they stay
+  // contiguous after renumbering.
+  int register_count = static_cast<int>(referenced_registers_.size());
+  if (register_count <= fixed_register_count) return;
+  ZoneVector<int> new_index(register_count, 0,
+                            bytecodes()->get_allocator().zone());
+  int next_index = fixed_register_count;
+  for (int i = fixed_register_count; i < register_count; ++i) {
+    new_index[i] = next_index;
+    if (referenced_registers_[i]) next_index++;
+  }
+  if (next_index == max_register_count()) return;
+
+  for (const RegisterOperandLocation& location : register_operand_locations_) {
+    uint8_t* operand_start = &bytecodes()->at(location.offset);
+    int32_t operand;
+    switch (location.size) {
+      case OperandSize::kByte:
+        operand = static_cast<int8_t>(*operand_start);
+        break;
+      case OperandSize::kShort:
+        operand = static_cast<int16_t>(ReadUnalignedUInt16(operand_start));
+        break;
+      case OperandSize::kQuad:
+        operand = static_cast<int32_t>(ReadUnalignedUInt32(operand_start));
+        break;
+      case OperandSize::kNone:
+        UNREACHABLE();
+        return;
+    }
+    Register reg = Register::FromOperand(operand);
+    // Empty register lists may name a register beyond the frame.
+    if (reg.index() < fixed_register_count || reg.index() >= register_count) {
+      continue;
+    }
+    uint32_t new_operand = Register(new_index[reg.index()]).ToOperand();
+    switch (location.size) {
+      case OperandSize::kByte:
+        *operand_start = static_cast<uint8_t>(new_operand);
+        break;
+      case OperandSize::kShort:
+        WriteUnalignedUInt16(operand_start, static_cast<uint16_t>(new_operand));
+        break;
+      case OperandSize::kQuad:
+        WriteUnalignedUInt32(operand_start, new_operand);
+        break;
+      case OperandSize::kNone:
+        UNREACHABLE();
+        break;
+    }
+  }
+
+  // Handlers restore the context from a register that is usually a temporary.
+  HandlerTable* table = HandlerTable::cast(*handler_table);
+  for (int i = 0; i < table->NumberOfRangeEntries(); ++i) {
+    int context_register = table->GetRangeData(i);
+    if (context_register >= fixed_register_count &&
+        context_register < register_count) {
+      table->SetRangeData(i, new_index[context_register]);
+    }
+  }
+  max_register_count_ = next_index;
+}
+
 namespace {
 
 OperandScale ScaleForScalableByteOperand(OperandSize operand_size) {
@@ -178,6 +292,7 @@ void BytecodeArrayWriter::EmitBytecode(const BytecodeNode* const node) {
   const OperandType* operand_types = Bytecodes::GetOperandTypes(bytecode);
   for (int i = 0; operand_types[i] != OperandType::kNone; ++i) {
     OperandType operand_type = operand_types[i];
+    size_t operand_offset = bytecodes()->size();
     switch (operand_sizes[i]) {
       case OperandSize::kNone:
         UNREACHABLE();
@@ -209,7 +324,7 @@ void BytecodeArrayWriter::EmitBytecode(const BytecodeNode* const node) {
         count = Bytecodes::GetNumberOfRegistersRepresentedBy(operand_type);
       }
       Register reg = Register::FromOperand(static_cast<int32_t>(operands[i]));
-      max_register_count_ = std::max(max_register_count_, reg.index() + count);
+      RecordRegisterOperand(operand_offset, operand_sizes[i], reg, count);
     }
   }
 }
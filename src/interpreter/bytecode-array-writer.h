@@ -51,6 +51,10 @@ class BytecodeArrayWriter final : public BytecodePipelineStage {
   void EmitBytecode(const BytecodeNode* const node);
   void EmitJump(BytecodeNode* node, BytecodeLabel* label);
   void UpdateSourcePositionTable(const BytecodeNode* const node);
+  void RecordRegisterOperand(size_t operand_offset, OperandSize operand_size,
+                             Register reg, int count);
+  void CompactTemporaryRegisters(int fixed_register_count,
+                                 Handle<FixedArray> handler_table);
 
   Isolate* isolate() { return isolate_; }
   ZoneVector<uint8_t>* bytecodes() { return &bytecodes_; }
@@ -62,9 +66,17 @@ class BytecodeArrayWriter final : public BytecodePipelineStage {
   }
   int max_register_count() { return max_register_count_; }
 
+  // Location of a register operand in the emitted bytecode.
+  struct RegisterOperandLocation {
+    size_t offset;
+    OperandSize size;
+  };
+
   Isolate* isolate_;
   ZoneVector<uint8_t> bytecodes_;
   int max_register_count_;
+  ZoneVector<RegisterOperandLocation> register_operand_locations_;
+  ZoneVector<bool> referenced_registers_;
   int unbound_jumps_;
   SourcePositionTableBuilder source_position_table_builder_;
   ConstantArrayBuilder* constant_array_builder_;
@@ -295,11 +295,11 @@ class BytecodeGenerator::ControlScopeForTryCatch final
  public:
   ControlScopeForTryCatch(BytecodeGenerator* generator,
                           TryCatchBuilder* try_catch_builder)
-      : ControlScope(generator) {
-    generator->try_catch_nesting_level_++;
+      : ControlScope(generator), will_catch_(try_catch_builder->will_catch()) {
+    if (will_catch_) generator->try_catch_nesting_level_++;
   }
   virtual ~ControlScopeForTryCatch() {
-    generator()->try_catch_nesting_level_--;
+    if (will_catch_) generator()->try_catch_nesting_level_--;
   }
 
  protected:
@@ -315,6 +315,9 @@ class BytecodeGenerator::ControlScopeForTryCatch final
     }
     return false;
   }
+
+ private:
+  bool will_catch_;
 };
 
 // Scoped class for enabling control flow through try-finally constructs.
@@ -1196,7 +1199,10 @@ void BytecodeGenerator::VisitForOfStatement(ForOfStatement* stmt) {
 }
 
 void BytecodeGenerator::VisitTryCatchStatement(TryCatchStatement* stmt) {
-  TryCatchBuilder try_control_builder(builder());
+  // Catch blocks that keep the pending message are known to rethrow and are
+  // not predicted to catch.
+  TryCatchBuilder try_control_builder(builder(),
+                                      stmt->clear_pending_message());
   Register no_reg;
 
   // Preserve the context in a dedicated register, so that it can be restored
@@ -144,17 +144,24 @@ class SwitchBuilder final : public BreakableControlFlowBuilder {
 // A class to help with co-ordinating control flow in try-catch statements.
 class TryCatchBuilder final : public ControlFlowBuilder {
  public:
-  explicit TryCatchBuilder(BytecodeArrayBuilder* builder)
-      : ControlFlowBuilder(builder), handler_id_(builder->NewHandlerEntry()) {}
+  TryCatchBuilder(BytecodeArrayBuilder* builder, bool will_catch)
+      : ControlFlowBuilder(builder),
+        handler_id_(builder->NewHandlerEntry()),
+        will_catch_(will_catch) {}
 
   void BeginTry(Register context);
   void EndTry();
   void EndCatch();
 
+  bool will_catch() const { return will_catch_; }
+
  private:
   int handler_id_;
   BytecodeLabel handler_;
   BytecodeLabel exit_;
+
+  // False for catch blocks that are known to rethrow the exception.
+  bool will_catch_;
 };
 
 
@@ -628,6 +628,25 @@ void InterpreterAssembler::UpdateInterruptBudgetOnReturn() {
       Int32Sub(Int32Constant(kHeapObjectTag + BytecodeArray::kHeaderSize),
                BytecodeOffset());
   UpdateInterruptBudget(profiling_weight);
+
+  // Returning from the function makes its bytecode young again. Only store
+  // when the bytecode has aged, so most returns don't write to the array.
+  Node* age_offset =
+      IntPtrConstant(BytecodeArray::kBytecodeAgeOffset - kHeapObjectTag);
+  Node* age_field =
+      Load(MachineType::Int32(), BytecodeArrayTaggedPointer(), age_offset);
+  Node* age =
+      Word32And(age_field, Int32Constant(BytecodeArray::AgeBits::kMask));
+  Label reset_age(this, Label::kDeferred), done(this);
+  BranchIfWord32Equal(age, Int32Constant(0), &done, &reset_age);
+
+  Bind(&reset_age);
+  StoreNoWriteBarrier(MachineRepresentation::kWord32,
+                      BytecodeArrayTaggedPointer(), age_offset,
+                      Int32Constant(0));
+  Goto(&done);
+
+  Bind(&done);
 }
 
 Node* InterpreterAssembler::StackCheckTriggeredInterrupt() {
@@ -130,7 +130,8 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Returns true if the stack guard check triggers an interrupt.
   compiler::Node* StackCheckTriggeredInterrupt();
 
-  // Updates the profiler interrupt budget for a return.
+  // Updates the profiler interrupt budget and resets the bytecode age for a
+  // return.
   void UpdateInterruptBudgetOnReturn();
 
   // Dispatch to the bytecode.
@@ -167,6 +167,11 @@ bool Interpreter::MakeBytecode(CompilationInfo* info) {
 
   if (generator.HasStackOverflow()) return false;
 
+  TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.zone_stats"),
+                       "V8.IgnitionZoneUsage", TRACE_EVENT_SCOPE_THREAD,
+                       "allocated_bytes",
+                       static_cast<uint64_t>(info->zone()->allocation_size()));
+
   if (FLAG_print_bytecode) {
     OFStream os(stdout);
     bytecodes->Print(os);
@@ -611,16 +616,61 @@ void Interpreter::DoLdrNamedProperty(InterpreterAssembler* assembler) {
 
 Node* Interpreter::BuildLoadKeyedProperty(Callable ic,
                                           InterpreterAssembler* assembler) {
-  Node* code_target = __ HeapConstant(ic.code());
   Node* reg_index = __ BytecodeOperandReg(0);
   Node* object = __ LoadRegister(reg_index);
   Node* name = __ GetAccumulator();
   Node* raw_slot = __ BytecodeOperandIdx(1);
-  Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
-  Node* context = __ GetContext();
-  return __ CallStub(ic.descriptor(), code_target, context, object, name,
-                     smi_slot, type_feedback_vector);
+
+  Variable var_result(assembler, MachineRepresentation::kTagged);
+  Label if_ic(assembler), end(assembler);
+
+  // Fast path for monomorphic loads of in-bounds elements from receivers with
+  // packed smi or object elements. The KeyedLoadIC would dispatch to the
+  // same handler anyway, so skipping it here doesn't lose any feedback.
+  __ GotoIf(__ WordIsSmi(object), &if_ic);
+  __ GotoUnless(__ WordIsPositiveSmi(name), &if_ic);
+  Node* map = __ LoadMap(object);
+  Node* feedback = __ LoadFixedArrayElement(type_feedback_vector, raw_slot);
+  // It is safe to look at WeakCell::kValueOffset even if {feedback} is not a
+  // WeakCell, see CodeStubAssembler::TryMonomorphicCase.
+  __ GotoUnless(__ WordEqual(map, __ LoadWeakCellValue(feedback)), &if_ic);
+  Node* bit_field = __ LoadMapBitField(map);
+  int const mask =
+      1 << Map::kHasIndexedInterceptor | 1 << Map::kIsAccessCheckNeeded;
+  __ GotoUnless(__ Word32Equal(__ Word32And(bit_field, __ Int32Constant(mask)),
+                               __ Int32Constant(0)),
+                &if_ic);
+  Node* elements_kind =
+      __ BitFieldDecode<Map::ElementsKindBits>(__ LoadMapBitField2(map));
+  __ GotoUnless(
+      __ Word32Or(
+          __ Word32Equal(elements_kind, __ Int32Constant(FAST_SMI_ELEMENTS)),
+          __ Word32Equal(elements_kind, __ Int32Constant(FAST_ELEMENTS))),
+      &if_ic);
+  Node* elements = __ LoadElements(object);
+  __ GotoUnless(__ SmiLessThan(name, __ LoadFixedArrayBaseLength(elements)),
+                &if_ic);
+  Node* value = __ LoadFixedArrayElement(elements, name, 0,
+                                         CodeStubAssembler::SMI_PARAMETERS);
+  // The backing store of a packed JSArray is filled with holes beyond its
+  // length, which need to be handled by the IC.
+  __ GotoIf(__ WordEqual(value, __ TheHoleConstant()), &if_ic);
+  var_result.Bind(value);
+  __ Goto(&end);
+
+  __ Bind(&if_ic);
+  {
+    Node* code_target = __ HeapConstant(ic.code());
+    Node* smi_slot = __ SmiTag(raw_slot);
+    Node* context = __ GetContext();
+    var_result.Bind(__ CallStub(ic.descriptor(), code_target, context, object,
+                                name, smi_slot, type_feedback_vector));
+    __ Goto(&end);
+  }
+
+  __ Bind(&end);
+  return var_result.value();
 }
 
 // KeyedLoadIC <object> <slot>
@@ -47,6 +47,10 @@ class SourcePositionTableBuilder final : public PositionsRecorder {
 
   void AddPosition(size_t bytecode_offset, int source_position,
                    bool is_statement);
+  // Returns true if {source_position} is the most recently added position.
+  bool IsCurrentPosition(int source_position) const {
+    return !bytes_.empty() && previous_.source_position == source_position;
+  }
   Handle<ByteArray> ToSourcePositionTable();
 
  private:
@@ -358,11 +358,8 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
                                                 Handle<Object> caller) {
   // Get stack trace limit.
   Handle<JSObject> error = error_function();
-  Handle<String> stackTraceLimit =
-      factory()->InternalizeUtf8String("stackTraceLimit");
-  DCHECK(!stackTraceLimit.is_null());
-  Handle<Object> stack_trace_limit =
-      JSReceiver::GetDataProperty(error, stackTraceLimit);
+  Handle<Object> stack_trace_limit = JSReceiver::GetDataProperty(
+      error, factory()->stackTraceLimit_string());
   if (!stack_trace_limit->IsNumber()) return factory()->undefined_value();
   int limit = FastD2IChecked(stack_trace_limit->Number());
   limit = Max(limit, 0);  // Ensure that limit is not negative.
@@ -379,6 +376,10 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
   int frames_seen = 0;
   int sloppy_frames = 0;
   bool encountered_strict_function = false;
+  // Set initial size to the maximum inlining level + 1 for the outermost
+  // function. The list is reused for all frames, so that capturing a stack
+  // trace does not allocate once per frame.
+  List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
   for (StackFrameIterator iter(this); !iter.done() && frames_seen < limit;
        iter.Advance()) {
     StackFrame* frame = iter.frame();
@@ -389,9 +390,7 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
       case StackFrame::INTERPRETED:
       case StackFrame::BUILTIN: {
         JavaScriptFrame* js_frame = JavaScriptFrame::cast(frame);
-        // Set initial size to the maximum inlining level + 1 for the outermost
-        // function.
-        List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
+        frames.Rewind(0);
         js_frame->Summarize(&frames);
         for (int i = frames.length() - 1; i >= 0; i--) {
           Handle<JSFunction> fun = frames[i].function();
@@ -1031,6 +1030,16 @@ Object* Isolate::Throw(Object* exception, MessageLocation* location) {
 
   thread_local_top()->rethrowing_message_ = false;
 
+  // 4) A JavaScript catch block is predicted to catch the exception before any
+  //    external v8::TryCatch sees it: No message, since entering the catch
+  //    block clears it again. Catch blocks that rethrow while keeping the
+  //    message are not predicted to catch.
+  if (requires_message && !rethrowing_message &&
+      is_catchable_by_javascript(exception) && !bootstrapper()->IsActive() &&
+      PredictCaughtByJavaScriptBeforeExternal()) {
+    requires_message = false;
+  }
+
   // Notify debugger of exception.
   if (is_catchable_by_javascript(exception)) {
     debug()->OnThrow(exception_handle);
@@ -1253,6 +1262,39 @@ Isolate::CatchType Isolate::PredictExceptionCatcher() {
 }
 
 
+bool Isolate::PredictCaughtByJavaScriptBeforeExternal() {
+  Address external_handler = thread_local_top()->try_catch_handler_address();
+  Address entry_handler = Isolate::handler(thread_local_top());
+  if (IsExternalHandlerOnTop(nullptr)) return false;
+
+  for (StackFrameIterator iter(this); !iter.done(); iter.Advance()) {
+    StackFrame* frame = iter.frame();
+
+    // For JSEntryStub frames we update the JS_ENTRY handler.
+    if (frame->is_entry() || frame->is_entry_construct()) {
+      entry_handler = frame->top_handler()->next()->address();
+    }
+
+    // For JavaScript frames we perform a lookup in the handler table.
+    if (frame->is_java_script()) {
+      JavaScriptFrame* js_frame = static_cast<JavaScriptFrame*>(frame);
+      HandlerTable::CatchPrediction prediction;
+      if (js_frame->LookupExceptionHandlerInTable(nullptr, &prediction) > 0) {
+        if (prediction == HandlerTable::CAUGHT) return true;
+      }
+    }
+
+    // Any external handler on top of the top-most JS_ENTRY handler sees the
+    // exception first, even a verbose one that does not stop it.
+    if (external_handler != nullptr &&
+        (entry_handler == nullptr || entry_handler > external_handler)) {
+      return false;
+    }
+  }
+  return false;
+}
+
+
 void Isolate::RemoveMaterializedObjectsOnUnwind(StackFrame* frame) {
   if (frame->is_optimized()) {
     bool removed = materialized_object_store_->Remove(frame->fp());
@@ -2288,6 +2330,8 @@ bool Isolate::Init(Deserializer* des) {
   // Quiet the heap NaN if needed on target platform.
   if (!create_heap_objects) Assembler::QuietNaN(heap_.nan_value());
 
+  if (FLAG_print_builtin_size) builtins_.PrintBuiltinSize();
+
   if (FLAG_trace_turbo) {
     // Create an empty file.
     std::ofstream(GetTurboCfgFileName().c_str(), std::ios_base::trunc);
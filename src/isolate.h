@@ -1245,6 +1245,11 @@ class Isolate {
   // then return true.
   bool PropagatePendingExceptionToExternalTryCatch();
 
+  // Returns true if a JavaScript handler is predicted to catch the exception
+  // before it reaches any external v8::TryCatch. Unlike
+  // PredictExceptionCatcher, this also stops at verbose external handlers.
+  bool PredictCaughtByJavaScriptBeforeExternal();
+
   // Remove per-frame stored materialized objects when we are unwinding
   // the frame.
   void RemoveMaterializedObjectsOnUnwind(StackFrame* frame);
@@ -25,6 +25,11 @@ utils.Import(function(from) {
 
 // -------------------------------------------------------------------
 
+// Scratch array the iterator runtime functions write the current entry
+// into. They do not call back into JavaScript, so a single array can be
+// shared, and only entries iteration needs to allocate an array per step.
+var iterator_value_array = [UNDEFINED, UNDEFINED];
+
 function SetIteratorConstructor(set, kind) {
   %SetIteratorInitialize(this, set, kind);
 }
@@ -36,21 +41,21 @@ function SetIteratorNextJS() {
                         'Set Iterator.prototype.next', this);
   }
 
-  var value_array = [UNDEFINED, UNDEFINED];
-  var result = %_CreateIterResultObject(value_array, false);
-  switch (%SetIteratorNext(this, value_array)) {
+  var result = %_CreateIterResultObject(UNDEFINED, false);
+  switch (%SetIteratorNext(this, iterator_value_array)) {
     case 0:
-      result.value = UNDEFINED;
       result.done = true;
       break;
     case ITERATOR_KIND_VALUES:
-      result.value = value_array[0];
+      result.value = iterator_value_array[0];
       break;
     case ITERATOR_KIND_ENTRIES:
-      value_array[1] = value_array[0];
+      result.value = [iterator_value_array[0], iterator_value_array[0]];
       break;
   }
 
+  // Do not keep the entry alive through the scratch array.
+  iterator_value_array[0] = UNDEFINED;
   return result;
 }
 
@@ -104,22 +109,25 @@ function MapIteratorNextJS() {
                         'Map Iterator.prototype.next', this);
   }
 
-  var value_array = [UNDEFINED, UNDEFINED];
-  var result = %_CreateIterResultObject(value_array, false);
-  switch (%MapIteratorNext(this, value_array)) {
+  var result = %_CreateIterResultObject(UNDEFINED, false);
+  switch (%MapIteratorNext(this, iterator_value_array)) {
     case 0:
-      result.value = UNDEFINED;
       result.done = true;
       break;
     case ITERATOR_KIND_KEYS:
-      result.value = value_array[0];
+      result.value = iterator_value_array[0];
       break;
     case ITERATOR_KIND_VALUES:
-      result.value = value_array[1];
+      result.value = iterator_value_array[1];
+      break;
+    case ITERATOR_KIND_ENTRIES:
+      result.value = [iterator_value_array[0], iterator_value_array[1]];
       break;
-    // ITERATOR_KIND_ENTRIES does not need any processing.
   }
 
+  // Do not keep the entry alive through the scratch array.
+  iterator_value_array[0] = UNDEFINED;
+  iterator_value_array[1] = UNDEFINED;
   return result;
 }
 
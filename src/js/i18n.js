@@ -1988,10 +1988,27 @@ var defaultObjects = {
   'dateformattime': UNDEFINED,
 };
 
+// Instances created with a single locale string and no options, keyed by
+// the locale string. Only a few distinct locales are cached per service.
+var MAX_LOCALE_OBJECTS = 16;
+
+function newLocaleObjects() {
+  return {
+    'collator': {cache: {}, size: 0},
+    'numberformat': {cache: {}, size: 0},
+    'dateformatall': {cache: {}, size: 0},
+    'dateformatdate': {cache: {}, size: 0},
+    'dateformattime': {cache: {}, size: 0},
+  };
+}
+
+var localeObjects = newLocaleObjects();
+
 function clearDefaultObjects() {
   defaultObjects['dateformatall'] = UNDEFINED;
   defaultObjects['dateformatdate'] = UNDEFINED;
   defaultObjects['dateformattime'] = UNDEFINED;
+  localeObjects = newLocaleObjects();
 }
 
 var date_cache_version = 0;
@@ -2008,16 +2025,33 @@ function checkDateCacheCurrent() {
 
 /**
  * Returns cached or newly created instance of a given service.
- * We cache only default instances (where no locales or options are provided).
+ * We cache only instances where no options are provided, and the locales
+ * are either not provided or a single locale string.
  */
 function cachedOrNewService(service, locales, options, defaults) {
   var useOptions = (IS_UNDEFINED(defaults)) ? options : defaults;
-  if (IS_UNDEFINED(locales) && IS_UNDEFINED(options)) {
-    checkDateCacheCurrent();
-    if (IS_UNDEFINED(defaultObjects[service])) {
-      defaultObjects[service] = new savedObjects[service](locales, useOptions);
+  if (IS_UNDEFINED(options)) {
+    if (IS_UNDEFINED(locales)) {
+      checkDateCacheCurrent();
+      if (IS_UNDEFINED(defaultObjects[service])) {
+        defaultObjects[service] =
+            new savedObjects[service](locales, useOptions);
+      }
+      return defaultObjects[service];
+    }
+    if (IS_STRING(locales)) {
+      checkDateCacheCurrent();
+      var objects = localeObjects[service];
+      if (HAS_OWN_PROPERTY(objects.cache, locales)) {
+        return objects.cache[locales];
+      }
+      var object = new savedObjects[service](locales, useOptions);
+      if (objects.size < MAX_LOCALE_OBJECTS) {
+        %AddNamedProperty(objects.cache, locales, object, NONE);
+        objects.size++;
+      }
+      return object;
     }
-    return defaultObjects[service];
   }
   return new savedObjects[service](locales, useOptions);
 }
@@ -114,6 +114,9 @@ JsonParser<seq_one_byte>::JsonParser(Isolate* isolate, Handle<String> source)
   // Optimized fast case where we only have Latin1 characters.
   if (seq_one_byte) {
     seq_source_ = Handle<SeqOneByteString>::cast(source_);
+    if (source_length_ >= kTransitionCacheMinSourceLength) {
+      transition_cache_ = factory()->NewFixedArray(2 * kTransitionCacheSize);
+    }
   }
 }
 
@@ -199,6 +202,42 @@ void JsonParser<seq_one_byte>::SkipWhitespace() {
   }
 }
 
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::AdvanceOverPlainOneByteChars() {
+  DCHECK(seq_one_byte);
+  DisallowHeapAllocation no_gc;
+  const uint8_t* chars = seq_source_->GetChars();
+  int position = position_;
+
+  // Skip eight characters at a time while none of them is special. Each
+  // zero byte test may report extra candidates, never fewer.
+  const uint64_t kLowBits = V8_UINT64_C(0x0101010101010101);
+  const uint64_t kHighBits = V8_UINT64_C(0x8080808080808080);
+  const uint64_t kQuotes = kLowBits * '"';
+  const uint64_t kBackslashes = kLowBits * '\\';
+  const uint64_t kFirstNonControl = kLowBits * 0x20;
+  const int kWordSize = static_cast<int>(sizeof(uint64_t));
+  while (position <= source_length_ - kWordSize) {
+    uint64_t word;
+    memcpy(&word, chars + position, kWordSize);
+    uint64_t quotes = word ^ kQuotes;
+    uint64_t backslashes = word ^ kBackslashes;
+    uint64_t special = ((quotes - kLowBits) & ~quotes) |
+                       ((backslashes - kLowBits) & ~backslashes) |
+                       ((word - kFirstNonControl) & ~word);
+    if ((special & kHighBits) != 0) break;
+    position += kWordSize;
+  }
+  while (position < source_length_) {
+    uint8_t c = chars[position];
+    if (c == '"' || c == '\\' || c < 0x20) break;
+    position++;
+  }
+
+  position_ = position;
+  c0_ = position < source_length_ ? chars[position] : kEndOfString;
+}
+
 template <bool seq_one_byte>
 uc32 JsonParser<seq_one_byte>::AdvanceGetChar() {
   Advance();
@@ -366,12 +405,20 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       Handle<Map> target;
       if (seq_one_byte) {
         key = TransitionArray::ExpectedTransitionKey(map);
-        follow_expected = !key.is_null() && ParseJsonString(key);
+        if (!key.is_null()) {
+          follow_expected = ParseJsonString(key);
+          // If the expected transition hits, follow it.
+          if (follow_expected) {
+            target = TransitionArray::ExpectedTransitionTarget(map);
+          }
+        } else {
+          // The map has several transitions; try the one the last object
+          // parsed from this map took.
+          target = LookupCachedTransition(map, &key);
+          follow_expected = !target.is_null() && ParseJsonString(key);
+        }
       }
-      // If the expected transition hits, follow it.
-      if (follow_expected) {
-        target = TransitionArray::ExpectedTransitionTarget(map);
-      } else {
+      if (!follow_expected) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
         key = ParseJsonInternalizedString();
@@ -380,6 +427,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
         target = TransitionArray::FindTransitionToField(map, key);
         // If a transition was found, follow it and continue.
         transitioning = !target.is_null();
+        if (transitioning) CacheTransition(map, target);
       }
       if (c0_ != ':') return ReportUnexpectedCharacter();
 
@@ -486,6 +534,41 @@ void JsonParser<seq_one_byte>::CommitStateToJsonObject(
   }
 }
 
+template <bool seq_one_byte>
+int JsonParser<seq_one_byte>::TransitionCacheIndex(Map* map) {
+  uintptr_t address = reinterpret_cast<uintptr_t>(map);
+  return 2 * static_cast<int>((address >> kPointerSizeLog2) &
+                              (kTransitionCacheSize - 1));
+}
+
+template <bool seq_one_byte>
+Handle<Map> JsonParser<seq_one_byte>::LookupCachedTransition(
+    Handle<Map> map, Handle<String>* key) {
+  if (transition_cache_.is_null()) return Handle<Map>::null();
+  DisallowHeapAllocation no_gc;
+  int index = TransitionCacheIndex(*map);
+  if (transition_cache_->get(index) != *map) return Handle<Map>::null();
+  Map* target = Map::cast(transition_cache_->get(index + 1));
+  // Field generalization replaces transition targets with new maps, so only
+  // use targets that are still current.
+  if (target->is_deprecated() || target->GetBackPointer() != *map) {
+    return Handle<Map>::null();
+  }
+  Name* name = target->instance_descriptors()->GetKey(target->LastAdded());
+  if (!name->IsString()) return Handle<Map>::null();
+  *key = handle(String::cast(name), isolate());
+  return handle(target, isolate());
+}
+
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::CacheTransition(Handle<Map> map,
+                                               Handle<Map> target) {
+  if (transition_cache_.is_null()) return;
+  int index = TransitionCacheIndex(*map);
+  transition_cache_->set(index, *map);
+  transition_cache_->set(index + 1, *target);
+}
+
 // Parse a JSON array. Position must be right at '['.
 template <bool seq_one_byte>
 Handle<Object> JsonParser<seq_one_byte>::ParseJsonArray() {
@@ -777,21 +860,31 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
 
   int beg_pos = position_;
   // Fast case for Latin1 only without escape characters.
-  do {
-    // Check for control character (0x00-0x1f) or unterminated string (<0).
-    if (c0_ < 0x20) return Handle<String>::null();
-    if (c0_ != '\\') {
-      if (seq_one_byte || c0_ <= String::kMaxOneByteCharCode) {
-        Advance();
-      } else {
-        return SlowScanJsonString<SeqTwoByteString, uc16>(source_, beg_pos,
-                                                          position_);
-      }
-    } else {
+  if (seq_one_byte) {
+    AdvanceOverPlainOneByteChars();
+    if (c0_ == '\\') {
       return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+    // Check for control character (0x00-0x1f) or unterminated string (<0).
+    if (c0_ != '"') return Handle<String>::null();
+  } else {
+    do {
+      // Check for control character (0x00-0x1f) or unterminated string (<0).
+      if (c0_ < 0x20) return Handle<String>::null();
+      if (c0_ != '\\') {
+        if (c0_ <= String::kMaxOneByteCharCode) {
+          Advance();
+        } else {
+          return SlowScanJsonString<SeqTwoByteString, uc16>(source_, beg_pos,
+                                                            position_);
+        }
+      } else {
+        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                             position_);
+      }
+    } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
@@ -66,6 +66,10 @@ class JsonParser BASE_EMBEDDED {
   INLINE(void SkipWhitespace());
   INLINE(uc32 AdvanceGetChar());
 
+  // Advances to the next '"', '\\' or control character (or the end of the
+  // source) inside a string. Only used for sequential one-byte sources.
+  INLINE(void AdvanceOverPlainOneByteChars());
+
   // Checks that current charater is c.
   // If so, then consume c and skip whitespace.
   INLINE(bool MatchSkipWhiteSpace(uc32 c));
@@ -139,6 +143,10 @@ class JsonParser BASE_EMBEDDED {
 
   static const int kInitialSpecialStringLength = 32;
   static const int kPretenureTreshold = 100 * 1024;
+  // Sources shorter than this do not get a transition cache.
+  static const int kTransitionCacheMinSourceLength = 256;
+  // Number of (map, target) entries in the transition cache.
+  static const int kTransitionCacheSize = 32;
 
  private:
   Zone* zone() { return &zone_; }
@@ -146,6 +154,14 @@ class JsonParser BASE_EMBEDDED {
   void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
                                ZoneList<Handle<Object> >* properties);
 
+  // The transition cache remembers, per map, the field transition the last
+  // object parsed from that map took. This lets objects with the same keys
+  // guess their next key even when the map has several transitions, for
+  // instance for nested records of different shapes.
+  Handle<Map> LookupCachedTransition(Handle<Map> map, Handle<String>* key);
+  void CacheTransition(Handle<Map> map, Handle<Map> target);
+  int TransitionCacheIndex(Map* map);
+
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
@@ -155,6 +171,8 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  // Pairs of maps and field transition targets, or null if disabled.
+  Handle<FixedArray> transition_cache_;
   uc32 c0_;
   int position_;
 };
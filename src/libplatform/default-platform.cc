@@ -17,22 +17,48 @@ namespace v8 {
 namespace platform {
 
 
-v8::Platform* CreateDefaultPlatform(int thread_pool_size) {
-  DefaultPlatform* platform = new DefaultPlatform();
+v8::Platform* CreateDefaultPlatform(int thread_pool_size,
+                                    IdleTaskSupport idle_task_support) {
+  DefaultPlatform* platform = new DefaultPlatform(idle_task_support);
   platform->SetThreadPoolSize(thread_pool_size);
   platform->EnsureInitialized();
   return platform;
 }
 
 
-bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate) {
-  return reinterpret_cast<DefaultPlatform*>(platform)->PumpMessageLoop(isolate);
+bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate,
+                     MessageLoopBehavior behavior) {
+  return reinterpret_cast<DefaultPlatform*>(platform)->PumpMessageLoop(
+      isolate, behavior);
+}
+
+
+void RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                  double idle_time_in_seconds) {
+  reinterpret_cast<DefaultPlatform*>(platform)->RunIdleTasks(
+      isolate, idle_time_in_seconds);
+}
+
+
+void StartTracing(v8::Platform* platform, const char* categories) {
+  reinterpret_cast<DefaultPlatform*>(platform)->trace_buffer()->Start(
+      categories);
+}
+
+
+void StopTracing(v8::Platform* platform, std::ostream& stream) {
+  TraceBuffer* trace_buffer =
+      reinterpret_cast<DefaultPlatform*>(platform)->trace_buffer();
+  trace_buffer->Stop();
+  trace_buffer->WriteJSON(stream);
 }
 
 const int DefaultPlatform::kMaxThreadPoolSize = 8;
 
-DefaultPlatform::DefaultPlatform()
-    : initialized_(false), thread_pool_size_(0) {}
+DefaultPlatform::DefaultPlatform(IdleTaskSupport idle_task_support)
+    : initialized_(false),
+      thread_pool_size_(0),
+      idle_task_support_(idle_task_support) {}
 
 
 DefaultPlatform::~DefaultPlatform() {
@@ -57,6 +83,13 @@ DefaultPlatform::~DefaultPlatform() {
       i->second.pop();
     }
   }
+  for (auto i = main_thread_idle_queue_.begin();
+       i != main_thread_idle_queue_.end(); ++i) {
+    while (!i->second.empty()) {
+      delete i->second.front();
+      i->second.pop();
+    }
+  }
 }
 
 
@@ -107,22 +140,55 @@ Task* DefaultPlatform::PopTaskInMainThreadDelayedQueue(v8::Isolate* isolate) {
 }
 
 
-bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
+IdleTask* DefaultPlatform::PopTaskInMainThreadIdleQueue(v8::Isolate* isolate) {
+  auto it = main_thread_idle_queue_.find(isolate);
+  if (it == main_thread_idle_queue_.end() || it->second.empty()) {
+    return NULL;
+  }
+  IdleTask* task = it->second.front();
+  it->second.pop();
+  return task;
+}
+
+
+double DefaultPlatform::TimeUntilNextDelayedTask(v8::Isolate* isolate) {
+  auto it = main_thread_delayed_queue_.find(isolate);
+  if (it == main_thread_delayed_queue_.end() || it->second.empty()) {
+    return -1;
+  }
+  return std::max(it->second.top().first - MonotonicallyIncreasingTime(), 0.0);
+}
+
+
+bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate,
+                                      MessageLoopBehavior behavior) {
   Task* task = NULL;
   {
     base::LockGuard<base::Mutex> guard(&lock_);
 
-    // Move delayed tasks that hit their deadline to the main queue.
-    task = PopTaskInMainThreadDelayedQueue(isolate);
-    while (task != NULL) {
-      main_thread_queue_[isolate].push(task);
+    for (;;) {
+      // Move delayed tasks that hit their deadline to the main queue.
       task = PopTaskInMainThreadDelayedQueue(isolate);
-    }
-
-    task = PopTaskInMainThreadQueue(isolate);
-
-    if (task == NULL) {
-      return false;
+      while (task != NULL) {
+        main_thread_queue_[isolate].push(task);
+        task = PopTaskInMainThreadDelayedQueue(isolate);
+      }
+
+      task = PopTaskInMainThreadQueue(isolate);
+
+      if (task != NULL) break;
+      if (behavior == MessageLoopBehavior::kDoNotWait) return false;
+
+      // Sleep until a task is posted or the next delayed task is due.
+      double wait_in_seconds = TimeUntilNextDelayedTask(isolate);
+      if (wait_in_seconds < 0) {
+        foreground_task_posted_.Wait(&lock_);
+      } else {
+        base::TimeDelta wait = base::TimeDelta::FromMicroseconds(
+            static_cast<int64_t>(wait_in_seconds *
+                                 base::Time::kMicrosecondsPerSecond));
+        USE(foreground_task_posted_.WaitFor(&lock_, wait));
+      }
     }
   }
   task->Run();
@@ -131,16 +197,35 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
 }
 
 
+void DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
+                                   double idle_time_in_seconds) {
+  DCHECK(idle_task_support_ == IdleTaskSupport::kEnabled);
+  double deadline_in_seconds =
+      MonotonicallyIncreasingTime() + idle_time_in_seconds;
+  while (deadline_in_seconds > MonotonicallyIncreasingTime()) {
+    IdleTask* task;
+    {
+      base::LockGuard<base::Mutex> guard(&lock_);
+      task = PopTaskInMainThreadIdleQueue(isolate);
+    }
+    if (task == NULL) return;
+    task->Run(deadline_in_seconds);
+    delete task;
+  }
+}
+
+
 void DefaultPlatform::CallOnBackgroundThread(Task *task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
-  queue_.Append(task);
+  queue_.Append(task, expected_runtime);
 }
 
 
 void DefaultPlatform::CallOnForegroundThread(v8::Isolate* isolate, Task* task) {
   base::LockGuard<base::Mutex> guard(&lock_);
   main_thread_queue_[isolate].push(task);
+  foreground_task_posted_.NotifyAll();
 }
 
 
@@ -150,16 +235,21 @@ void DefaultPlatform::CallDelayedOnForegroundThread(Isolate* isolate,
   base::LockGuard<base::Mutex> guard(&lock_);
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
   main_thread_delayed_queue_[isolate].push(std::make_pair(deadline, task));
+  foreground_task_posted_.NotifyAll();
 }
 
 
 void DefaultPlatform::CallIdleOnForegroundThread(Isolate* isolate,
                                                  IdleTask* task) {
-  UNREACHABLE();
+  DCHECK(idle_task_support_ == IdleTaskSupport::kEnabled);
+  base::LockGuard<base::Mutex> guard(&lock_);
+  main_thread_idle_queue_[isolate].push(task);
 }
 
 
-bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) { return false; }
+bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) {
+  return idle_task_support_ == IdleTaskSupport::kEnabled;
+}
 
 
 double DefaultPlatform::MonotonicallyIncreasingTime() {
@@ -173,24 +263,26 @@ uint64_t DefaultPlatform::AddTraceEvent(
     const char* scope, uint64_t id, uint64_t bind_id, int num_args,
     const char** arg_names, const uint8_t* arg_types,
     const uint64_t* arg_values, unsigned int flags) {
-  return 0;
+  return trace_buffer_.AddTraceEvent(phase, category_enabled_flag, name, scope,
+                                     id, bind_id, num_args, arg_names,
+                                     arg_types, arg_values, flags);
 }
 
 
 void DefaultPlatform::UpdateTraceEventDuration(
-    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {}
+    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
+  trace_buffer_.UpdateTraceEventDuration(category_enabled_flag, name, handle);
+}
 
 
 const uint8_t* DefaultPlatform::GetCategoryGroupEnabled(const char* name) {
-  static uint8_t no = 0;
-  return &no;
+  return trace_buffer_.GetCategoryGroupEnabled(name);
 }
 
 
 const char* DefaultPlatform::GetCategoryGroupName(
     const uint8_t* category_enabled_flag) {
-  static const char dummy[] = "dummy";
-  return dummy;
+  return trace_buffer_.GetCategoryGroupName(category_enabled_flag);
 }
 
 
@@ -10,10 +10,13 @@
 #include <queue>
 #include <vector>
 
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/libplatform/task-queue.h"
+#include "src/libplatform/trace-buffer.h"
 
 namespace v8 {
 namespace platform {
@@ -24,14 +27,21 @@ class WorkerThread;
 
 class DefaultPlatform : public Platform {
  public:
-  DefaultPlatform();
+  explicit DefaultPlatform(
+      IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled);
   virtual ~DefaultPlatform();
 
   void SetThreadPoolSize(int thread_pool_size);
 
   void EnsureInitialized();
 
-  bool PumpMessageLoop(v8::Isolate* isolate);
+  bool PumpMessageLoop(
+      v8::Isolate* isolate,
+      MessageLoopBehavior behavior = MessageLoopBehavior::kDoNotWait);
+
+  void RunIdleTasks(v8::Isolate* isolate, double idle_time_in_seconds);
+
+  TraceBuffer* trace_buffer() { return &trace_buffer_; }
 
   // v8::Platform implementation.
   size_t NumberOfAvailableBackgroundThreads() override;
@@ -61,8 +71,16 @@ class DefaultPlatform : public Platform {
 
   Task* PopTaskInMainThreadQueue(v8::Isolate* isolate);
   Task* PopTaskInMainThreadDelayedQueue(v8::Isolate* isolate);
+  IdleTask* PopTaskInMainThreadIdleQueue(v8::Isolate* isolate);
+
+  // Returns the time in seconds until the next delayed task for |isolate|
+  // is due, or a negative value if there is none.
+  double TimeUntilNextDelayedTask(v8::Isolate* isolate);
 
   base::Mutex lock_;
+  // Signalled whenever a foreground task is posted, to wake up a thread
+  // waiting in PumpMessageLoop.
+  base::ConditionVariable foreground_task_posted_;
   bool initialized_;
   int thread_pool_size_;
   std::vector<WorkerThread*> thread_pool_;
@@ -74,6 +92,10 @@ class DefaultPlatform : public Platform {
            std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
                                std::greater<DelayedEntry> > >
       main_thread_delayed_queue_;
+  std::map<v8::Isolate*, std::queue<IdleTask*> > main_thread_idle_queue_;
+  const IdleTaskSupport idle_task_support_;
+
+  TraceBuffer trace_buffer_;
 
   DISALLOW_COPY_AND_ASSIGN(DefaultPlatform);
 };
@@ -15,14 +15,20 @@ TaskQueue::TaskQueue() : process_queue_semaphore_(0), terminated_(false) {}
 TaskQueue::~TaskQueue() {
   base::LockGuard<base::Mutex> guard(&lock_);
   DCHECK(terminated_);
-  DCHECK(task_queue_.empty());
+  DCHECK(short_running_queue_.empty());
+  DCHECK(long_running_queue_.empty());
 }
 
 
-void TaskQueue::Append(Task* task) {
+void TaskQueue::Append(Task* task,
+                       Platform::ExpectedRuntime expected_runtime) {
   base::LockGuard<base::Mutex> guard(&lock_);
   DCHECK(!terminated_);
-  task_queue_.push(task);
+  if (expected_runtime == Platform::kLongRunningTask) {
+    long_running_queue_.push(task);
+  } else {
+    short_running_queue_.push(task);
+  }
   process_queue_semaphore_.Signal();
 }
 
@@ -31,9 +37,14 @@ Task* TaskQueue::GetNext() {
   for (;;) {
     {
       base::LockGuard<base::Mutex> guard(&lock_);
-      if (!task_queue_.empty()) {
-        Task* result = task_queue_.front();
-        task_queue_.pop();
+      if (!short_running_queue_.empty()) {
+        Task* result = short_running_queue_.front();
+        short_running_queue_.pop();
+        return result;
+      }
+      if (!long_running_queue_.empty()) {
+        Task* result = long_running_queue_.front();
+        long_running_queue_.pop();
         return result;
       }
       if (terminated_) {
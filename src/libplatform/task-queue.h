@@ -7,23 +7,24 @@
 
 #include <queue>
 
+#include "include/v8-platform.h"
 #include "src/base/macros.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/semaphore.h"
 
 namespace v8 {
-
-class Task;
-
 namespace platform {
 
+// Short running tasks, such as the parallel GC phases the main thread blocks
+// on, are handed out before any pending long running task.
 class TaskQueue {
  public:
   TaskQueue();
   ~TaskQueue();
 
   // Appends a task to the queue. The queue takes ownership of |task|.
-  void Append(Task* task);
+  void Append(Task* task, Platform::ExpectedRuntime expected_runtime =
+                              Platform::kShortRunningTask);
 
   // Returns the next task to process. Blocks if no task is available. Returns
   // NULL if the queue is terminated.
@@ -35,7 +36,8 @@ class TaskQueue {
  private:
   base::Semaphore process_queue_semaphore_;
   base::Mutex lock_;
-  std::queue<Task*> task_queue_;
+  std::queue<Task*> short_running_queue_;
+  std::queue<Task*> long_running_queue_;
   bool terminated_;
 
   DISALLOW_COPY_AND_ASSIGN(TaskQueue);
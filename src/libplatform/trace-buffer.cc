@@ -0,0 +1,340 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/trace-buffer.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cmath>
+#include <ostream>
+
+#include "src/base/logging.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+// These mirror the values in base/trace_event/common/trace_event_common.h and
+// src/tracing/trace-event.h, which libplatform cannot include.
+const uint8_t kEnabledForRecording = 1 << 0;
+const unsigned int kTraceEventFlagCopy = 1 << 0;
+const unsigned int kTraceEventFlagHasId = 1 << 1;
+const char kTraceEventPhaseComplete = 'X';
+
+enum TraceValueType {
+  kTraceValueTypeBool = 1,
+  kTraceValueTypeUint = 2,
+  kTraceValueTypeInt = 3,
+  kTraceValueTypeDouble = 4,
+  kTraceValueTypePointer = 5,
+  kTraceValueTypeString = 6,
+  kTraceValueTypeCopyString = 7
+};
+
+// Category group handed out once all slots are taken. It is never enabled.
+const char kCategoryGroupsExhausted[] = "__category_groups_exhausted";
+
+int64_t Now() {
+  return base::TimeTicks::HighResolutionNow().ToInternalValue();
+}
+
+void WriteJSONString(std::ostream& stream, const char* string) {
+  stream << '"';
+  for (const char* p = string; *p != '\0'; p++) {
+    switch (*p) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(*p) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x",
+                   static_cast<unsigned>(*p));
+          stream << escaped;
+        } else {
+          stream << *p;
+        }
+        break;
+    }
+  }
+  stream << '"';
+}
+
+void WriteHex(std::ostream& stream, uint64_t value) {
+  char buffer[24];
+  snprintf(buffer, sizeof(buffer), "\"0x%" PRIx64 "\"", value);
+  stream << buffer;
+}
+
+void WriteArgValue(std::ostream& stream, uint8_t type, uint64_t value) {
+  switch (type) {
+    case kTraceValueTypeBool:
+      stream << (value ? "true" : "false");
+      break;
+    case kTraceValueTypeUint:
+      stream << value;
+      break;
+    case kTraceValueTypeInt:
+      stream << static_cast<int64_t>(value);
+      break;
+    case kTraceValueTypeDouble: {
+      double number;
+      memcpy(&number, &value, sizeof(number));
+      if (std::isfinite(number)) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.17g", number);
+        stream << buffer;
+      } else {
+        // JSON has no literals for NaN and the infinities.
+        stream << (std::isnan(number) ? "\"NaN\""
+                                      : number > 0 ? "\"Infinity\""
+                                                   : "\"-Infinity\"");
+      }
+      break;
+    }
+    case kTraceValueTypePointer:
+      WriteHex(stream, value);
+      break;
+    case kTraceValueTypeString:
+    case kTraceValueTypeCopyString: {
+      const char* string = reinterpret_cast<const char*>(value);
+      WriteJSONString(stream, string != NULL ? string : "NULL");
+      break;
+    }
+    default:
+      stream << "\"<unsupported>\"";
+      break;
+  }
+}
+
+}  // namespace
+
+
+TraceBuffer::TraceBuffer(size_t capacity)
+    : capacity_(capacity), next_handle_(1), category_group_count_(1) {
+  DCHECK_LT(0u, capacity);
+  category_groups_[0] = kCategoryGroupsExhausted;
+  memset(category_group_enabled_, 0, sizeof(category_group_enabled_));
+}
+
+
+TraceBuffer::~TraceBuffer() {
+  for (int i = 1; i < category_group_count_; i++) {
+    free(const_cast<char*>(category_groups_[i]));
+  }
+}
+
+
+void TraceBuffer::Start(const char* categories) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  included_categories_.clear();
+  const char* start = categories;
+  while (true) {
+    const char* end = strchr(start, ',');
+    size_t length = end != NULL ? end - start : strlen(start);
+    if (length > 0) included_categories_.push_back(std::string(start, length));
+    if (end == NULL) break;
+    start = end + 1;
+  }
+  events_.clear();
+  events_.resize(capacity_);
+  for (int i = 1; i < category_group_count_; i++) {
+    category_group_enabled_[i] =
+        IsCategoryGroupEnabled(category_groups_[i]) ? kEnabledForRecording : 0;
+  }
+}
+
+
+void TraceBuffer::Stop() {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  included_categories_.clear();
+  for (int i = 1; i < category_group_count_; i++) {
+    category_group_enabled_[i] = 0;
+  }
+}
+
+
+bool TraceBuffer::IsCategoryGroupEnabled(const char* category_group) const {
+  const char* start = category_group;
+  while (true) {
+    while (*start == ' ') start++;
+    const char* end = strchr(start, ',');
+    size_t length = end != NULL ? end - start : strlen(start);
+    for (const std::string& category : included_categories_) {
+      if (category.length() == length &&
+          strncmp(category.c_str(), start, length) == 0) {
+        return true;
+      }
+    }
+    if (end == NULL) return false;
+    start = end + 1;
+  }
+}
+
+
+const uint8_t* TraceBuffer::GetCategoryGroupEnabled(const char* name) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  for (int i = 1; i < category_group_count_; i++) {
+    if (strcmp(category_groups_[i], name) == 0) {
+      return &category_group_enabled_[i];
+    }
+  }
+  if (category_group_count_ == kMaxCategoryGroups) {
+    return &category_group_enabled_[0];
+  }
+  int index = category_group_count_++;
+  category_groups_[index] = strdup(name);
+  category_group_enabled_[index] =
+      IsCategoryGroupEnabled(name) ? kEnabledForRecording : 0;
+  return &category_group_enabled_[index];
+}
+
+
+const char* TraceBuffer::GetCategoryGroupName(
+    const uint8_t* category_enabled_flag) {
+  ptrdiff_t index = category_enabled_flag - category_group_enabled_;
+  DCHECK(0 <= index && index < kMaxCategoryGroups);
+  return category_groups_[index];
+}
+
+
+uint64_t TraceBuffer::AddTraceEvent(
+    char phase, const uint8_t* category_enabled_flag, const char* name,
+    const char* scope, uint64_t id, uint64_t bind_id, int32_t num_args,
+    const char** arg_names, const uint8_t* arg_types,
+    const uint64_t* arg_values, unsigned int flags) {
+  int64_t timestamp = Now();
+  int tid = base::OS::GetCurrentThreadId();
+  base::LockGuard<base::Mutex> guard(&lock_);
+  if (events_.empty() || *category_enabled_flag == 0) return 0;
+
+  uint64_t handle = next_handle_++;
+  Event* event = &events_[(handle - 1) % capacity_];
+  event->handle = handle;
+  event->timestamp = timestamp;
+  event->duration = 0;
+  event->id = id;
+  event->bind_id = bind_id;
+  event->scope = scope;
+  event->category_enabled_flag = category_enabled_flag;
+  event->flags = flags;
+  event->tid = tid;
+  event->phase = phase;
+  event->num_args = static_cast<uint8_t>(num_args < kMaxArgs ? num_args
+                                                             : kMaxArgs);
+  for (int i = 0; i < event->num_args; i++) {
+    event->arg_types[i] = arg_types[i];
+    event->arg_names[i] = arg_names[i];
+    event->arg_values[i] = arg_values[i];
+  }
+
+  // Copy strings the caller does not guarantee to outlive the event. All
+  // copies go into one buffer that is only read after it is complete.
+  bool copy = (flags & kTraceEventFlagCopy) != 0;
+  std::string& copies = event->copies;
+  copies.clear();
+  if (copy) {
+    copies.append(name).push_back('\0');
+    for (int i = 0; i < event->num_args; i++) {
+      copies.append(arg_names[i]).push_back('\0');
+    }
+  }
+  for (int i = 0; i < event->num_args; i++) {
+    const char* value = reinterpret_cast<const char*>(arg_values[i]);
+    if (arg_types[i] == kTraceValueTypeCopyString && value != NULL) {
+      copies.append(value).push_back('\0');
+    }
+  }
+  const char* next = copies.c_str();
+  if (copy) {
+    event->name = next;
+    next += strlen(next) + 1;
+    for (int i = 0; i < event->num_args; i++) {
+      event->arg_names[i] = next;
+      next += strlen(next) + 1;
+    }
+  } else {
+    event->name = name;
+  }
+  for (int i = 0; i < event->num_args; i++) {
+    if (arg_types[i] == kTraceValueTypeCopyString && arg_values[i] != 0) {
+      event->arg_values[i] = reinterpret_cast<uint64_t>(next);
+      next += strlen(next) + 1;
+    }
+  }
+  return handle;
+}
+
+
+void TraceBuffer::UpdateTraceEventDuration(
+    const uint8_t* category_enabled_flag, const char* name, uint64_t handle) {
+  int64_t now = Now();
+  base::LockGuard<base::Mutex> guard(&lock_);
+  if (handle == 0 || events_.empty()) return;
+  Event* event = &events_[(handle - 1) % capacity_];
+  // The event may have been overwritten in the meantime.
+  if (event->handle != handle) return;
+  event->duration = now - event->timestamp;
+}
+
+
+void TraceBuffer::WriteJSON(std::ostream& stream) {
+  base::LockGuard<base::Mutex> guard(&lock_);
+  int pid = base::OS::GetCurrentProcessId();
+  stream << "{\"traceEvents\":[";
+  bool first = true;
+  // Slots are written in handle order, so the oldest surviving event is the
+  // one after the most recently written slot.
+  size_t start = events_.empty() ? 0 : (next_handle_ - 1) % capacity_;
+  for (size_t i = 0; i < events_.size(); i++) {
+    const Event& event = events_[(start + i) % events_.size()];
+    if (event.handle == 0) continue;
+    if (!first) stream << ",";
+    first = false;
+    stream << "{\"pid\":" << pid << ",\"tid\":" << event.tid
+           << ",\"ts\":" << event.timestamp << ",\"ph\":\"" << event.phase
+           << "\",\"cat\":";
+    WriteJSONString(stream, GetCategoryGroupName(event.category_enabled_flag));
+    stream << ",\"name\":";
+    WriteJSONString(stream, event.name);
+    if (event.phase == kTraceEventPhaseComplete) {
+      stream << ",\"dur\":" << event.duration;
+    }
+    if (event.flags & kTraceEventFlagHasId) {
+      stream << ",\"id\":";
+      WriteHex(stream, event.id);
+    }
+    if (event.scope != NULL) {
+      stream << ",\"scope\":";
+      WriteJSONString(stream, event.scope);
+    }
+    stream << ",\"args\":{";
+    for (int j = 0; j < event.num_args; j++) {
+      if (j > 0) stream << ",";
+      WriteJSONString(stream, event.arg_names[j]);
+      stream << ":";
+      WriteArgValue(stream, event.arg_types[j], event.arg_values[j]);
+    }
+    stream << "}}";
+  }
+  stream << "]}";
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,99 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_TRACE_BUFFER_H_
+#define V8_LIBPLATFORM_TRACE_BUFFER_H_
+
+#include <stdint.h>
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace platform {
+
+// Records trace events emitted through the TRACE_EVENT macros into a ring
+// buffer of fixed-width records, overwriting the oldest events once full, and
+// writes them out in the JSON Trace Event Format understood by
+// chrome://tracing. Recording is enabled per category; category groups such
+// as "v8,devtools.timeline" are enabled if any of their categories is.
+class TraceBuffer {
+ public:
+  static const size_t kDefaultCapacity = 16 * 1024;
+
+  explicit TraceBuffer(size_t capacity = kDefaultCapacity);
+  ~TraceBuffer();
+
+  // Enables recording for the comma-separated list of |categories| and
+  // discards previously recorded events.
+  void Start(const char* categories);
+
+  // Disables recording for all categories. Recorded events are kept until the
+  // next call to Start.
+  void Stop();
+
+  // Writes all recorded events, oldest first, to |stream|.
+  void WriteJSON(std::ostream& stream);
+
+  const uint8_t* GetCategoryGroupEnabled(const char* name);
+  const char* GetCategoryGroupName(const uint8_t* category_enabled_flag);
+  uint64_t AddTraceEvent(char phase, const uint8_t* category_enabled_flag,
+                         const char* name, const char* scope, uint64_t id,
+                         uint64_t bind_id, int32_t num_args,
+                         const char** arg_names, const uint8_t* arg_types,
+                         const uint64_t* arg_values, unsigned int flags);
+  void UpdateTraceEventDuration(const uint8_t* category_enabled_flag,
+                                const char* name, uint64_t handle);
+
+ private:
+  static const int kMaxCategoryGroups = 200;
+  static const int kMaxArgs = 2;
+
+  struct Event {
+    // Handle returned from AddTraceEvent; zero for an unused slot.
+    uint64_t handle;
+    int64_t timestamp;
+    int64_t duration;
+    uint64_t id;
+    uint64_t bind_id;
+    const char* name;
+    const char* scope;
+    const uint8_t* category_enabled_flag;
+    unsigned int flags;
+    int tid;
+    char phase;
+    uint8_t num_args;
+    uint8_t arg_types[kMaxArgs];
+    const char* arg_names[kMaxArgs];
+    uint64_t arg_values[kMaxArgs];
+    // Backing store for strings passed with TRACE_EVENT_FLAG_COPY or as
+    // TRACE_STR_COPY values, NUL-separated. It is filled completely before
+    // the pointers above are set, so they stay valid until the slot is
+    // reused.
+    std::string copies;
+  };
+
+  bool IsCategoryGroupEnabled(const char* category_group) const;
+
+  base::Mutex lock_;
+  const size_t capacity_;
+  // Allocated by Start, so an idle platform does not pay for the buffer.
+  std::vector<Event> events_;
+  uint64_t next_handle_;
+  std::vector<std::string> included_categories_;
+  int category_group_count_;
+  const char* category_groups_[kMaxCategoryGroups];
+  uint8_t category_group_enabled_[kMaxCategoryGroups];
+
+  DISALLOW_COPY_AND_ASSIGN(TraceBuffer);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_TRACE_BUFFER_H_
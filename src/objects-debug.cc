@@ -905,6 +905,7 @@ void PrototypeInfo::PrototypeInfoVerify() {
     CHECK(prototype_users()->IsSmi());
   }
   CHECK(validity_cell()->IsCell() || validity_cell()->IsSmi());
+  CHECK(weak_cell()->IsWeakCell() || weak_cell()->IsSmi());
 }
 
 
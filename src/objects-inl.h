@@ -518,6 +518,15 @@ Handle<Object> CodeCacheHashTableShape::AsHandle(Isolate* isolate,
   return key->AsHandle(isolate);
 }
 
+// Fast negative check for string table keys. Strings in the string table
+// always have their hash computed, and a key knows its hash field once it has
+// been hashed, so the characters only need to be compared on equal fields.
+inline bool HashFieldsDiffer(uint32_t key_hash_field, String* string) {
+  return key_hash_field != 0 && string->HasHashCode() &&
+         string->hash_field() != key_hash_field;
+}
+
+
 template <typename Char>
 class SequentialStringKey : public HashTableKey {
  public:
@@ -551,6 +560,7 @@ class OneByteStringKey : public SequentialStringKey<uint8_t> {
       : SequentialStringKey<uint8_t>(str, seed) { }
 
   bool IsMatch(Object* string) override {
+    if (HashFieldsDiffer(hash_field_, String::cast(string))) return false;
     return String::cast(string)->IsOneByteEqualTo(string_);
   }
 
@@ -561,7 +571,7 @@ class OneByteStringKey : public SequentialStringKey<uint8_t> {
 class SeqOneByteSubStringKey : public HashTableKey {
  public:
   SeqOneByteSubStringKey(Handle<SeqOneByteString> string, int from, int length)
-      : string_(string), from_(from), length_(length) {
+      : string_(string), from_(from), length_(length), hash_field_(0) {
     DCHECK(string_->IsSeqOneByteString());
   }
 
@@ -597,6 +607,7 @@ class TwoByteStringKey : public SequentialStringKey<uc16> {
       : SequentialStringKey<uc16>(str, seed) { }
 
   bool IsMatch(Object* string) override {
+    if (HashFieldsDiffer(hash_field_, String::cast(string))) return false;
     return String::cast(string)->IsTwoByteEqualTo(string_);
   }
 
@@ -611,6 +622,7 @@ class Utf8StringKey : public HashTableKey {
       : string_(string), hash_field_(0), seed_(seed) { }
 
   bool IsMatch(Object* string) override {
+    if (HashFieldsDiffer(hash_field_, String::cast(string))) return false;
     return String::cast(string)->IsUtf8EqualTo(string_);
   }
 
@@ -1388,6 +1400,17 @@ void HeapObject::synchronized_set_map_word(MapWord map_word) {
 }
 
 
+bool HeapObject::synchronized_compare_and_swap_map_word(MapWord old_map_word,
+                                                        MapWord new_map_word) {
+  base::AtomicWord expected =
+      static_cast<base::AtomicWord>(old_map_word.value_);
+  base::AtomicWord result = base::Release_CompareAndSwap(
+      reinterpret_cast<base::AtomicWord*>(FIELD_ADDR(this, kMapOffset)),
+      expected, static_cast<base::AtomicWord>(new_map_word.value_));
+  return result == expected;
+}
+
+
 int HeapObject::Size() {
   return SizeFromMap(map());
 }
@@ -1712,12 +1735,18 @@ inline bool AllocationSite::MakePretenureDecision(
     double ratio,
     bool maximum_size_scavenge) {
   // Here we just allow state transitions from undecided or maybe tenure
-  // to don't tenure, maybe tenure, or tenure.
-  if ((current_decision == kUndecided || current_decision == kMaybeTenure)) {
+  // to don't tenure, maybe tenure, or tenure. With adaptive pretenuring, a
+  // don't tenure decision is revisited as well, since the lifetime of objects
+  // allocated at a site may change, e.g., when a cache is warmed up.
+  bool adaptive = FLAG_adaptive_allocation_site_pretenuring;
+  if (current_decision == kUndecided || current_decision == kMaybeTenure ||
+      (adaptive && current_decision == kDontTenure)) {
     if (ratio >= kPretenureRatio) {
       // We just transition into tenure state when the semi-space was at
-      // maximum capacity.
-      if (maximum_size_scavenge) {
+      // maximum capacity, or, with adaptive pretenuring, when the site
+      // already had a high survival rate at the previous decision.
+      if (maximum_size_scavenge ||
+          (adaptive && current_decision == kMaybeTenure)) {
         set_deopt_dependent_code(true);
         set_pretenure_decision(kTenure);
         // Currently we just need to deopt when we make a state transition to
@@ -2644,6 +2673,13 @@ Object** DescriptorArray::GetEnumCacheSlot() {
                               kEnumCacheOffset);
 }
 
+
+void DescriptorArray::ClearEnumCacheKeys() {
+  DCHECK(HasEnumCache());
+  FixedArray* bridge = FixedArray::cast(get(kEnumCacheIndex));
+  bridge->set(kEnumCacheBridgeKeysIndex, Smi::FromInt(0));
+}
+
 // Perform a binary search in a fixed array.
 template <SearchMode search_mode, typename T>
 int BinarySearch(T* array, Name* name, int valid_entries,
@@ -4054,6 +4090,31 @@ void BytecodeArray::set_interrupt_budget(int interrupt_budget) {
   WRITE_INT_FIELD(this, kInterruptBudgetOffset, interrupt_budget);
 }
 
+int BytecodeArray::bytecode_age() const {
+  return AgeBits::decode(READ_INT_FIELD(this, kBytecodeAgeOffset));
+}
+
+void BytecodeArray::MakeOlder(MarkingParity current_parity) {
+  int value = READ_INT_FIELD(this, kBytecodeAgeOffset);
+  // Age at most once per marking cycle.
+  if (AgeParityBits::decode(value) == current_parity) return;
+  int age = Min(AgeBits::decode(value) + 1, kIsOldBytecodeAge);
+  WRITE_INT_FIELD(this, kBytecodeAgeOffset,
+                  AgeBits::encode(age) | AgeParityBits::encode(current_parity));
+}
+
+void BytecodeArray::ResetAge() { WRITE_INT_FIELD(this, kBytecodeAgeOffset, 0); }
+
+void BytecodeArray::PreAge() {
+  WRITE_INT_FIELD(this, kBytecodeAgeOffset,
+                  AgeBits::encode(kPreAgedBytecodeAge) |
+                      AgeParityBits::encode(NO_MARKING_PARITY));
+}
+
+bool BytecodeArray::IsOld() const {
+  return bytecode_age() >= kIsOldBytecodeAge;
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
@@ -5528,6 +5589,7 @@ ACCESSORS(PrototypeInfo, prototype_users, Object, kPrototypeUsersOffset)
 ACCESSORS(PrototypeInfo, object_create_map, Object, kObjectCreateMap)
 SMI_ACCESSORS(PrototypeInfo, registry_slot, kRegistrySlotOffset)
 ACCESSORS(PrototypeInfo, validity_cell, Object, kValidityCellOffset)
+ACCESSORS(PrototypeInfo, weak_cell, Object, kWeakCellOffset)
 SMI_ACCESSORS(PrototypeInfo, bit_field, kBitFieldOffset)
 BOOL_ACCESSORS(PrototypeInfo, bit_field, should_be_fast_map, kShouldBeFastBit)
 
@@ -6083,8 +6145,10 @@ void SharedFunctionInfo::set_deopt_count(int deopt_count) {
 void SharedFunctionInfo::increment_deopt_count() {
   int value = counters();
   int deopt_count = DeoptCountBits::decode(value);
-  deopt_count = (deopt_count + 1) & DeoptCountBits::kMax;
-  set_counters(DeoptCountBits::update(value, deopt_count));
+  // Saturate instead of wrapping around, so that a function that deopts
+  // over and over doesn't look like it never deopted.
+  if (deopt_count == DeoptCountBits::kMax) return;
+  set_counters(DeoptCountBits::update(value, deopt_count + 1));
 }
 
 
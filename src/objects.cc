@@ -837,6 +837,34 @@ MaybeHandle<Object> Object::GetProperty(LookupIterator* it) {
 }
 
 
+namespace {
+
+// Returns true if |target| is an ordinary object on which looking up |name|
+// cannot run user code, and which has no non-configurable own property
+// |name|. The invariants enforced after the get, set, has and deleteProperty
+// traps only concern non-configurable properties (and, for has,
+// non-extensible targets), so their checks cannot fail in that case and are
+// skipped.
+bool ProxyTargetPropertyIsConfigurable(Isolate* isolate,
+                                       Handle<JSReceiver> target,
+                                       Handle<Name> name) {
+  if (!target->IsJSObject()) return false;
+  LookupIterator it = LookupIterator::PropertyOrElement(
+      isolate, target, name, target, LookupIterator::OWN);
+  switch (it.state()) {
+    case LookupIterator::NOT_FOUND:
+      return true;
+    case LookupIterator::DATA:
+    case LookupIterator::ACCESSOR:
+      return (it.property_attributes() & DONT_DELETE) == 0;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+
 // static
 MaybeHandle<Object> JSProxy::GetProperty(Isolate* isolate,
                                          Handle<JSProxy> proxy,
@@ -886,6 +914,9 @@ MaybeHandle<Object> JSProxy::GetProperty(Isolate* isolate,
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, trap_result,
       Execution::Call(isolate, trap, handler, arraysize(args), args), Object);
+  if (ProxyTargetPropertyIsConfigurable(isolate, target, name)) {
+    return trap_result;
+  }
   // 9. Let targetDesc be ? target.[[GetOwnProperty]](P).
   PropertyDescriptor target_desc;
   Maybe<bool> target_found =
@@ -5157,7 +5188,9 @@ Maybe<bool> JSProxy::HasProperty(Isolate* isolate, Handle<JSProxy> proxy,
       Nothing<bool>());
   bool boolean_trap_result = trap_result_obj->BooleanValue();
   // 9. If booleanTrapResult is false, then:
-  if (!boolean_trap_result) {
+  if (!boolean_trap_result &&
+      !(ProxyTargetPropertyIsConfigurable(isolate, target, name) &&
+        target->map()->is_extensible())) {
     // 9a. Let targetDesc be ? target.[[GetOwnProperty]](P).
     PropertyDescriptor target_desc;
     Maybe<bool> target_found = JSReceiver::GetOwnPropertyDescriptor(
@@ -5230,6 +5263,9 @@ Maybe<bool> JSProxy::SetProperty(Handle<JSProxy> proxy, Handle<Name> name,
   }
 
   // Enforce the invariant.
+  if (ProxyTargetPropertyIsConfigurable(isolate, target, name)) {
+    return Just(true);
+  }
   PropertyDescriptor target_desc;
   Maybe<bool> owned =
       JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
@@ -5296,6 +5332,9 @@ Maybe<bool> JSProxy::DeletePropertyOrElement(Handle<JSProxy> proxy,
   }
 
   // Enforce the invariant.
+  if (ProxyTargetPropertyIsConfigurable(isolate, target, name)) {
+    return Just(true);
+  }
   PropertyDescriptor target_desc;
   Maybe<bool> owned =
       JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
@@ -10069,12 +10108,36 @@ void DescriptorArray::SetEnumCache(Handle<DescriptorArray> descriptors,
   bridge_storage->set(kEnumCacheBridgeIndicesCacheIndex,
                       new_index_cache.is_null() ? Object::cast(Smi::FromInt(0))
                                                 : *new_index_cache);
+  bridge_storage->set(kEnumCacheBridgeKeysIndex, Smi::FromInt(0));
   if (needs_new_enum_cache) {
     descriptors->set(kEnumCacheIndex, bridge_storage);
   }
 }
 
 
+// static
+Handle<FixedArray> DescriptorArray::GetEnumCacheKeys(
+    Handle<DescriptorArray> descriptors, Isolate* isolate, int enum_length) {
+  DCHECK(descriptors->HasEnumCache());
+  DCHECK_LT(0, enum_length);
+  DCHECK_LE(enum_length, descriptors->GetEnumCache()->length());
+  Object* keys = FixedArray::cast(descriptors->get(kEnumCacheIndex))
+                     ->get(kEnumCacheBridgeKeysIndex);
+  if (keys->IsFixedArray() && FixedArray::cast(keys)->length() == enum_length) {
+    DCHECK_EQ(isolate->heap()->fixed_cow_array_map(),
+              FixedArray::cast(keys)->map());
+    return handle(FixedArray::cast(keys), isolate);
+  }
+  Handle<FixedArray> cache(descriptors->GetEnumCache(), isolate);
+  Handle<FixedArray> result =
+      isolate->factory()->CopyFixedArrayUpTo(cache, enum_length);
+  result->set_map(isolate->heap()->fixed_cow_array_map());
+  FixedArray::cast(descriptors->get(kEnumCacheIndex))
+      ->set(kEnumCacheBridgeKeysIndex, *result);
+  return result;
+}
+
+
 void DescriptorArray::CopyFrom(int index, DescriptorArray* src) {
   Object* value = src->GetValue(index);
   PropertyDetails details = src->GetDetails(index);
@@ -11568,18 +11631,7 @@ bool Map::EquivalentToForNormalization(Map* other,
 bool JSFunction::Inlines(SharedFunctionInfo* candidate) {
   DisallowHeapAllocation no_gc;
   if (shared() == candidate) return true;
-  if (code()->kind() != Code::OPTIMIZED_FUNCTION) return false;
-  DeoptimizationInputData* const data =
-      DeoptimizationInputData::cast(code()->deoptimization_data());
-  if (data->length() == 0) return false;
-  FixedArray* const literals = data->LiteralArray();
-  int const inlined_count = data->InlinedFunctionCount()->value();
-  for (int i = 0; i < inlined_count; ++i) {
-    if (SharedFunctionInfo::cast(literals->get(i)) == candidate) {
-      return true;
-    }
-  }
-  return false;
+  return code()->Inlines(candidate);
 }
 
 void JSFunction::MarkForBaseline() {
@@ -12171,6 +12223,29 @@ Handle<Cell> Map::GetOrCreatePrototypeChainValidityCell(Handle<Map> map,
   return cell;
 }
 
+// static
+Handle<WeakCell> Map::GetOrCreatePrototypeWeakCell(Handle<JSObject> prototype,
+                                                   Isolate* isolate) {
+  DCHECK(!prototype.is_null());
+  // Global objects are never made prototype maps, see OptimizeAsPrototype,
+  // so there is no PrototypeInfo to cache the cell in.
+  if (!prototype->map()->is_prototype_map()) {
+    return isolate->factory()->NewWeakCell(prototype);
+  }
+  Handle<PrototypeInfo> proto_info =
+      GetOrCreatePrototypeInfo(prototype, isolate);
+  Object* maybe_cell = proto_info->weak_cell();
+  // Return the existing cell if it still refers to this prototype.
+  if (maybe_cell->IsWeakCell() &&
+      WeakCell::cast(maybe_cell)->value() == *prototype) {
+    return handle(WeakCell::cast(maybe_cell), isolate);
+  }
+  // Otherwise create a new cell.
+  Handle<WeakCell> cell = isolate->factory()->NewWeakCell(prototype);
+  proto_info->set_weak_cell(*cell);
+  return cell;
+}
+
 
 // static
 void Map::SetPrototype(Handle<Map> map, Handle<Object> prototype,
@@ -13390,6 +13465,36 @@ void SharedFunctionInfo::ClearCodeFromOptimizedCodeMap() {
   }
 }
 
+namespace {
+
+void ClearCodeCellIfInlines(FixedArray* optimized_code_map, int index,
+                            SharedFunctionInfo* candidate) {
+  WeakCell* cell = WeakCell::cast(optimized_code_map->get(index));
+  if (cell->cleared() || !Code::cast(cell->value())->Inlines(candidate)) {
+    return;
+  }
+  WeakCell* empty_weak_cell = optimized_code_map->GetHeap()->empty_weak_cell();
+  optimized_code_map->set(index, empty_weak_cell, SKIP_WRITE_BARRIER);
+}
+
+}  // namespace
+
+void SharedFunctionInfo::ClearCodeInliningFromOptimizedCodeMap(
+    SharedFunctionInfo* candidate) {
+  if (OptimizedCodeMapIsCleared()) return;
+  if (this == candidate) {
+    ClearCodeFromOptimizedCodeMap();
+    return;
+  }
+  FixedArray* optimized_code_map = this->optimized_code_map();
+  int length = optimized_code_map->length();
+  ClearCodeCellIfInlines(optimized_code_map, kSharedCodeIndex, candidate);
+  for (int i = kEntriesStart; i < length; i += kEntryLength) {
+    ClearCodeCellIfInlines(optimized_code_map, i + kCachedCodeOffset,
+                           candidate);
+  }
+}
+
 CodeAndLiterals SharedFunctionInfo::SearchOptimizedCodeMap(
     Context* native_context, BailoutId osr_ast_id) {
   CodeAndLiterals result = {nullptr, nullptr};
@@ -13527,11 +13632,14 @@ void Code::InvalidateEmbeddedObjects() {
 }
 
 
-void Code::Relocate(intptr_t delta) {
+void Code::Relocate(intptr_t delta, bool flush_icache) {
   for (RelocIterator it(this, RelocInfo::kApplyMask); !it.done(); it.next()) {
     it.rinfo()->apply(delta);
   }
-  Assembler::FlushICache(GetIsolate(), instruction_start(), instruction_size());
+  if (flush_icache) {
+    Assembler::FlushICache(GetIsolate(), instruction_start(),
+                           instruction_size());
+  }
 }
 
 
@@ -13933,6 +14041,24 @@ void Code::PrintDeoptLocation(FILE* out, Address pc) {
 }
 
 
+bool Code::Inlines(SharedFunctionInfo* candidate) {
+  DisallowHeapAllocation no_gc;
+  if (kind() != OPTIMIZED_FUNCTION) return false;
+  DeoptimizationInputData* const data =
+      DeoptimizationInputData::cast(deoptimization_data());
+  if (data->length() == 0) return false;
+  if (data->SharedFunctionInfo() == candidate) return true;
+  FixedArray* const literals = data->LiteralArray();
+  int const inlined_count = data->InlinedFunctionCount()->value();
+  for (int i = 0; i < inlined_count; ++i) {
+    if (SharedFunctionInfo::cast(literals->get(i)) == candidate) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
 bool Code::CanDeoptAt(Address pc) {
   DeoptimizationInputData* deopt_data =
       DeoptimizationInputData::cast(deoptimization_data());
@@ -16168,6 +16294,7 @@ Handle<Object> SeqOneByteSubStringKey::AsHandle(Isolate* isolate) {
 
 
 bool SeqOneByteSubStringKey::IsMatch(Object* string) {
+  if (HashFieldsDiffer(hash_field_, String::cast(string))) return false;
   Vector<const uint8_t> chars(string_->GetChars() + from_, length_);
   return String::cast(string)->IsOneByteEqualTo(chars);
 }
@@ -17060,8 +17187,7 @@ MaybeHandle<String> StringTable::LookupTwoCharsStringIfExists(
 }
 
 
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
+void StringTable::EnsureCapacityForBulkInsert(Isolate* isolate, int expected) {
   Handle<StringTable> table = isolate->factory()->string_table();
   // We need a key instance for the virtual hash function.
   InternalizedStringKey dummy_key(isolate->factory()->empty_string());
@@ -17273,7 +17399,21 @@ void CompilationCacheTable::Age() {
       }
     } else if (get(entry_index)->IsFixedArray()) {
       SharedFunctionInfo* info = SharedFunctionInfo::cast(get(value_index));
-      if (info->code()->kind() != Code::FUNCTION || info->code()->IsOld()) {
+      // Interpreted functions run through a builtin trampoline, so their
+      // age is tracked on the bytecode array rather than on the code. The
+      // code flusher only ages the bytecode of flushable functions, which
+      // excludes the top-level and eval code cached here, so age it here.
+      bool is_old;
+      if (info->HasBytecodeArray()) {
+        BytecodeArray* bytecode = info->bytecode_array();
+        bytecode->MakeOlder(
+            GetHeap()->mark_compact_collector()->marking_parity());
+        is_old = bytecode->IsOld();
+      } else {
+        is_old = info->code()->kind() != Code::FUNCTION ||
+                 info->code()->IsOld();
+      }
+      if (is_old) {
         NoWriteBarrierSet(this, entry_index, the_hole_value);
         NoWriteBarrierSet(this, value_index, the_hole_value);
         ElementRemoved();
@@ -18053,6 +18193,7 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowHeapAllocation no_gc;
+  WriteBarrierMode mode = new_table->GetWriteBarrierMode(no_gc);
   for (int old_entry = 0; old_entry < (nof + nod); ++old_entry) {
     Object* key = table->KeyAt(old_entry);
     if (key->IsTheHole(isolate)) {
@@ -18068,7 +18209,7 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Rehash(
     int old_index = table->EntryToIndex(old_entry);
     for (int i = 0; i < entrysize; ++i) {
       Object* value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      new_table->set(new_index + i, value, mode);
     }
     new_table->set(new_index + kChainOffset, chain_entry);
     ++new_entry;
@@ -1546,6 +1546,11 @@ class HeapObject: public Object {
   inline void synchronized_set_map_no_write_barrier(Map* value);
   inline void synchronized_set_map_word(MapWord map_word);
 
+  // Atomically replaces the map word if it still holds {old_map_word}, using
+  // a release store. Returns true iff the map word was replaced.
+  inline bool synchronized_compare_and_swap_map_word(MapWord old_map_word,
+                                                     MapWord new_map_word);
+
   // During garbage collection, the map word of a heap object does not
   // necessarily contain a map pointer.
   inline MapWord map_word() const;
@@ -2913,6 +2918,16 @@ class DescriptorArray: public FixedArray {
 
   void ClearEnumCache();
 
+  // Returns a copy-on-write array with the first |enum_length| keys of the
+  // enum cache, as returned by Object.keys. The array is remembered next to
+  // the enum cache, so repeated calls for the same map do not copy.
+  static Handle<FixedArray> GetEnumCacheKeys(
+      Handle<DescriptorArray> descriptors, Isolate* isolate, int enum_length);
+
+  // Forgets the array handed out by GetEnumCacheKeys, e.g. because the enum
+  // cache it was copied from is trimmed.
+  inline void ClearEnumCacheKeys();
+
   // Initialize or change the enum cache,
   // using the supplied storage for the small "bridge".
   static void SetEnumCache(Handle<DescriptorArray> descriptors,
@@ -2990,9 +3005,10 @@ class DescriptorArray: public FixedArray {
   static const int kFirstIndex = 2;
 
   // The length of the "bridge" to the enum cache.
-  static const int kEnumCacheBridgeLength = 2;
+  static const int kEnumCacheBridgeLength = 3;
   static const int kEnumCacheBridgeCacheIndex = 0;
   static const int kEnumCacheBridgeIndicesCacheIndex = 1;
+  static const int kEnumCacheBridgeKeysIndex = 2;
 
   // Layout description.
   static const int kDescriptorLengthOffset = FixedArray::kHeaderSize;
@@ -3376,7 +3392,9 @@ class StringTable: public HashTable<StringTable,
       uint16_t c1,
       uint16_t c2);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Grows the string table once so that {expected} new strings can be added
+  // without rehashing in between.
+  static void EnsureCapacityForBulkInsert(Isolate* isolate, int expected);
 
   DECLARE_CAST(StringTable)
 
@@ -4482,6 +4500,14 @@ class BytecodeArray : public FixedArrayBase {
   inline int interrupt_budget() const;
   inline void set_interrupt_budget(int interrupt_budget);
 
+  // Bytecode aging for bytecode flushing. The age is increased once per
+  // marking cycle and reset whenever the function returns.
+  inline int bytecode_age() const;
+  inline void MakeOlder(MarkingParity current_parity);
+  inline void ResetAge();
+  inline void PreAge();
+  inline bool IsOld() const;
+
   // Accessors for the constant pool.
   DECL_ACCESSORS(constant_pool, FixedArray)
 
@@ -4521,7 +4547,17 @@ class BytecodeArray : public FixedArrayBase {
   static const int kFrameSizeOffset = kSourcePositionTableOffset + kPointerSize;
   static const int kParameterSizeOffset = kFrameSizeOffset + kIntSize;
   static const int kInterruptBudgetOffset = kParameterSizeOffset + kIntSize;
-  static const int kHeaderSize = kInterruptBudgetOffset + kIntSize;
+  static const int kBytecodeAgeOffset = kInterruptBudgetOffset + kIntSize;
+  static const int kHeaderSize = kBytecodeAgeOffset + kIntSize;
+
+  // Encoding of the bytecode age field. A value of zero means "just ran".
+  class AgeBits : public BitField<int, 0, 8> {};
+  class AgeParityBits : public BitField<MarkingParity, 8, 2> {};
+
+  // Number of marking cycles without execution after which the bytecode is
+  // considered old, i.e. can be flushed.
+  static const int kIsOldBytecodeAge = 5;
+  static const int kPreAgedBytecodeAge = kIsOldBytecodeAge - 1;
 
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
@@ -5226,8 +5262,10 @@ class Code: public HeapObject {
   inline bool contains(byte* pc);
 
   // Relocate the code by delta bytes. Called to signal that this code
-  // object has been moved by delta bytes.
-  void Relocate(intptr_t delta);
+  // object has been moved by delta bytes. Callers passing false for
+  // |flush_icache| have to flush the instruction cache for the moved code
+  // themselves.
+  void Relocate(intptr_t delta, bool flush_icache = true);
 
   // Migrate code described by desc.
   void CopyFrom(const CodeDesc& desc);
@@ -5295,6 +5333,10 @@ class Code: public HeapObject {
   void PrintDeoptLocation(FILE* out, Address pc);
   bool CanDeoptAt(Address pc);
 
+  // Tells whether this is optimized code for or inlining the given shared
+  // function info.
+  bool Inlines(SharedFunctionInfo* candidate);
+
 #ifdef VERIFY_HEAP
   void VerifyEmbeddedObjectsDependency();
 #endif
@@ -5842,6 +5884,12 @@ class Map: public HeapObject {
   static const int kPrototypeChainValid = 0;
   static const int kPrototypeChainInvalid = 1;
 
+  // Returns a weak cell for |prototype|, cached in its PrototypeInfo so that
+  // handlers embedding the same holder share one cell. Objects without a
+  // prototype map, such as a global object behind its proxy, get a fresh cell.
+  static Handle<WeakCell> GetOrCreatePrototypeWeakCell(
+      Handle<JSObject> prototype, Isolate* isolate);
+
   Map* FindRootMap();
   Map* FindFieldOwner(int descriptor);
 
@@ -6406,6 +6454,9 @@ class PrototypeInfo : public Struct {
   // given receiver embed the currently valid cell for that receiver's prototype
   // during their compilation and check it on execution.
   DECL_ACCESSORS(validity_cell, Object)
+  // [weak_cell]: A WeakCell containing this prototype, or Smi(0) if
+  // uninitialized. ICs use it to refer to the holder on the prototype chain.
+  DECL_ACCESSORS(weak_cell, Object)
   // [bit_field]
   inline int bit_field() const;
   inline void set_bit_field(int bit_field);
@@ -6421,7 +6472,8 @@ class PrototypeInfo : public Struct {
   static const int kPrototypeUsersOffset = HeapObject::kHeaderSize;
   static const int kRegistrySlotOffset = kPrototypeUsersOffset + kPointerSize;
   static const int kValidityCellOffset = kRegistrySlotOffset + kPointerSize;
-  static const int kObjectCreateMap = kValidityCellOffset + kPointerSize;
+  static const int kWeakCellOffset = kValidityCellOffset + kPointerSize;
+  static const int kObjectCreateMap = kWeakCellOffset + kPointerSize;
   static const int kBitFieldOffset = kObjectCreateMap + kPointerSize;
   static const int kSize = kBitFieldOffset + kPointerSize;
 
@@ -7000,6 +7052,10 @@ class SharedFunctionInfo: public HeapObject {
   // Like ClearOptimizedCodeMap, but preserves literals.
   void ClearCodeFromOptimizedCodeMap();
 
+  // Like ClearCodeFromOptimizedCodeMap, but only clears code that inlines
+  // the given shared function info.
+  void ClearCodeInliningFromOptimizedCodeMap(SharedFunctionInfo* candidate);
+
   // We have a special root FixedArray with the right shape and values
   // to represent the cleared optimized code map. This predicate checks
   // if that root is installed.
@@ -7324,7 +7380,8 @@ class SharedFunctionInfo: public HeapObject {
   inline int opt_count();
   inline void set_opt_count(int opt_count);
 
-  // Number of times the function was deoptimized.
+  // Number of times the function was deoptimized, saturating at
+  // DeoptCountBits::kMax.
   inline void set_deopt_count(int value);
   inline int deopt_count();
   inline void increment_deopt_count();
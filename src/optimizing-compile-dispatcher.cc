@@ -4,6 +4,8 @@
 
 #include "src/optimizing-compile-dispatcher.h"
 
+#include <limits>
+
 #include "src/base/atomicops.h"
 #include "src/full-codegen/full-codegen.h"
 #include "src/isolate.h"
@@ -27,6 +29,15 @@ void DisposeCompilationJob(CompilationJob* job, bool restore_function_code) {
   delete job;
 }
 
+int ComputeMaxTasks() {
+  int threads = static_cast<int>(
+      V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads());
+  int tasks = FLAG_concurrent_recompilation_tasks > 0
+                  ? Min(FLAG_concurrent_recompilation_tasks, threads)
+                  : threads;
+  return Max(tasks, 1);
+}
+
 }  // namespace
 
 
@@ -54,12 +65,13 @@ class OptimizingCompileDispatcher::CompileTask : public v8::Task {
       TimerEventScope<TimerEventRecompileConcurrent> timer(isolate_);
       TRACE_EVENT0("v8", "V8.RecompileConcurrent");
 
-      if (dispatcher->recompilation_delay_ != 0) {
-        base::OS::Sleep(base::TimeDelta::FromMilliseconds(
-            dispatcher->recompilation_delay_));
+      while (dispatcher->ClaimInputOrRetireTask()) {
+        if (dispatcher->recompilation_delay_ != 0) {
+          base::OS::Sleep(base::TimeDelta::FromMilliseconds(
+              dispatcher->recompilation_delay_));
+        }
+        dispatcher->CompileNext(dispatcher->NextInput(true));
       }
-
-      dispatcher->CompileNext(dispatcher->NextInput(true));
     }
     {
       base::LockGuard<base::Mutex> lock_guard(&dispatcher->ref_count_mutex_);
@@ -75,6 +87,20 @@ class OptimizingCompileDispatcher::CompileTask : public v8::Task {
 };
 
 
+OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
+    : isolate_(isolate),
+      input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
+      input_queue_length_(0),
+      max_tasks_(ComputeMaxTasks()),
+      running_tasks_(0),
+      released_jobs_(0),
+      blocked_jobs_(0),
+      ref_count_(0),
+      recompilation_delay_(FLAG_concurrent_recompilation_delay) {
+  base::NoBarrier_Store(&mode_, static_cast<base::AtomicWord>(COMPILE));
+  input_queue_ = NewArray<InputQueueEntry>(input_queue_capacity_);
+}
+
 OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 #ifdef DEBUG
   {
@@ -83,15 +109,35 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   }
 #endif
   DCHECK_EQ(0, input_queue_length_);
+  DCHECK_EQ(0, running_tasks_);
+  DCHECK_EQ(0, released_jobs_);
   DeleteArray(input_queue_);
 }
 
+bool OptimizingCompileDispatcher::ClaimInputOrRetireTask() {
+  base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
+  if (released_jobs_ > 0) {
+    DCHECK_LE(released_jobs_, input_queue_length_);
+    released_jobs_--;
+    return true;
+  }
+  DCHECK_LT(0, running_tasks_);
+  running_tasks_--;
+  return false;
+}
+
 CompilationJob* OptimizingCompileDispatcher::NextInput(bool check_if_flushing) {
   base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return NULL;
-  CompilationJob* job = input_queue_[InputQueueIndex(0)];
+  int index = 0;
+  for (int i = 1; i < input_queue_length_; ++i) {
+    if (input_queue_[i].priority > input_queue_[index].priority) index = i;
+  }
+  CompilationJob* job = input_queue_[index].job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
+  for (int i = index + 1; i < input_queue_length_; ++i) {
+    input_queue_[i - 1] = input_queue_[i];
+  }
   input_queue_length_--;
   if (check_if_flushing) {
     if (static_cast<ModeFlag>(base::Acquire_Load(&mode_)) == FLUSH) {
@@ -159,8 +205,8 @@ void OptimizingCompileDispatcher::Stop() {
   }
 
   if (recompilation_delay_ != 0) {
-    // At this point the optimizing compiler thread's event loop has stopped.
-    // There is no need for a mutex when reading input_queue_length_.
+    // At this point all compile tasks have finished. There is no need for a
+    // mutex when reading input_queue_length_.
     while (input_queue_length_ > 0) CompileNext(NextInput());
     InstallOptimizedFunctions();
   } else {
@@ -170,13 +216,29 @@ void OptimizingCompileDispatcher::Stop() {
 
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
+  InstallOptimizedFunctions(std::numeric_limits<double>::infinity());
+}
+
+
+void OptimizingCompileDispatcher::InstallOptimizedFunctions(
+    double deadline_in_ms) {
   HandleScope handle_scope(isolate_);
 
-  for (;;) {
+  bool const has_deadline =
+      deadline_in_ms < std::numeric_limits<double>::infinity();
+  for (bool first = true;; first = false) {
+    bool const out_of_time =
+        !first && has_deadline &&
+        isolate_->heap()->MonotonicallyIncreasingTimeInMs() >= deadline_in_ms;
     CompilationJob* job = NULL;
     {
       base::LockGuard<base::Mutex> access_output_queue_(&output_queue_mutex_);
       if (output_queue_.empty()) return;
+      if (out_of_time) {
+        // Leave the remaining jobs for the next install interrupt.
+        isolate_->stack_guard()->RequestInstallCode();
+        return;
+      }
       job = output_queue_.front();
       output_queue_.pop();
     }
@@ -197,16 +259,37 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 
 void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  // Hotter functions are compiled first. The tick count has to be read here,
+  // as the background thread must not dereference handles.
+  SharedFunctionInfo* shared = *job->info()->shared_info();
+  int priority = shared->code()->kind() == Code::FUNCTION
+                     ? shared->code()->profiler_ticks()
+                     : shared->profiler_ticks();
   {
     // Add job to the back of the input queue.
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_[input_queue_length_].job = job;
+    input_queue_[input_queue_length_].priority = priority;
     input_queue_length_++;
+    if (!FLAG_block_concurrent_recompilation) released_jobs_++;
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
   } else {
+    StartTasks(1);
+  }
+}
+
+
+void OptimizingCompileDispatcher::StartTasks(int count) {
+  {
+    base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+    count = Min(count, max_tasks_ - running_tasks_);
+    if (count <= 0) return;
+    running_tasks_ += count;
+  }
+  for (int i = 0; i < count; ++i) {
     V8::GetCurrentPlatform()->CallOnBackgroundThread(
         new CompileTask(isolate_), v8::Platform::kShortRunningTask);
   }
@@ -214,11 +297,12 @@ void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
 
 
 void OptimizingCompileDispatcher::Unblock() {
-  while (blocked_jobs_ > 0) {
-    V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        new CompileTask(isolate_), v8::Platform::kShortRunningTask);
-    blocked_jobs_--;
+  {
+    base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+    released_jobs_ += blocked_jobs_;
   }
+  StartTasks(blocked_jobs_);
+  blocked_jobs_ = 0;
 }
 
 
@@ -22,17 +22,7 @@ class SharedFunctionInfo;
 
 class OptimizingCompileDispatcher {
  public:
-  explicit OptimizingCompileDispatcher(Isolate* isolate)
-      : isolate_(isolate),
-        input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
-        blocked_jobs_(0),
-        ref_count_(0),
-        recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    base::NoBarrier_Store(&mode_, static_cast<base::AtomicWord>(COMPILE));
-    input_queue_ = NewArray<CompilationJob*>(input_queue_capacity_);
-  }
+  explicit OptimizingCompileDispatcher(Isolate* isolate);
 
   ~OptimizingCompileDispatcher();
 
@@ -41,7 +31,12 @@ class OptimizingCompileDispatcher {
   void Flush();
   void QueueForOptimization(CompilationJob* job);
   void Unblock();
+  // Installs all finished jobs.
   void InstallOptimizedFunctions();
+  // Installs finished jobs until {deadline_in_ms} (in the time base of
+  // Heap::MonotonicallyIncreasingTimeInMs) has passed, but at least one.
+  // Requests another install interrupt if jobs are left.
+  void InstallOptimizedFunctions(double deadline_in_ms);
 
   inline bool IsQueueAvailable() {
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
@@ -55,26 +50,44 @@ class OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct InputQueueEntry {
+    CompilationJob* job;
+    int priority;
+  };
+
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(CompilationJob* job);
   CompilationJob* NextInput(bool check_if_flushing = false);
 
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
+  // Called by a compile task before it takes the next job. Claims one of the
+  // {released_jobs_}, or returns false and retires the task if there is none.
+  bool ClaimInputOrRetireTask();
+
+  // Posts up to {count} compile tasks, staying within {max_tasks_}.
+  void StartTasks(int count);
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  CompilationJob** input_queue_;
+  // Queue of incoming recompilation tasks. Compile tasks take the entry with
+  // the highest priority (the number of profiler ticks at the time the job
+  // was queued) first; entries with the same priority are taken in order.
+  InputQueueEntry* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
-  int input_queue_shift_;
   base::Mutex input_queue_mutex_;
 
+  // The maximum number of compile tasks that may run at the same time, and
+  // the number of tasks currently posted or running (protected by
+  // {input_queue_mutex_}). Each task keeps taking jobs from the input queue
+  // while there are released jobs left.
+  int max_tasks_;
+  int running_tasks_;
+
+  // The number of queued jobs that compile tasks may take (protected by
+  // {input_queue_mutex_}). With --block-concurrent-recompilation, jobs are
+  // only released by Unblock().
+  int released_jobs_;
+
   // Queue of recompilation tasks ready to be installed (excluding OSR).
   std::queue<CompilationJob*> output_queue_;
   // Used for job based recompilation which has multiple producers on
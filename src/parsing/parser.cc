@@ -1017,6 +1017,11 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
         Handle<ExternalTwoByteString>::cast(source), 0, source->length());
     scanner_.Initialize(&stream);
     result = DoParseProgram(info);
+  } else if (source->IsExternalOneByteString()) {
+    ExternalOneByteStringUtf16CharacterStream stream(
+        Handle<ExternalOneByteString>::cast(source), 0, source->length());
+    scanner_.Initialize(&stream);
+    result = DoParseProgram(info);
   } else {
     GenericStringUtf16CharacterStream stream(source, 0, source->length());
     scanner_.Initialize(&stream);
@@ -1174,6 +1179,12 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
         shared_info->start_position(),
         shared_info->end_position());
     result = ParseLazy(isolate, info, &stream);
+  } else if (source->IsExternalOneByteString()) {
+    ExternalOneByteStringUtf16CharacterStream stream(
+        Handle<ExternalOneByteString>::cast(source),
+        shared_info->start_position(),
+        shared_info->end_position());
+    result = ParseLazy(isolate, info, &stream);
   } else {
     GenericStringUtf16CharacterStream stream(source,
                                              shared_info->start_position(),
@@ -5393,6 +5404,10 @@ bool Parser::ParseStatic(ParseInfo* info) {
   Parser parser(info);
   if (parser.Parse(info)) {
     info->set_language_mode(info->literal()->language_mode());
+    uint64_t allocated_bytes = info->zone()->allocation_size();
+    TRACE_EVENT_INSTANT1(TRACE_DISABLED_BY_DEFAULT("v8.zone_stats"),
+                         "V8.ParserZoneUsage", TRACE_EVENT_SCOPE_THREAD,
+                         "allocated_bytes", allocated_bytes);
     return true;
   }
   return false;
@@ -8,7 +8,7 @@
 #include "src/globals.h"
 #include "src/handles.h"
 #include "src/list-inl.h"  // TODO(mstarzinger): Temporary cycle breaker!
-#include "src/objects.h"
+#include "src/objects-inl.h"
 #include "src/unicode-inl.h"
 
 namespace v8 {
@@ -174,6 +174,30 @@ size_t GenericStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
 }
 
 
+// ----------------------------------------------------------------------------
+// ExternalOneByteStringUtf16CharacterStream
+
+ExternalOneByteStringUtf16CharacterStream::
+    ExternalOneByteStringUtf16CharacterStream(
+        Handle<ExternalOneByteString> data, size_t start_position,
+        size_t end_position)
+    : GenericStringUtf16CharacterStream(data, start_position, end_position),
+      raw_data_(data->GetChars()) {}
+
+
+ExternalOneByteStringUtf16CharacterStream::
+    ~ExternalOneByteStringUtf16CharacterStream() { }
+
+
+size_t ExternalOneByteStringUtf16CharacterStream::FillBuffer(
+    size_t from_pos) {
+  if (from_pos >= length_) return 0;
+  size_t length = Min(kBufferSize, length_ - from_pos);
+  CopyChars<uint8_t, uint16_t>(buffer_, raw_data_ + from_pos, length);
+  return length;
+}
+
+
 // ----------------------------------------------------------------------------
 // Utf8ToUtf16CharacterStream
 Utf8ToUtf16CharacterStream::Utf8ToUtf16CharacterStream(const byte* data,
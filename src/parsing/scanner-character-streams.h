@@ -13,6 +13,7 @@ namespace v8 {
 namespace internal {
 
 // Forward declarations.
+class ExternalOneByteString;
 class ExternalTwoByteString;
 
 // A buffered character stream based on a random access character
@@ -63,6 +64,24 @@ class GenericStringUtf16CharacterStream: public BufferedUtf16CharacterStream {
 };
 
 
+// Stream for external one-byte strings. External string data does not move,
+// so blocks are widened straight from the resource's characters without
+// going through String::WriteToFlat and its representation dispatch.
+class ExternalOneByteStringUtf16CharacterStream
+    : public GenericStringUtf16CharacterStream {
+ public:
+  ExternalOneByteStringUtf16CharacterStream(Handle<ExternalOneByteString> data,
+                                            size_t start_position,
+                                            size_t end_position);
+  ~ExternalOneByteStringUtf16CharacterStream() override;
+
+ protected:
+  size_t FillBuffer(size_t position) override;
+
+  const uint8_t* raw_data_;  // Pointer to the actual array of characters.
+};
+
+
 // Utf16 stream based on a literal UTF-8 string.
 class Utf8ToUtf16CharacterStream: public BufferedUtf16CharacterStream {
  public:
@@ -243,12 +243,21 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
+bool PerfJitLogger::IsPositionInFunction(SharedFunctionInfo* shared,
+                                         int position) {
+  // Positions in optimized code may belong to an inlined function, possibly
+  // from another script, and would be reported with the wrong line.
+  return shared->start_position() <= position &&
+         position < shared->end_position();
+}
+
 void PerfJitLogger::LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared) {
   // Compute the entry count and get the name of the script.
   uint32_t entry_count = 0;
   for (RelocIterator it(code, RelocInfo::kPositionMask); !it.done();
        it.next()) {
-    entry_count++;
+    int position = static_cast<int>(it.rinfo()->data());
+    if (IsPositionInFunction(shared, position)) entry_count++;
   }
   if (entry_count == 0) return;
   Handle<Script> script(Script::cast(shared->script()));
@@ -296,6 +305,7 @@ void PerfJitLogger::LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared) {
   for (RelocIterator it(code, RelocInfo::kPositionMask); !it.done();
        it.next()) {
     int position = static_cast<int>(it.rinfo()->data());
+    if (!IsPositionInFunction(shared, position)) continue;
     int line_number = Script::GetLineNumber(script, position);
     // Compute column.
     int relative_line_number = line_number - script_line_offset;
@@ -361,8 +371,10 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code* code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode* from, Address to) {
-  // Code relocation not supported.
-  UNREACHABLE();
+  // Code space is not compacted under --perf-prof, but bytecode arrays still
+  // move with the old space. They are never logged by LogRecordedBuffer, so
+  // there is nothing to update.
+  CHECK(from->IsBytecodeArray());
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
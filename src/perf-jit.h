@@ -66,6 +66,7 @@ class PerfJitLogger : public CodeEventLogger {
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
   void LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared);
+  static bool IsPositionInFunction(SharedFunctionInfo* shared, int position);
   void LogWriteUnwindingInfo(Code* code);
 
   static const uint32_t kElfMachIA32 = 3;
@@ -247,6 +247,10 @@ void AllocationTracker::AllocationEvent(Address addr, int size) {
       Vector<unsigned>(allocation_trace_buffer_, length));
   top_node->AddAllocation(size);
 
+  // Keeping the per-object ranges up to date dominates the cost of long
+  // running tracking sessions, and they are only needed to attribute heap
+  // snapshot entries to allocation traces.
+  if (FLAG_heap_profiler_aggregate_allocations) return;
   address_to_trace_.AddRange(addr, size, top_node->id());
 }
 
@@ -2550,7 +2550,11 @@ void HeapSnapshotGenerator::SetProgressTotal(int iterations_count) {
 
 
 bool HeapSnapshotGenerator::FillReferences() {
-  SnapshotFiller filler(snapshot_, &entries_);
+  // Mapping from HeapThing pointers to HeapEntry* pointers. It has one entry
+  // per object and is only needed while references are extracted, so it is
+  // released before the children of the snapshot entries are allocated.
+  HeapEntriesMap entries;
+  SnapshotFiller filler(snapshot_, &entries);
   return v8_heap_explorer_.IterateAndExtractReferences(&filler)
       && dom_explorer_.IterateAndExtractReferences(&filler);
 }
@@ -6792,6 +6792,9 @@ Object* RegExpResultsCache::Lookup(Heap* heap, String* key_string,
     DCHECK(key_pattern->IsString());
     if (!key_pattern->IsInternalizedString()) return Smi::FromInt(0);
     cache = heap->string_split_cache();
+  } else if (type == REGEXP_REPLACE_STRING) {
+    DCHECK(key_pattern->IsFixedArray());
+    cache = heap->regexp_replace_cache();
   } else {
     DCHECK(type == REGEXP_MULTIPLE_INDICES);
     DCHECK(key_pattern->IsFixedArray());
@@ -6828,6 +6831,9 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
     DCHECK(key_pattern->IsString());
     if (!key_pattern->IsInternalizedString()) return;
     cache = factory->string_split_cache();
+  } else if (type == REGEXP_REPLACE_STRING) {
+    DCHECK(key_pattern->IsFixedArray());
+    cache = factory->regexp_replace_cache();
   } else {
     DCHECK(type == REGEXP_MULTIPLE_INDICES);
     DCHECK(key_pattern->IsFixedArray());
@@ -1567,7 +1567,13 @@ class RegExpEngine: public AllStatic {
 
 class RegExpResultsCache : public AllStatic {
  public:
-  enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
+  enum ResultsCacheType {
+    REGEXP_MULTIPLE_INDICES,
+    STRING_SPLIT_SUBSTRINGS,
+    // The cached value is a pair of the replacement string and the result of
+    // the global replace.
+    REGEXP_REPLACE_STRING
+  };
 
   // Attempt to retrieve a cached result.  On failure, 0 is returned as a Smi.
   // On success, the returned result is guaranteed to be a COW-array.
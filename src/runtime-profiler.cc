@@ -114,7 +114,8 @@ void RuntimeProfiler::Optimize(JSFunction* function, const char* reason) {
   // TODO(4280): Fix this to check function is compiled to baseline once we
   // have a standard way to check that. For now, if baseline code doesn't have
   // a bytecode array.
-  DCHECK(!function->shared()->HasBytecodeArray());
+  DCHECK(FLAG_ignition_skip_baseline ||
+         !function->shared()->HasBytecodeArray());
   function->AttemptConcurrentOptimization();
 }
 
@@ -198,7 +199,8 @@ void RuntimeProfiler::MaybeOptimizeFullCodegen(JSFunction* function,
 
   // Do not record non-optimizable functions.
   if (shared->optimization_disabled()) {
-    if (shared->deopt_count() >= FLAG_max_opt_count) {
+    if (shared->disable_optimization_reason() == kOptimizedTooManyTimes ||
+        shared->deopt_count() >= FLAG_max_opt_count) {
       // If optimization was disabled due to many deoptimizations,
       // then check if the function is hot and try to reenable optimization.
       int ticks = shared_code->profiler_ticks();
@@ -278,6 +280,17 @@ void RuntimeProfiler::MaybeOptimizeIgnition(JSFunction* function) {
     return;
   }
 
+  // TurboFan can build its graph from the bytecode, so there is no need to
+  // go back to the AST for baseline code first. Functions that TurboFan
+  // would not optimize still take the baseline route.
+  if (FLAG_ignition_skip_baseline && !shared->optimization_disabled() &&
+      shared->PassesFilter(FLAG_turbo_filter)) {
+    if (ticks >= kProfilerTicksBeforeOptimization) {
+      Optimize(function, "hot and stable");
+    }
+    return;
+  }
+
   if (ticks >= kProfilerTicksBeforeBaseline) {
     Baseline(function, "hot enough for baseline");
   }
@@ -475,6 +475,27 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
   int capture_count = regexp->CaptureCount();
   int subject_length = subject->length();
 
+  static const int kMinLengthToCache = 0x1000;
+
+  if (subject_length > kMinLengthToCache) {
+    FixedArray* last_match_cache;
+    Object* cached_answer = RegExpResultsCache::Lookup(
+        isolate->heap(), *subject, regexp->data(), &last_match_cache,
+        RegExpResultsCache::REGEXP_REPLACE_STRING);
+    if (cached_answer->IsFixedArray() &&
+        FixedArray::cast(cached_answer)->get(0) == *replacement) {
+      int capture_registers = (capture_count + 1) * 2;
+      int32_t* last_match = NewArray<int32_t>(capture_registers);
+      for (int i = 0; i < capture_registers; i++) {
+        last_match[i] = Smi::cast(last_match_cache->get(i))->value();
+      }
+      RegExpImpl::SetLastMatchInfo(last_match_info, subject, capture_count,
+                                   last_match);
+      DeleteArray(last_match);
+      return FixedArray::cast(cached_answer)->get(1);
+    }
+  }
+
   // CompiledReplacement uses zone allocation.
   ZoneScope zone_scope(isolate->runtime_zone());
   CompiledReplacement compiled_replacement(zone_scope.zone());
@@ -544,7 +565,26 @@ MUST_USE_RESULT static Object* StringReplaceGlobalRegExpWithString(
   RegExpImpl::SetLastMatchInfo(last_match_info, subject, capture_count,
                                global_cache.LastSuccessfulMatch());
 
-  RETURN_RESULT_OR_FAILURE(isolate, builder.ToString());
+  Handle<String> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, result, builder.ToString());
+
+  if (subject_length > kMinLengthToCache) {
+    // Store the last successful match and the result for caching.
+    int capture_registers = (capture_count + 1) * 2;
+    Handle<FixedArray> last_match_cache =
+        isolate->factory()->NewFixedArray(capture_registers);
+    int32_t* last_match = global_cache.LastSuccessfulMatch();
+    for (int i = 0; i < capture_registers; i++) {
+      last_match_cache->set(i, Smi::FromInt(last_match[i]));
+    }
+    Handle<FixedArray> cached_answer = isolate->factory()->NewFixedArray(2);
+    cached_answer->set(0, *replacement);
+    cached_answer->set(1, *result);
+    RegExpResultsCache::Enter(
+        isolate, subject, handle(regexp->data(), isolate), cached_answer,
+        last_match_cache, RegExpResultsCache::REGEXP_REPLACE_STRING);
+  }
+  return *result;
 }
 
 
@@ -926,6 +966,12 @@ static Object* SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
           if (start >= 0) {
             int end = current_match[i * 2 + 1];
             DCHECK(start <= end);
+            if (start == match_start && end == match_end) {
+              // Captures spanning the whole match, as in /(\w+)/g, share the
+              // match string instead of allocating another substring.
+              elements->set(i, *match);
+              continue;
+            }
             Handle<String> substring =
                 isolate->factory()->NewSubString(subject, start, end);
             elements->set(i, *substring);
@@ -13,23 +13,9 @@ namespace v8 {
 namespace internal {
 
 
-// Perform string match of pattern on subject, starting at start index.
-// Caller must ensure that 0 <= start_index <= sub->length(),
-// and should check that pat->length() + start_index <= sub->length().
-int StringMatch(Isolate* isolate, Handle<String> sub, Handle<String> pat,
-                int start_index) {
-  DCHECK(0 <= start_index);
-  DCHECK(start_index <= sub->length());
-
-  int pattern_length = pat->length();
-  if (pattern_length == 0) return start_index;
-
-  int subject_length = sub->length();
-  if (start_index + pattern_length > subject_length) return -1;
-
-  sub = String::Flatten(sub);
-  pat = String::Flatten(pat);
-
+// Searches for flat {pat} in flat {sub}, starting at start index.
+static int SearchFlatString(Isolate* isolate, String* sub, String* pat,
+                            int start_index) {
   DisallowHeapAllocation no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
   String::FlatContent seq_sub = sub->GetFlatContent();
@@ -54,6 +40,41 @@ int StringMatch(Isolate* isolate, Handle<String> sub, Handle<String> pat,
 }
 
 
+// Perform string match of pattern on subject, starting at start index.
+// Caller must ensure that 0 <= start_index <= sub->length(),
+// and should check that pat->length() + start_index <= sub->length().
+int StringMatch(Isolate* isolate, Handle<String> sub, Handle<String> pat,
+                int start_index) {
+  DCHECK(0 <= start_index);
+  DCHECK(start_index <= sub->length());
+
+  int pattern_length = pat->length();
+  if (pattern_length == 0) return start_index;
+
+  int subject_length = sub->length();
+  if (start_index + pattern_length > subject_length) return -1;
+
+  pat = String::Flatten(pat);
+
+  if (sub->IsConsString() && !ConsString::cast(*sub)->IsFlat()) {
+    // Strings built by repeated concatenation are left-leaning ropes. A match
+    // in the leftmost flat part is also the first match in the whole string,
+    // so try that part before copying the entire rope.
+    String* leftmost = ConsString::cast(*sub)->first();
+    while (leftmost->IsConsString()) {
+      leftmost = ConsString::cast(leftmost)->first();
+    }
+    if (start_index + pattern_length <= leftmost->length()) {
+      int index = SearchFlatString(isolate, leftmost, *pat, start_index);
+      if (index >= 0) return index;
+    }
+  }
+
+  sub = String::Flatten(sub);
+  return SearchFlatString(isolate, *sub, *pat, start_index);
+}
+
+
 // This may return an empty MaybeHandle if an exception is thrown or
 // we abort due to reaching the recursion limit.
 MaybeHandle<String> StringReplaceOneCharWithString(
@@ -318,6 +339,66 @@ RUNTIME_FUNCTION(Runtime_StringAdd) {
 }
 
 
+namespace {
+
+// Results up to this length are copied into a single flat string, longer
+// results are represented as cons strings like for repeated StringAdd.
+const int kMaxFlatStringConcatLength = 256;
+
+template <typename SeqString, typename Char>
+void StringConcatHelper(Arguments* args, SeqString* result) {
+  DisallowHeapAllocation no_gc;
+  Char* sink = result->GetChars();
+  for (int i = 0; i < args->length(); ++i) {
+    String* string = String::cast((*args)[i]);
+    String::WriteToFlat(string, sink, 0, string->length());
+    sink += string->length();
+  }
+}
+
+}  // namespace
+
+
+RUNTIME_FUNCTION(Runtime_StringConcat) {
+  HandleScope scope(isolate);
+  DCHECK_LE(2, args.length());
+  int length = 0;
+  bool one_byte = true;
+  for (int i = 0; i < args.length(); ++i) {
+    CONVERT_ARG_CHECKED(String, string, i);
+    if (string->length() > String::kMaxLength - length) {
+      THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
+    }
+    length += string->length();
+    one_byte = one_byte && string->HasOnlyOneByteChars();
+  }
+  isolate->counters()->string_add_runtime()->Increment();
+
+  if (length > kMaxFlatStringConcatLength) {
+    CONVERT_ARG_HANDLE_CHECKED(String, result, 0);
+    for (int i = 1; i < args.length(); ++i) {
+      CONVERT_ARG_HANDLE_CHECKED(String, string, i);
+      ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+          isolate, result, isolate->factory()->NewConsString(result, string));
+    }
+    return *result;
+  }
+  if (one_byte) {
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result, isolate->factory()->NewRawOneByteString(length));
+    StringConcatHelper<SeqOneByteString, uint8_t>(&args, *result);
+    return *result;
+  } else {
+    Handle<SeqTwoByteString> result;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result, isolate->factory()->NewRawTwoByteString(length));
+    StringConcatHelper<SeqTwoByteString, uc16>(&args, *result);
+    return *result;
+  }
+}
+
+
 RUNTIME_FUNCTION(Runtime_InternalizeString) {
   HandleScope handles(isolate);
   DCHECK(args.length() == 1);
@@ -490,6 +571,37 @@ RUNTIME_FUNCTION(Runtime_StringBuilderConcat) {
 }
 
 
+template <typename sinkchar>
+static void JoinFixedArrayToFlat(FixedArray* fixed_array, int array_length,
+                                 String* separator, sinkchar* sink,
+                                 int length) {
+#ifdef DEBUG
+  sinkchar* end = sink + length;
+#endif
+  int separator_length = separator->length();
+
+  CHECK(fixed_array->get(0)->IsString());
+  String* first = String::cast(fixed_array->get(0));
+  int first_length = first->length();
+  String::WriteToFlat(first, sink, 0, first_length);
+  sink += first_length;
+
+  for (int i = 1; i < array_length; i++) {
+    DCHECK(sink + separator_length <= end);
+    String::WriteToFlat(separator, sink, 0, separator_length);
+    sink += separator_length;
+
+    CHECK(fixed_array->get(i)->IsString());
+    String* element = String::cast(fixed_array->get(i));
+    int element_length = element->length();
+    DCHECK(sink + element_length <= end);
+    String::WriteToFlat(element, sink, 0, element_length);
+    sink += element_length;
+  }
+  DCHECK(sink == end);
+}
+
+
 RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
@@ -523,10 +635,12 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
     THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
   }
   int length = (array_length - 1) * separator_length;
+  bool one_byte = separator->IsOneByteRepresentation();
   for (int i = 0; i < array_length; i++) {
     Object* element_obj = fixed_array->get(i);
     CHECK(element_obj->IsString());
     String* element = String::cast(element_obj);
+    one_byte = one_byte && element->IsOneByteRepresentation();
     int increment = element->length();
     if (increment > String::kMaxLength - length) {
       STATIC_ASSERT(String::kMaxLength < kMaxInt);
@@ -536,41 +650,22 @@ RUNTIME_FUNCTION(Runtime_StringBuilderJoin) {
     length += increment;
   }
 
+  if (one_byte) {
+    Handle<SeqOneByteString> answer;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, answer, isolate->factory()->NewRawOneByteString(length));
+    DisallowHeapAllocation no_gc;
+    JoinFixedArrayToFlat(*fixed_array, array_length, *separator,
+                         answer->GetChars(), length);
+    return *answer;
+  }
+
   Handle<SeqTwoByteString> answer;
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
       isolate, answer, isolate->factory()->NewRawTwoByteString(length));
-
   DisallowHeapAllocation no_gc;
-
-  uc16* sink = answer->GetChars();
-#ifdef DEBUG
-  uc16* end = sink + length;
-#endif
-
-  CHECK(fixed_array->get(0)->IsString());
-  String* first = String::cast(fixed_array->get(0));
-  String* separator_raw = *separator;
-
-  int first_length = first->length();
-  String::WriteToFlat(first, sink, 0, first_length);
-  sink += first_length;
-
-  for (int i = 1; i < array_length; i++) {
-    DCHECK(sink + separator_length <= end);
-    String::WriteToFlat(separator_raw, sink, 0, separator_length);
-    sink += separator_length;
-
-    CHECK(fixed_array->get(i)->IsString());
-    String* element = String::cast(fixed_array->get(i));
-    int element_length = element->length();
-    DCHECK(sink + element_length <= end);
-    String::WriteToFlat(element, sink, 0, element_length);
-    sink += element_length;
-  }
-  DCHECK(sink == end);
-
-  // Use %_FastOneByteArrayJoin instead.
-  DCHECK(!answer->IsOneByteRepresentation());
+  JoinFixedArrayToFlat(*fixed_array, array_length, *separator,
+                       answer->GetChars(), length);
   return *answer;
 }
 
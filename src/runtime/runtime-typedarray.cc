@@ -4,6 +4,10 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
 #include "src/arguments.h"
 #include "src/factory.h"
 #include "src/messages.h"
@@ -173,9 +177,39 @@ RUNTIME_FUNCTION(Runtime_TypedArrayInitialize) {
 }
 
 
+namespace {
+
+// Converts the first |length| elements of a packed Smi or double backing
+// store like storing each of them into the target typed array from
+// JavaScript would.
+template <typename TargetTraits>
+void ConvertFastArrayElements(FixedArrayBase* source, ElementsKind kind,
+                              void* target, size_t length) {
+  typedef typename TargetTraits::ElementType TargetType;
+  TargetType* to = static_cast<TargetType*>(target);
+  if (kind == FAST_SMI_ELEMENTS) {
+    FixedArray* from = FixedArray::cast(source);
+    for (size_t i = 0; i < length; i++) {
+      to[i] = FixedTypedArray<TargetTraits>::from_int(
+          Smi::cast(from->get(static_cast<int>(i)))->value());
+    }
+  } else {
+    DCHECK_EQ(FAST_DOUBLE_ELEMENTS, kind);
+    FixedDoubleArray* from = FixedDoubleArray::cast(source);
+    for (size_t i = 0; i < length; i++) {
+      to[i] = FixedTypedArray<TargetTraits>::from_double(
+          from->get_scalar(static_cast<int>(i)));
+    }
+  }
+}
+
+}  // namespace
+
+
 // Initializes a typed array from an array-like object.
 // If an array-like object happens to be a typed array of the same type,
-// initializes backing store using memove.
+// initializes backing store using memove. If it is a JSArray with packed Smi
+// or double elements, converts the elements directly.
 //
 // Returns true if backing store was initialized or false otherwise.
 RUNTIME_FUNCTION(Runtime_TypedArrayInitializeFromArrayLike) {
@@ -269,6 +303,29 @@ RUNTIME_FUNCTION(Runtime_TypedArrayInitializeFromArrayLike) {
     }
   }
 
+  if (source->IsJSArray()) {
+    // Reading the elements of a packed array has no side effects, so they can
+    // be converted without the element-wise loop in the caller.
+    Handle<JSArray> array = Handle<JSArray>::cast(source);
+    ElementsKind kind = array->GetElementsKind();
+    uint32_t array_length = 0;
+    if ((kind == FAST_SMI_ELEMENTS || kind == FAST_DOUBLE_ELEMENTS) &&
+        array->length()->ToArrayLength(&array_length) &&
+        array_length == length) {
+      switch (array_type) {
+#define TYPED_ARRAY_CONVERT(Type, type, TYPE, ctype, size)               \
+  case kExternal##Type##Array:                                           \
+    ConvertFastArrayElements<Type##ArrayTraits>(                         \
+        array->elements(), kind, buffer->backing_store(), length);       \
+    break;
+
+        TYPED_ARRAYS(TYPED_ARRAY_CONVERT)
+#undef TYPED_ARRAY_CONVERT
+      }
+      return isolate->heap()->true_value();
+    }
+  }
+
   return isolate->heap()->false_value();
 }
 
@@ -304,12 +361,47 @@ enum TypedArraySetResultCodes {
   // Set from typed array of the different type, overlapping in memory.
   TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING = 1,
   // Set from typed array of the different type, non-overlapping.
+  // This is processed by TypedArraySetFastCases
   TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING = 2,
   // Set from non-typed array.
   TYPED_ARRAY_SET_NON_TYPED_ARRAY = 3
 };
 
 
+namespace {
+
+// Converts |length| elements like storing each source element into the target
+// typed array from JavaScript would, in a loop the compiler can vectorize.
+template <typename SourceType, typename TargetTraits>
+void ConvertTypedArrayElements(const void* source, void* target,
+                               size_t length) {
+  typedef typename TargetTraits::ElementType TargetType;
+  const SourceType* from = static_cast<const SourceType*>(source);
+  TargetType* to = static_cast<TargetType*>(target);
+  for (size_t i = 0; i < length; i++) {
+    to[i] = FixedTypedArray<TargetTraits>::from_double(
+        static_cast<double>(from[i]));
+  }
+}
+
+template <typename TargetTraits>
+void ConvertTypedArrayElementsTo(ExternalArrayType source_type,
+                                 const void* source, void* target,
+                                 size_t length) {
+  switch (source_type) {
+#define TYPED_ARRAY_CONVERT(Type, type, TYPE, ctype, size)                  \
+  case kExternal##Type##Array:                                              \
+    ConvertTypedArrayElements<ctype, TargetTraits>(source, target, length); \
+    break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CONVERT)
+#undef TYPED_ARRAY_CONVERT
+  }
+}
+
+}  // namespace
+
+
 RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
@@ -364,9 +456,62 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
     DCHECK(target->GetBuffer()->backing_store() ==
            source->GetBuffer()->backing_store());
     return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING);
-  } else {  // Non-overlapping typed arrays
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING);
   }
+
+  // Non-overlapping typed arrays of different types: convert natively.
+  uint8_t* target_start = target_base + offset * target->element_size();
+  switch (target->type()) {
+#define TYPED_ARRAY_CONVERT(Type, type_name, TYPE, ctype, size)    \
+  case kExternal##Type##Array:                                     \
+    ConvertTypedArrayElementsTo<Type##ArrayTraits>(                \
+        source->type(), source_base, target_start, source_length); \
+    break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CONVERT)
+#undef TYPED_ARRAY_CONVERT
+  }
+  return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING);
+}
+
+
+namespace {
+
+// Orders numbers like TypedArrayComparefn in typedarray.js: -0 before +0 and
+// NaN after everything else.
+template <typename T>
+bool CompareNum(T x, T y) {
+  if (x < y) return true;
+  if (x > y || std::is_integral<T>::value) return false;
+  double dx = x, dy = y;
+  if (dx == 0 && dy == 0) return std::signbit(dx) && !std::signbit(dy);
+  return !std::isnan(dx) && std::isnan(dy);
+}
+
+}  // namespace
+
+
+// Sorts the elements of a typed array in place in the default numeric order,
+// without calling back into JavaScript.
+RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  size_t length = array->length_value();
+  if (length <= 1) return *array;
+  Handle<FixedTypedArrayBase> elements(
+      FixedTypedArrayBase::cast(array->elements()));
+  switch (array->type()) {
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype, size)     \
+  case kExternal##Type##Array: {                            \
+    ctype* data = static_cast<ctype*>(elements->DataPtr()); \
+    std::sort(data, data + length, CompareNum<ctype>);      \
+    break;                                                  \
+  }
+
+    TYPED_ARRAYS(TYPED_ARRAY_SORT)
+#undef TYPED_ARRAY_SORT
+  }
+  return *array;
 }
 
 
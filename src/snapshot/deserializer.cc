@@ -253,6 +253,15 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
       }
     } else if (obj->IsScript()) {
       new_scripts_.Add(handle(Script::cast(obj)));
+    } else if (obj->IsBytecodeArray()) {
+      // The age was captured in the serializing isolate. Bytecode that has
+      // not run here yet starts out young, or pre-aged like baseline code.
+      BytecodeArray* bytecode_array = BytecodeArray::cast(obj);
+      if (FLAG_serialize_age_code) {
+        bytecode_array->PreAge();
+      } else {
+        bytecode_array->ResetAge();
+      }
     } else {
       DCHECK(CanBeDeferred(obj));
     }
@@ -285,8 +294,8 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
 }
 
 void Deserializer::CommitPostProcessedObjects(Isolate* isolate) {
-  StringTable::EnsureCapacityForDeserialization(
-      isolate, new_internalized_strings_.length());
+  StringTable::EnsureCapacityForBulkInsert(isolate,
+                                           new_internalized_strings_.length());
   for (Handle<String> string : new_internalized_strings_) {
     StringTableInsertionKey key(*string);
     DCHECK_NULL(StringTable::LookupKeyIfExists(isolate, &key));
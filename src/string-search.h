@@ -72,6 +72,10 @@ class StringSearch : private StringSearchBase {
         strategy_ = &SingleCharSearch;
         return;
       }
+      if (sizeof(PatternChar) == 1 && sizeof(SubjectChar) == 1) {
+        strategy_ = &FirstAndLastCharSearch;
+        return;
+      }
       strategy_ = &LinearSearch;
       return;
     }
@@ -113,6 +117,10 @@ class StringSearch : private StringSearchBase {
                           Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int FirstAndLastCharSearch(
+      StringSearch<PatternChar, SubjectChar>* search,
+      Vector<const SubjectChar> subject, int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            Vector<const SubjectChar> subject,
                            int start_index);
@@ -297,6 +305,63 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   return -1;
 }
 
+//---------------------------------------------------------------------
+// First and Last Character Search Strategy
+//---------------------------------------------------------------------
+
+// Linear search for short one-byte patterns in one-byte subjects. Eight start
+// positions are filtered at once by comparing the words holding their first
+// and last characters against the pattern's first and last characters.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::FirstAndLastCharSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    Vector<const SubjectChar> subject, int index) {
+  DCHECK_EQ(1u, sizeof(PatternChar));
+  DCHECK_EQ(1u, sizeof(SubjectChar));
+  const uint8_t* pattern =
+      reinterpret_cast<const uint8_t*>(search->pattern_.start());
+  const uint8_t* chars = reinterpret_cast<const uint8_t*>(subject.start());
+  int pattern_length = search->pattern_.length();
+  DCHECK_LE(2, pattern_length);
+  const uint8_t first_char = pattern[0];
+  const uint8_t last_char = pattern[pattern_length - 1];
+  const int last = pattern_length - 1;
+  // The last position at which the pattern can start.
+  const int n = subject.length() - pattern_length;
+
+  const uint64_t kLowBits = V8_UINT64_C(0x0101010101010101);
+  const uint64_t kHighBits = V8_UINT64_C(0x8080808080808080);
+  const uint64_t first_word = kLowBits * first_char;
+  const uint64_t last_word = kLowBits * last_char;
+  const int kWordSize = static_cast<int>(sizeof(uint64_t));
+
+  int i = index;
+  for (; i <= n - (kWordSize - 1); i += kWordSize) {
+    uint64_t firsts, lasts;
+    memcpy(&firsts, chars + i, kWordSize);
+    memcpy(&lasts, chars + i + last, kWordSize);
+    // A byte of {diff} is zero iff both its first and last character match.
+    // The zero byte test may report extra candidates, never fewer.
+    uint64_t diff = (firsts ^ first_word) | (lasts ^ last_word);
+    if (((diff - kLowBits) & ~diff & kHighBits) == 0) continue;
+    for (int j = i; j < i + kWordSize; j++) {
+      if (chars[j] == first_char && chars[j + last] == last_char &&
+          (pattern_length == 2 ||
+           CharCompare(pattern + 1, chars + j + 1, pattern_length - 2))) {
+        return j;
+      }
+    }
+  }
+  for (; i <= n; i++) {
+    if (chars[i] == first_char && chars[i + last] == last_char &&
+        (pattern_length == 2 ||
+         CharCompare(pattern + 1, chars + i + 1, pattern_length - 2))) {
+      return i;
+    }
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
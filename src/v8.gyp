@@ -601,8 +601,12 @@
         'compiler/load-elimination.h',
         'compiler/loop-analysis.cc',
         'compiler/loop-analysis.h',
+        'compiler/loop-invariant-code-motion.cc',
+        'compiler/loop-invariant-code-motion.h',
         'compiler/loop-peeling.cc',
         'compiler/loop-peeling.h',
+        'compiler/loop-vectorization-analysis.cc',
+        'compiler/loop-vectorization-analysis.h',
         'compiler/machine-operator-reducer.cc',
         'compiler/machine-operator-reducer.h',
         'compiler/machine-operator.cc',
@@ -845,6 +849,8 @@
         'heap/gc-idle-time-handler.h',
         'heap/gc-tracer.cc',
         'heap/gc-tracer.h',
+        'heap/heap-growing-policy.cc',
+        'heap/heap-growing-policy.h',
         'heap/heap-inl.h',
         'heap/heap.cc',
         'heap/heap.h',
@@ -1940,6 +1946,8 @@
         'libplatform/default-platform.h',
         'libplatform/task-queue.cc',
         'libplatform/task-queue.h',
+        'libplatform/trace-buffer.cc',
+        'libplatform/trace-buffer.h',
         'libplatform/worker-thread.cc',
         'libplatform/worker-thread.h',
       ],
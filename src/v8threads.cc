@@ -38,13 +38,10 @@ void Locker::Initialize(v8::Isolate* isolate) {
     has_lock_ = true;
 
     // This may be a locker within an unlocker in which case we have to
-    // get the saved state for this thread and restore it.
+    // get the saved state for this thread and restore it. Otherwise the
+    // stack guard has been set up for the current thread.
     if (isolate_->thread_manager()->RestoreThread()) {
       top_level_ = false;
-    } else {
-      internal::ExecutionAccess access(isolate_);
-      isolate_->stack_guard()->ClearThread(access);
-      isolate_->stack_guard()->InitThread(access);
     }
   }
   DCHECK(isolate_->thread_manager()->IsLockedByCurrentThread());
@@ -125,7 +122,10 @@ bool ThreadManager::RestoreThread() {
   Isolate::PerIsolateThreadData* per_thread =
       isolate_->FindPerThreadDataForThisThread();
   if (per_thread == NULL || per_thread->thread_state() == NULL) {
-    // This is a new thread.
+    // This is a new thread. The stack guard may still hold the limits of
+    // the thread that used the isolate last, so reset it before computing
+    // the limits for this thread.
+    isolate_->stack_guard()->ClearThread(access);
     isolate_->stack_guard()->InitThread(access);
     return false;
   }
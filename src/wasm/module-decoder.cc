@@ -796,6 +796,18 @@ ModuleResult DecodeWasmModule(Isolate* isolate, Zone* zone,
   return result;
 }
 
+ModuleResult DecodeWasmModuleInBackground(Zone* zone, const byte* module_start,
+                                          const byte* module_end,
+                                          bool verify_functions,
+                                          ModuleOrigin origin) {
+  size_t size = module_end - module_start;
+  if (module_start > module_end) return ModuleError("start > end");
+  if (size >= kMaxModuleSize) return ModuleError("size > maximum module size");
+  WasmModule* module = new WasmModule();
+  ModuleDecoder decoder(zone, module_start, module_end, origin);
+  return decoder.DecodeModule(module, verify_functions);
+}
+
 FunctionSig* DecodeWasmSignatureForTesting(Zone* zone, const byte* start,
                                            const byte* end) {
   ModuleDecoder decoder(zone, start, end, kWasmOrigin);
@@ -16,6 +16,13 @@ ModuleResult DecodeWasmModule(Isolate* isolate, Zone* zone,
                               const byte* module_start, const byte* module_end,
                               bool verify_functions, ModuleOrigin origin);
 
+// Like DecodeWasmModule, but does not update the isolate's counters, so it can
+// be used from a background thread.
+ModuleResult DecodeWasmModuleInBackground(Zone* zone, const byte* module_start,
+                                          const byte* module_end,
+                                          bool verify_functions,
+                                          ModuleOrigin origin);
+
 // Exposed for testing. Decodes a single function signature, allocating it
 // in the given zone. Returns {nullptr} upon failure.
 FunctionSig* DecodeWasmSignatureForTesting(Zone* zone, const byte* start,
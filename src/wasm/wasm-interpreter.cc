@@ -663,10 +663,15 @@ static const int kRunSteps = 1000;
 class ControlTransfers : public ZoneObject {
  public:
   ControlTransferMap map_;
+  // Dense copy of {map_} for constant-time lookups while executing. For each
+  // offset, {index_} holds 1 + the position of its entry in {transfers_}, or
+  // 0 if there is no control transfer at that offset.
+  ZoneVector<uint32_t> index_;
+  ZoneVector<ControlTransfer> transfers_;
 
   ControlTransfers(Zone* zone, size_t locals_encoded_size, const byte* start,
                    const byte* end)
-      : map_(zone) {
+      : map_(zone), index_(zone), transfers_(zone) {
     // A control reference including from PC, from value depth, and whether
     // a value is explicitly passed (e.g. br/br_if/br_table with value).
     struct CRef {
@@ -838,14 +843,21 @@ class ControlTransfers : public ZoneObject {
 
       pc += OpcodeLength(pc, end);
     }
+
+    index_.resize(static_cast<size_t>(end - start), 0);
+    transfers_.reserve(map_.size());
+    for (auto& entry : map_) {
+      transfers_.push_back(entry.second);
+      index_[entry.first] = static_cast<uint32_t>(transfers_.size());
+    }
   }
 
   ControlTransfer Lookup(pc_t from) {
-    auto result = map_.find(from);
-    if (result == map_.end()) {
+    uint32_t entry = from < index_.size() ? index_[from] : 0;
+    if (entry == 0) {
       V8_Fatal(__FILE__, __LINE__, "no control target for pc %zu", from);
     }
-    return result->second;
+    return transfers_[entry - 1];
   }
 };
 
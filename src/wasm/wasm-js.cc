@@ -7,6 +7,7 @@
 #include "src/assert-scope.h"
 #include "src/ast/ast.h"
 #include "src/ast/scopes.h"
+#include "src/cancelable-task.h"
 #include "src/execution.h"
 #include "src/factory.h"
 #include "src/handles.h"
@@ -14,6 +15,7 @@
 #include "src/objects.h"
 #include "src/parsing/parser.h"
 #include "src/typing-asm.h"
+#include "src/v8.h"
 
 #include "src/wasm/asm-wasm-builder.h"
 #include "src/wasm/encoder.h"
@@ -312,6 +314,128 @@ static i::MaybeHandle<i::JSObject> CreateModuleObject(
   return module_obj;
 }
 
+namespace {
+
+// Validates the module bytes passed to WebAssembly.compile() on a background
+// thread, then settles the promise in a short task on the foreground thread.
+// The job owns a copy of the bytes, as the buffer may be modified or detached
+// in the meantime.
+//
+// The job is owned by whichever task is pending, so it is freed even if the
+// tasks are canceled at isolate teardown. Since a task may then be deleted on
+// any thread, or after the isolate is gone, the job keeps its JavaScript
+// objects in raw global handles that are only released by Finish; a job that
+// never finishes leaves them to be freed with the isolate.
+class AsyncCompileJob {
+ public:
+  AsyncCompileJob(i::Isolate* isolate, RawBuffer buffer,
+                  i::Handle<i::Context> context,
+                  i::Handle<i::JSObject> resolver,
+                  i::Handle<i::JSObject> module_obj)
+      : isolate_(isolate),
+        bytes_(i::NewArray<byte>(buffer.size())),
+        length_(buffer.size()),
+        context_(isolate->global_handles()->Create(*context).location()),
+        resolver_(isolate->global_handles()->Create(*resolver).location()),
+        module_obj_(isolate->global_handles()->Create(*module_obj).location()),
+        decode_memory_(0) {
+    i::MemCopy(bytes_.get(), buffer.start, length_);
+  }
+
+  static void Start(AsyncCompileJob* job) {
+    i::V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new DecodeTask(job), v8::Platform::kLongRunningTask);
+  }
+
+ private:
+  class DecodeTask : public i::CancelableTask {
+   public:
+    explicit DecodeTask(AsyncCompileJob* job)
+        : i::CancelableTask(job->isolate_), job_(job) {}
+
+    void RunInternal() override {
+      job_->Decode();
+      i::V8::GetCurrentPlatform()->CallOnForegroundThread(
+          reinterpret_cast<v8::Isolate*>(isolate()),
+          new FinishTask(job_.Detach()));
+    }
+
+   private:
+    base::SmartPointer<AsyncCompileJob> job_;
+  };
+
+  class FinishTask : public i::CancelableTask {
+   public:
+    explicit FinishTask(AsyncCompileJob* job)
+        : i::CancelableTask(job->isolate_), job_(job) {}
+
+    void RunInternal() override { job_->Finish(); }
+
+   private:
+    base::SmartPointer<AsyncCompileJob> job_;
+  };
+
+  // Runs on a background thread, so it must not touch the isolate, which
+  // includes its counters.
+  void Decode() {
+    i::Zone zone(isolate_->allocator());
+    i::wasm::ModuleResult result = i::wasm::DecodeWasmModuleInBackground(
+        &zone, bytes_.get(), bytes_.get() + length_, true,
+        i::wasm::kWasmOrigin);
+    decode_memory_ = zone.allocation_size();
+    if (result.failed()) {
+      std::ostringstream str;
+      str << "WebAssembly.compile(): " << result;
+      error_ = str.str();
+    }
+    if (result.val) delete result.val;
+  }
+
+  void Finish() {
+    isolate_->counters()->wasm_module_size_bytes()->AddSample(
+        static_cast<int>(length_));
+    isolate_->counters()->wasm_decode_module_peak_memory_bytes()->AddSample(
+        static_cast<int>(decode_memory_));
+
+    v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    HandleScope scope(isolate);
+    i::Handle<i::Context> i_context(i::Context::cast(*context_), isolate_);
+    i::Handle<i::JSObject> i_resolver(i::JSObject::cast(*resolver_), isolate_);
+    i::Handle<i::JSObject> i_module_obj(i::JSObject::cast(*module_obj_),
+                                        isolate_);
+    i::GlobalHandles::Destroy(context_);
+    i::GlobalHandles::Destroy(resolver_);
+    i::GlobalHandles::Destroy(module_obj_);
+
+    Local<Context> context = Utils::ToLocal(i_context);
+    Context::Scope context_scope(context);
+    Local<Promise::Resolver> resolver =
+        Local<Promise::Resolver>::Cast(Utils::ToLocal(i_resolver));
+    if (error_.empty()) {
+      resolver->Resolve(context, Utils::ToLocal(i_module_obj));
+    } else {
+      Local<String> message =
+          String::NewFromUtf8(isolate, error_.c_str(), NewStringType::kNormal)
+              .ToLocalChecked();
+      resolver->Reject(context, v8::Exception::Error(message));
+    }
+    MicrotasksScope::PerformCheckpoint(isolate);
+  }
+
+  i::Isolate* isolate_;
+  base::SmartArrayPointer<byte> bytes_;
+  size_t length_;
+  i::Object** context_;
+  i::Object** resolver_;
+  i::Object** module_obj_;
+  size_t decode_memory_;
+  std::string error_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsyncCompileJob);
+};
+
+}  // namespace
+
 void WebAssemblyCompile(const v8::FunctionCallbackInfo<v8::Value>& args) {
   v8::Isolate* isolate = args.GetIsolate();
   HandleScope scope(isolate);
@@ -329,7 +453,16 @@ void WebAssemblyCompile(const v8::FunctionCallbackInfo<v8::Value>& args) {
   Local<Context> context = isolate->GetCurrentContext();
   v8::Local<v8::Promise::Resolver> resolver;
   if (!v8::Promise::Resolver::New(context).ToLocal(&resolver)) return;
-  resolver->Resolve(context, Utils::ToLocal(module_obj.ToHandleChecked()));
+  if (i::FLAG_wasm_async_compilation) {
+    RawBuffer buffer = GetRawBufferSource(args[0], &thrower);
+    AsyncCompileJob::Start(new AsyncCompileJob(
+        reinterpret_cast<i::Isolate*>(isolate), buffer,
+        Utils::OpenHandle(*context),
+        i::Handle<i::JSObject>::cast(Utils::OpenHandle(*resolver)),
+        module_obj.ToHandleChecked()));
+  } else {
+    resolver->Resolve(context, Utils::ToLocal(module_obj.ToHandleChecked()));
+  }
 
   v8::ReturnValue<v8::Value> return_value = args.GetReturnValue();
   return_value.Set(resolver->GetPromise());
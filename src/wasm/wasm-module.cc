@@ -414,31 +414,45 @@ static MaybeHandle<JSFunction> LookupFunction(
 }
 
 namespace {
-// Fetches the compilation unit of a wasm function and executes its parallel
-// phase.
+// The number of compilation units a background task claims at once. Modules
+// often consist of many small functions, for which the atomic increment and
+// the lock on {executed_units} are a noticeable part of the per-function cost.
+static const size_t kCompilationUnitBatchSize = 8;
+
+// Fetches up to {batch_size} compilation units of wasm functions and executes
+// their parallel phase. The executed units are enqueued together.
 bool FetchAndExecuteCompilationUnit(
     Isolate* isolate,
     std::vector<compiler::WasmCompilationUnit*>* compilation_units,
     std::queue<compiler::WasmCompilationUnit*>* executed_units,
-    base::Mutex* result_mutex, base::AtomicNumber<size_t>* next_unit) {
+    base::Mutex* result_mutex, base::AtomicNumber<size_t>* next_unit,
+    size_t batch_size = 1) {
   DisallowHeapAllocation no_allocation;
   DisallowHandleAllocation no_handles;
   DisallowHandleDereference no_deref;
   DisallowCodeDependencyChange no_dependency_change;
 
-  // - 1 because AtomicIntrement returns the value after the atomic increment.
-  size_t index = next_unit->Increment(1) - 1;
-  if (index >= compilation_units->size()) {
+  DCHECK_LT(0u, batch_size);
+  // - batch_size because AtomicIncrement returns the value after the atomic
+  // increment.
+  size_t start = next_unit->Increment(batch_size) - batch_size;
+  if (start >= compilation_units->size()) {
     return false;
   }
-
-  compiler::WasmCompilationUnit* unit = compilation_units->at(index);
-  if (unit != nullptr) {
+  size_t end = std::min(start + batch_size, compilation_units->size());
+
+  compiler::WasmCompilationUnit* batch[kCompilationUnitBatchSize];
+  DCHECK_GE(kCompilationUnitBatchSize, batch_size);
+  size_t executed = 0;
+  for (size_t index = start; index < end; ++index) {
+    compiler::WasmCompilationUnit* unit = compilation_units->at(index);
+    if (unit == nullptr) continue;
     unit->ExecuteCompilation();
-    {
-      base::LockGuard<base::Mutex> guard(result_mutex);
-      executed_units->push(unit);
-    }
+    batch[executed++] = unit;
+  }
+  if (executed > 0) {
+    base::LockGuard<base::Mutex> guard(result_mutex);
+    for (size_t i = 0; i < executed; ++i) executed_units->push(batch[i]);
   }
   return true;
 }
@@ -460,9 +474,9 @@ class WasmCompilationTask : public CancelableTask {
         next_unit_(next_unit) {}
 
   void RunInternal() override {
-    while (FetchAndExecuteCompilationUnit(isolate_, compilation_units_,
-                                          executed_units_, result_mutex_,
-                                          next_unit_)) {
+    while (FetchAndExecuteCompilationUnit(
+        isolate_, compilation_units_, executed_units_, result_mutex_,
+        next_unit_, kCompilationUnitBatchSize)) {
     }
     on_finished_->Signal();
   }
@@ -475,6 +489,30 @@ class WasmCompilationTask : public CancelableTask {
   base::AtomicNumber<size_t>* next_unit_;
 };
 
+bool SignaturesEqual(const FunctionSig* a, const FunctionSig* b) {
+  if (a == b) return true;
+  if (a->return_count() != b->return_count()) return false;
+  if (a->parameter_count() != b->parameter_count()) return false;
+  for (size_t i = 0; i < a->return_count(); ++i) {
+    if (a->GetReturn(i) != b->GetReturn(i)) return false;
+  }
+  for (size_t i = 0; i < a->parameter_count(); ++i) {
+    if (a->GetParam(i) != b->GetParam(i)) return false;
+  }
+  return true;
+}
+
+// Returns the wrapper in {wrappers} that was compiled for {sig}, or a null
+// handle if there is none.
+Handle<Code> FindWrapper(
+    const std::vector<std::pair<FunctionSig*, Handle<Code>>>& wrappers,
+    const FunctionSig* sig) {
+  for (const auto& entry : wrappers) {
+    if (SignaturesEqual(entry.first, sig)) return entry.second;
+  }
+  return Handle<Code>::null();
+}
+
 // Records statistics on the code generated by compiling WASM functions.
 struct CodeStats {
   size_t code_size;
@@ -543,7 +581,7 @@ uint32_t* StartCompilationTasks(
                                 pending_tasks, &result_mutex, &next_unit);
     task_ids[i] = task->id();
     V8::GetCurrentPlatform()->CallOnBackgroundThread(
-        task, v8::Platform::kShortRunningTask);
+        task, v8::Platform::kLongRunningTask);
   }
   return task_ids;
 }
@@ -595,10 +633,11 @@ void CompileInParallel(Isolate* isolate, const WasmModule* module,
   //    and stores them in the vector {compilation_units}.
   // 2) The main thread spawns {WasmCompilationTask} instances which run on
   //    the background threads.
-  // 3.a) The background threads and the main thread pick one compilation
-  //      unit at a time and execute the parallel phase of the compilation
-  //      unit. After finishing the execution of the parallel phase, the
-  //      result is enqueued in {executed_units}.
+  // 3.a) The background threads pick a batch of compilation units at a
+  //      time, the main thread picks one compilation unit at a time, and
+  //      they execute the parallel phase of the compilation units. After
+  //      finishing the execution of the parallel phase, the results are
+  //      enqueued in {executed_units}.
   // 3.b) If {executed_units} contains a compilation unit, the main thread
   //      dequeues it and finishes the compilation.
   // 4) After the parallel phase of all compilation units has started, the
@@ -625,10 +664,11 @@ void CompileInParallel(Isolate* isolate, const WasmModule* module,
       isolate, compilation_units, executed_units, module->pending_tasks.get(),
       result_mutex, next_unit));
 
-  // 3.a) The background threads and the main thread pick one compilation
-  //      unit at a time and execute the parallel phase of the compilation
-  //      unit. After finishing the execution of the parallel phase, the
-  //      result is enqueued in {executed_units}.
+  // 3.a) The background threads pick a batch of compilation units at a
+  //      time, the main thread picks one compilation unit at a time, and
+  //      they execute the parallel phase of the compilation units. After
+  //      finishing the execution of the parallel phase, the results are
+  //      enqueued in {executed_units}.
   while (FetchAndExecuteCompilationUnit(isolate, &compilation_units,
                                         &executed_units, &result_mutex,
                                         &next_unit)) {
@@ -882,15 +922,28 @@ MaybeHandle<JSObject> WasmModule::Instantiate(
       PropertyDescriptor desc;
       desc.set_writable(false);
 
-      // Compile wrappers and add them to the exports object.
+      // Compile wrappers and add them to the exports object. Exports with
+      // the signature of an earlier export reuse that export's wrapper.
+      std::vector<std::pair<FunctionSig*, Handle<Code>>> wrappers;
       for (const WasmExport& exp : export_table) {
         if (thrower.error()) break;
         WasmName str = GetName(exp.name_offset, exp.name_length);
         Handle<String> name = factory->InternalizeUtf8String(str);
         Handle<Code> code = instance.function_code[exp.func_index];
-        Handle<JSFunction> function = compiler::CompileJSToWasmWrapper(
-            isolate, &module_env, name, code, instance.js_object,
-            exp.func_index);
+        FunctionSig* sig = functions[exp.func_index].sig;
+        Handle<Code> wrapper = FindWrapper(wrappers, sig);
+        Handle<JSFunction> function;
+        if (wrapper.is_null()) {
+          function = compiler::CompileJSToWasmWrapper(
+              isolate, &module_env, name, code, instance.js_object,
+              exp.func_index);
+          wrappers.push_back(
+              std::make_pair(sig, handle(function->code(), isolate)));
+        } else {
+          function = compiler::CloneJSToWasmWrapper(
+              isolate, &module_env, name, code, instance.js_object,
+              exp.func_index, wrapper);
+        }
         if (FLAG_print_wasm_code_size) {
           code_stats.Record(function->code());
         }
@@ -78,7 +78,8 @@ Zone::Zone(base::AccountingAllocator* allocator)
       position_(0),
       limit_(0),
       allocator_(allocator),
-      segment_head_(nullptr) {}
+      segment_head_(nullptr),
+      budget_(nullptr) {}
 
 Zone::~Zone() {
   DeleteAll();
@@ -200,11 +201,20 @@ void Zone::DeleteKeptSegment() {
 }
 
 
+void Zone::set_budget(ZoneBudget* budget) {
+  if (budget_ != nullptr) budget_->Decrease(segment_bytes_allocated_);
+  budget_ = budget;
+  if (budget_ != nullptr) budget_->Increase(segment_bytes_allocated_);
+}
+
+
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(size_t size) {
-  Segment* result = reinterpret_cast<Segment*>(allocator_->Allocate(size));
+  Segment* result =
+      reinterpret_cast<Segment*>(allocator_->AllocateSegment(size));
   segment_bytes_allocated_ += size;
+  if (budget_ != nullptr) budget_->Increase(size);
   if (result != nullptr) {
     result->Initialize(segment_head_, size);
     segment_head_ = result;
@@ -216,7 +226,10 @@ Segment* Zone::NewSegment(size_t size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, size_t size) {
   segment_bytes_allocated_ -= size;
-  allocator_->Free(segment, size);
+  if (budget_ != nullptr) budget_->Decrease(size);
+  // Pooled segments are handed out to other zones again.
+  ASAN_UNPOISON_MEMORY_REGION(segment, size);
+  allocator_->ReturnSegment(segment, size);
 }
 
 
@@ -253,6 +266,12 @@ Address Zone::NewExpand(size_t size) {
     // requested size.
     new_size = Max(min_new_size, kMaximumSegmentSize);
   }
+  if (new_size <= base::AccountingAllocator::kMaxPooledSegmentSize) {
+    // Small segments are rounded up to a size that can be pooled by the
+    // allocator.
+    new_size =
+        base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(new_size));
+  }
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory("Zone");
     return nullptr;
@@ -21,6 +21,32 @@ namespace internal {
 class Segment;
 
 
+// Tracks the segment memory of a group of zones against a limit. Zones keep
+// allocating once the limit is exceeded, since their users cannot handle
+// allocation failure; instead, the owner of the budget is expected to check
+// exceeded() at safe points and abandon its work.
+class ZoneBudget final {
+ public:
+  // A limit of 0 means that the budget is never exceeded.
+  explicit ZoneBudget(size_t limit) : limit_(limit), allocated_bytes_(0) {}
+
+  void Increase(size_t bytes) { allocated_bytes_ += bytes; }
+  void Decrease(size_t bytes) {
+    DCHECK_LE(bytes, allocated_bytes_);
+    allocated_bytes_ -= bytes;
+  }
+
+  bool exceeded() const { return limit_ > 0 && allocated_bytes_ > limit_; }
+  size_t allocated_bytes() const { return allocated_bytes_; }
+
+ private:
+  const size_t limit_;
+  size_t allocated_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(ZoneBudget);
+};
+
+
 // The Zone supports very fast allocation of small chunks of
 // memory. The chunks cannot be deallocated individually, but instead
 // the Zone supports deallocating all chunks in one fast
@@ -64,6 +90,11 @@ class Zone final {
 
   size_t allocation_size() const { return allocation_size_; }
 
+  // Accounts the segments of this zone to the given budget, which may be
+  // nullptr. The budget must outlive the zone or be reset before.
+  void set_budget(ZoneBudget* budget);
+  ZoneBudget* budget() const { return budget_; }
+
   base::AccountingAllocator* allocator() const { return allocator_; }
 
  private:
@@ -119,6 +150,8 @@ class Zone final {
   base::AccountingAllocator* allocator_;
 
   Segment* segment_head_;
+
+  ZoneBudget* budget_;
 };
 
 
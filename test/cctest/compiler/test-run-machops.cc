@@ -6413,6 +6413,82 @@ TEST(ParentFramePointer) {
   CHECK_EQ(1, r.Call(1));
 }
 
+#if V8_TARGET_ARCH_X64
+TEST(RunFloat32x4CreateAndExtractLane) {
+  for (int lane = 0; lane < 4; ++lane) {
+    BufferedRawMachineAssemblerTester<float> m(MachineType::Float32(),
+                                               MachineType::Float32());
+    Node* value = m.AddNode(m.machine()->CreateFloat32x4(), m.Parameter(0),
+                            m.Parameter(1), m.Float32Constant(3.5f),
+                            m.Float32Constant(-1.25f));
+    m.Return(m.AddNode(m.machine()->Float32x4ExtractLane(), value,
+                       m.Int32Constant(lane)));
+    FOR_FLOAT32_INPUTS(i) {
+      FOR_FLOAT32_INPUTS(j) {
+        float expected[] = {*i, *j, 3.5f, -1.25f};
+        CHECK_FLOAT_EQ(expected[lane], m.Call(*i, *j));
+      }
+    }
+  }
+}
+
+
+static void RunFloat32x4Binop(const Operator* (MachineOperatorBuilder::*op)(),
+                              float (*expected)(float, float)) {
+  for (int lane = 0; lane < 4; ++lane) {
+    BufferedRawMachineAssemblerTester<float> m(MachineType::Float32(),
+                                               MachineType::Float32());
+    Node* lhs = m.AddNode(m.machine()->CreateFloat32x4(), m.Parameter(0),
+                          m.Parameter(0), m.Parameter(0), m.Parameter(0));
+    Node* rhs = m.AddNode(m.machine()->CreateFloat32x4(), m.Parameter(1),
+                          m.Parameter(1), m.Parameter(1), m.Parameter(1));
+    Node* result = m.AddNode((m.machine()->*op)(), lhs, rhs);
+    m.Return(m.AddNode(m.machine()->Float32x4ExtractLane(), result,
+                       m.Int32Constant(lane)));
+    FOR_FLOAT32_INPUTS(i) {
+      FOR_FLOAT32_INPUTS(j) {
+        CHECK_FLOAT_EQ(expected(*i, *j), m.Call(*i, *j));
+      }
+    }
+  }
+}
+
+
+TEST(RunFloat32x4Add) {
+  RunFloat32x4Binop(&MachineOperatorBuilder::Float32x4Add,
+                    [](float a, float b) { return a + b; });
+}
+
+
+TEST(RunFloat32x4Sub) {
+  RunFloat32x4Binop(&MachineOperatorBuilder::Float32x4Sub,
+                    [](float a, float b) { return a - b; });
+}
+
+
+TEST(RunFloat32x4Mul) {
+  RunFloat32x4Binop(&MachineOperatorBuilder::Float32x4Mul,
+                    [](float a, float b) { return a * b; });
+}
+
+
+TEST(RunFloat32x4Div) {
+  RunFloat32x4Binop(&MachineOperatorBuilder::Float32x4Div,
+                    [](float a, float b) { return a / b; });
+}
+
+
+TEST(RunFloat32x4Sqrt) {
+  BufferedRawMachineAssemblerTester<float> m(MachineType::Float32());
+  Node* value = m.AddNode(m.machine()->CreateFloat32x4(), m.Parameter(0),
+                          m.Parameter(0), m.Parameter(0), m.Parameter(0));
+  m.Return(m.AddNode(m.machine()->Float32x4ExtractLane(),
+                     m.AddNode(m.machine()->Float32x4Sqrt(), value),
+                     m.Int32Constant(2)));
+  FOR_FLOAT32_INPUTS(i) { CHECK_FLOAT_EQ(std::sqrt(*i), m.Call(*i)); }
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
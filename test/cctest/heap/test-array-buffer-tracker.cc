@@ -78,6 +78,61 @@ TEST(ArrayBuffer_OnlyScavenge) {
   CHECK(!IsTracked(raw_ab));
 }
 
+namespace {
+
+class CountingAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  explicit CountingAllocator(v8::ArrayBuffer::Allocator* allocator)
+      : allocator_(allocator) {}
+
+  void* Allocate(size_t length) override {
+    return allocator_->Allocate(length);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return allocator_->AllocateUninitialized(length);
+  }
+  void Free(void* data, size_t length) override {
+    freed_.Increment(1);
+    allocator_->Free(data, length);
+  }
+
+  int freed() { return freed_.Value(); }
+
+ private:
+  v8::ArrayBuffer::Allocator* allocator_;
+  base::AtomicNumber<int> freed_;
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(ArrayBuffer_ConcurrentFreeingAfterScavenge) {
+  FLAG_concurrent_array_buffer_freeing = true;
+  CountingAllocator allocator(CcTest::array_buffer_allocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+
+    const int kBuffers = 10;
+    {
+      v8::HandleScope inner_scope(isolate);
+      for (int i = 0; i < kBuffers; i++) {
+        Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, 100);
+        CHECK(heap->InNewSpace(*v8::Utils::OpenHandle(*ab)));
+      }
+    }
+    heap->CollectGarbage(NEW_SPACE);
+    heap->array_buffer_freer()->WaitUntilCompleted();
+    CHECK_EQ(kBuffers, allocator.freed());
+  }
+  isolate->Dispose();
+}
+
 TEST(ArrayBuffer_ScavengeAndMC) {
   CcTest::InitializeVM();
   LocalContext env;
@@ -131,6 +131,43 @@ static void CheckFindCodeObject(Isolate* isolate) {
 }
 
 
+TEST(FindCodeObjectWhileSweepingCodeSpace) {
+  if (!FLAG_concurrent_sweeping) return;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+#define __ assm.
+  Assembler assm(isolate, NULL, 0);
+  __ nop();
+#undef __
+  CodeDesc desc;
+  assm.GetCode(&desc);
+  Handle<Code> code = isolate->factory()->NewCode(
+      desc, Code::ComputeFlags(Code::STUB), Handle<Code>());
+  {
+    // Create some dead code objects so that the code space pages need to be
+    // swept.
+    HandleScope inner_scope(isolate);
+    for (int i = 0; i < 100; i++) {
+      isolate->factory()->NewCode(desc, Code::ComputeFlags(Code::STUB),
+                                  Handle<Code>());
+    }
+  }
+  heap->CollectAllGarbage();
+
+  // Looking up the code object has to sweep the page first (or wait for the
+  // concurrent sweeper) so that the skip list is valid.
+  Address obj_addr = code->address();
+  for (int i = 0; i < code->Size(); i += kPointerSize) {
+    CHECK_EQ(*code, isolate->FindCodeObject(obj_addr + i));
+  }
+  CHECK(Page::FromAddress(obj_addr)->SweepingDone());
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+}
+
+
 TEST(HandleNull) {
   CcTest::InitializeVM();
   Isolate* isolate = CcTest::i_isolate();
@@ -750,6 +787,78 @@ TEST(PromoteGreyOrBlackObjectsOnScavenge) {
   CHECK(!heap->InNewSpace(*marked));
 }
 
+TEST(ParallelScavenge) {
+  FLAG_parallel_scavenge = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  heap->incremental_marking()->Stop();
+
+  HandleScope scope(isolate);
+  const int kLength = 1000;
+  // Old-to-new references are scavenged from the remembered set.
+  Handle<FixedArray> old_array = factory->NewFixedArray(kLength, TENURED);
+  // New space objects sharing a common tail are reachable from several tasks.
+  Handle<FixedArray> shared = factory->NewFixedArray(2);
+  shared->set(0, Smi::FromInt(42));
+  for (int i = 0; i < kLength; i++) {
+    Handle<FixedArray> element = factory->NewFixedArray(2);
+    element->set(0, Smi::FromInt(i));
+    element->set(1, *shared);
+    old_array->set(i, *element);
+  }
+  CHECK(heap->InNewSpace(old_array->get(0)));
+
+  // The first scavenge copies within new space, the second one promotes.
+  for (int gc = 0; gc < 2; gc++) {
+    heap->CollectGarbage(NEW_SPACE);
+    Object* first_shared = FixedArray::cast(old_array->get(0))->get(1);
+    for (int i = 0; i < kLength; i++) {
+      FixedArray* element = FixedArray::cast(old_array->get(i));
+      CHECK_EQ(Smi::FromInt(i), element->get(0));
+      CHECK_EQ(first_shared, element->get(1));
+    }
+    CHECK_EQ(*shared, first_shared);
+    CHECK_EQ(Smi::FromInt(42), shared->get(0));
+  }
+  CHECK(!heap->InNewSpace(*shared));
+}
+
+TEST(ParallelScavengeOldToNewSlots) {
+  FLAG_parallel_scavenge = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  heap->incremental_marking()->Stop();
+
+  HandleScope scope(isolate);
+  // Large old arrays spread the remembered set over many pages, which are
+  // distributed over the scavenging tasks.
+  const int kArrays = 16;
+  const int kLength = 32 * KB;
+  const int kStride = 256;
+  Handle<FixedArray> arrays[kArrays];
+  for (int i = 0; i < kArrays; i++) {
+    arrays[i] = factory->NewFixedArray(kLength, TENURED);
+    CHECK(!heap->InNewSpace(*arrays[i]));
+    for (int j = 0; j < kLength; j += kStride) {
+      Handle<HeapNumber> number = factory->NewHeapNumber(i * kLength + j);
+      arrays[i]->set(j, *number);
+    }
+  }
+
+  for (int gc = 0; gc < 2; gc++) {
+    heap->CollectGarbage(NEW_SPACE);
+    for (int i = 0; i < kArrays; i++) {
+      for (int j = 0; j < kLength; j += kStride) {
+        CHECK_EQ(i * kLength + j, HeapNumber::cast(arrays[i]->get(j))->value());
+      }
+    }
+  }
+}
+
 TEST(BytecodeArray) {
   static const uint8_t kRawBytes[] = {0xc3, 0x7e, 0xa5, 0x5a};
   static const int kRawBytesSize = sizeof(kRawBytes);
@@ -1286,6 +1395,59 @@ UNINITIALIZED_TEST(TestCodeFlushing) {
 }
 
 
+TEST(TestBytecodeFlushing) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code) return;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_ignition = true;
+  i::FLAG_flush_bytecode = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function foo() {"
+      "  var x = 42;"
+      "  var y = 42;"
+      "  var z = x + y;"
+      "};"
+      "foo()";
+  Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(source);
+  }
+
+  // Check function is compiled to bytecode.
+  Handle<Object> func_value =
+      Object::GetProperty(isolate->global_object(), foo_name).ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  if (!function->shared()->HasBytecodeArray()) return;
+  CHECK(function->shared()->is_compiled());
+
+  // The bytecode will survive at least two GCs.
+  CcTest::heap()->CollectAllGarbage();
+  CcTest::heap()->CollectAllGarbage();
+  CHECK(function->shared()->HasBytecodeArray());
+
+  // Simulate several GCs that use full marking.
+  const int kAgingThreshold = BytecodeArray::kIsOldBytecodeAge + 1;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CcTest::heap()->CollectAllGarbage();
+  }
+
+  // The bytecode should be gone and foo reset to lazy compilation.
+  CHECK(!function->shared()->HasBytecodeArray() || function->IsOptimized());
+  CHECK(!function->is_compiled() || function->IsOptimized());
+  // Call foo to get it recompiled.
+  CompileRun("foo()");
+  CHECK(function->shared()->is_compiled());
+  CHECK(function->is_compiled());
+}
+
+
 TEST(TestCodeFlushingPreAged) {
   // If we do not flush code this test is invalid.
   if (!FLAG_flush_code) return;
@@ -1666,6 +1828,63 @@ TEST(CompilationCacheCachingBehavior) {
 }
 
 
+TEST(CompilationCacheAgingWithIgnition) {
+  // If we have the compilation cache turned off, this test is invalid.
+  if (!FLAG_compilation_cache || FLAG_optimize_for_size) return;
+  // Script entries need to age by their bytecode even if bytecode is not
+  // flushed.
+  i::FLAG_ignition = true;
+  i::FLAG_flush_bytecode = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
+
+  v8::HandleScope scope(CcTest::isolate());
+  const char* raw_source =
+      "function foo() {"
+      "  var x = 42;"
+      "  var y = 42;"
+      "  var z = x + y;"
+      "};"
+      "foo()";
+  Handle<String> source = factory->InternalizeUtf8String(raw_source);
+  Handle<Context> native_context = isolate->native_context();
+
+  {
+    v8::HandleScope scope(CcTest::isolate());
+    CompileRun(raw_source);
+  }
+
+  MaybeHandle<SharedFunctionInfo> info = compilation_cache->LookupScript(
+      source, Handle<Object>(), 0, 0,
+      v8::ScriptOriginOptions(false, true, false), native_context,
+      language_mode);
+  CHECK(!info.is_null());
+  CHECK(info.ToHandleChecked()->HasBytecodeArray());
+
+  // The entry survives a GC...
+  heap->CollectAllGarbage();
+  info = compilation_cache->LookupScript(
+      source, Handle<Object>(), 0, 0,
+      v8::ScriptOriginOptions(false, true, false), native_context,
+      language_mode);
+  CHECK(!info.is_null());
+
+  // ...but is removed once its bytecode got old.
+  for (int i = 0; i < BytecodeArray::kIsOldBytecodeAge; i++) {
+    heap->CollectAllGarbage();
+  }
+  info = compilation_cache->LookupScript(
+      source, Handle<Object>(), 0, 0,
+      v8::ScriptOriginOptions(false, true, false), native_context,
+      language_mode);
+  CHECK(info.is_null());
+}
+
+
 static void OptimizeEmptyFunction(const char* name) {
   HandleScope scope(CcTest::i_isolate());
   EmbeddedVector<char, 256> source;
@@ -4586,6 +4805,86 @@ TEST(LargeObjectSlotRecording) {
 }
 
 
+TEST(YoungLargeObjectDiesInScavenge) {
+  FLAG_young_generation_large_objects = true;
+  FLAG_parallel_scavenge = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  int length = Page::kMaxRegularHeapObjectSize / kPointerSize + 1;
+  int page_count = heap->lo_space()->PageCount();
+  {
+    HandleScope inner_scope(isolate);
+    Handle<FixedArray> lo = isolate->factory()->NewFixedArray(length);
+    CHECK(heap->lo_space()->Contains(*lo));
+    CHECK(heap->InNewSpace(*lo));
+    CHECK_LT(0, heap->lo_space()->SizeOfYoungObjects());
+    CHECK_EQ(page_count + 1, heap->lo_space()->PageCount());
+  }
+  heap->CollectGarbage(NEW_SPACE);
+  CHECK_EQ(page_count, heap->lo_space()->PageCount());
+  CHECK_EQ(0, heap->lo_space()->SizeOfYoungObjects());
+}
+
+
+TEST(YoungLargeObjectPromotedInPlace) {
+  FLAG_young_generation_large_objects = true;
+  FLAG_parallel_scavenge = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  int length = Page::kMaxRegularHeapObjectSize / kPointerSize + 1;
+  Handle<FixedArray> lo = isolate->factory()->NewFixedArray(length);
+  Handle<FixedArray> young = isolate->factory()->NewFixedArray(4);
+  CHECK(heap->InNewSpace(*lo));
+  CHECK(heap->InNewSpace(*young));
+  lo->set(length - 1, *young);
+  Address address = lo->address();
+
+  // The large object is promoted without being moved. The young object it
+  // points to is copied and the slot is updated and recorded.
+  heap->CollectGarbage(NEW_SPACE);
+  CHECK_EQ(address, lo->address());
+  CHECK(!heap->InNewSpace(*lo));
+  CHECK(heap->lo_space()->Contains(*lo));
+  CHECK_EQ(*young, lo->get(length - 1));
+
+  heap->CollectGarbage(NEW_SPACE);
+  CHECK_EQ(*young, lo->get(length - 1));
+  CHECK(!heap->InNewSpace(*young));
+}
+
+
+TEST(YoungLargeObjectPromotedByMarkCompact) {
+  FLAG_young_generation_large_objects = true;
+  FLAG_parallel_scavenge = false;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  int length = Page::kMaxRegularHeapObjectSize / kPointerSize + 1;
+  Handle<FixedArray> lo = isolate->factory()->NewFixedArray(length);
+  Handle<FixedArray> young = isolate->factory()->NewFixedArray(4);
+  lo->set(0, *young);
+  CHECK(heap->InNewSpace(*lo));
+
+  heap->CollectAllGarbage();
+  CHECK(!heap->InNewSpace(*lo));
+  CHECK_EQ(0, heap->lo_space()->SizeOfYoungObjects());
+  CHECK_EQ(*young, lo->get(0));
+
+  // The slot to the young object was recorded during the mark-compact.
+  heap->CollectGarbage(NEW_SPACE);
+  heap->CollectGarbage(NEW_SPACE);
+  CHECK_EQ(*young, lo->get(0));
+}
+
+
 class DummyVisitor : public ObjectVisitor {
  public:
   void VisitPointers(Object** start, Object** end) override {}
@@ -5390,6 +5689,66 @@ TEST(WeakCellsWithIncrementalMarking) {
 }
 
 
+TEST(AdaptiveAllocationSitePretenuring) {
+  FLAG_adaptive_allocation_site_pretenuring = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<AllocationSite> site = isolate->factory()->NewAllocationSite();
+  auto digest = [&site](int created, int found) {
+    site->set_memento_create_count(created);
+    site->set_memento_found_count(found);
+    // Digest as if new space was not at maximum capacity.
+    return site->DigestPretenuringFeedback(false);
+  };
+
+  // A don't tenure decision is revisited when most objects survive.
+  site->set_pretenure_decision(AllocationSite::kDontTenure);
+  CHECK(!digest(AllocationSite::kPretenureMinimumCreated,
+                AllocationSite::kPretenureMinimumCreated));
+  CHECK_EQ(AllocationSite::kMaybeTenure, site->pretenure_decision());
+
+  // A second high survival rate in a row tenures the site.
+  CHECK(digest(AllocationSite::kPretenureMinimumCreated,
+               AllocationSite::kPretenureMinimumCreated));
+  CHECK_EQ(AllocationSite::kTenure, site->pretenure_decision());
+  CHECK(site->deopt_dependent_code());
+  CHECK_EQ(TENURED, site->GetPretenureMode());
+
+  // A low survival rate in between resets the hysteresis.
+  site->ResetPretenureDecision();
+  site->set_deopt_dependent_code(false);
+  CHECK(!digest(AllocationSite::kPretenureMinimumCreated,
+                AllocationSite::kPretenureMinimumCreated));
+  CHECK(!digest(AllocationSite::kPretenureMinimumCreated, 0));
+  CHECK_EQ(AllocationSite::kDontTenure, site->pretenure_decision());
+  CHECK(!site->deopt_dependent_code());
+}
+
+
+TEST(ObjectStatsCountProgressBarArraysOnce) {
+  FLAG_track_gc_object_stats = true;
+  FLAG_use_marking_progress_bar = true;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Heap* heap = CcTest::heap();
+  HandleScope scope(CcTest::i_isolate());
+  // The array is large enough to be scanned in many progress bar chunks.
+  const int kLength = 2 * MB;
+  Handle<FixedArray> array =
+      CcTest::i_isolate()->factory()->NewFixedArray(kLength, TENURED);
+  CHECK(heap->lo_space()->Contains(*array));
+
+  heap::SimulateIncrementalMarking(heap);
+  heap->CollectAllGarbage();
+
+  v8::HeapObjectStatistics stats;
+  CHECK(isolate->GetHeapObjectStatisticsAtLastGC(&stats, FIXED_ARRAY_TYPE));
+  CHECK_GE(stats.object_size(), static_cast<size_t>(array->Size()));
+  CHECK_LT(stats.object_size(), static_cast<size_t>(2 * array->Size()));
+}
+
+
 #ifdef DEBUG
 TEST(AddInstructionChangesNewSpacePromotion) {
   i::FLAG_allow_natives_syntax = true;
@@ -5499,6 +5858,60 @@ UNINITIALIZED_TEST(Regress538257) {
 }
 
 
+namespace {
+
+struct NearHeapLimitState {
+  int invocations;
+  size_t initial_heap_limit;
+};
+
+size_t RaiseHeapLimit(void* data, size_t current_heap_limit,
+                      size_t initial_heap_limit) {
+  NearHeapLimitState* state = reinterpret_cast<NearHeapLimitState*>(data);
+  state->invocations++;
+  state->initial_heap_limit = initial_heap_limit;
+  return current_heap_limit + 4 * Page::kPageSize;
+}
+
+}  // namespace
+
+
+UNINITIALIZED_TEST(NearHeapLimitCallbackRaisesLimit) {
+  v8::Isolate::CreateParams create_params;
+  create_params.constraints.set_max_semi_space_size(1 * Page::kPageSize / MB);
+  create_params.constraints.set_max_old_space_size(6 * Page::kPageSize / MB);
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  NearHeapLimitState state = {0, 0};
+  isolate->AddNearHeapLimitCallback(RaiseHeapLimit, &state);
+  isolate->Enter();
+  {
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    Heap* heap = i_isolate->heap();
+    intptr_t initial_limit = heap->MaxOldGenerationSize();
+    HandleScope handle_scope(i_isolate);
+    const int kMaxObjects = 10000;
+    const int kFixedArrayLen = 512;
+    Handle<FixedArray> objects[kMaxObjects];
+    // Keep everything alive until the heap limit has been hit once.
+    for (int i = 0; i < kMaxObjects && state.invocations == 0; i++) {
+      objects[i] = i_isolate->factory()->NewFixedArray(kFixedArrayLen, TENURED);
+    }
+    CHECK_LT(0, state.invocations);
+    CHECK_EQ(static_cast<size_t>(initial_limit), state.initial_heap_limit);
+    CHECK_LT(initial_limit, heap->MaxOldGenerationSize());
+
+    // Removing the callback lowers the limit again, but not below the
+    // memory that is in use.
+    isolate->RemoveNearHeapLimitCallback(RaiseHeapLimit,
+                                         static_cast<size_t>(initial_limit));
+    CHECK(heap->OldGenerationCapacity() < heap->MaxOldGenerationSize());
+  }
+  isolate->Exit();
+  isolate->Dispose();
+}
+
+
 TEST(Regress357137) {
   CcTest::InitializeVM();
   v8::Isolate* isolate = CcTest::isolate();
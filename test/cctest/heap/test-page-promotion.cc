@@ -62,6 +62,40 @@ UNINITIALIZED_TEST(PagePromotion_NewToOld) {
   }
 }
 
+UNINITIALIZED_TEST(PagePromotion_NewToOldInScavenge) {
+  i::FLAG_scavenge_page_promotion = true;
+  v8::Isolate* isolate = NewIsolateForPagePromotion();
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+
+    std::vector<Handle<FixedArray>> handles;
+    heap::SimulateFullSpace(heap->new_space(), &handles);
+    // The first scavenge copies all objects below the age mark.
+    heap->CollectGarbage(NEW_SPACE);
+    CHECK_GT(handles.size(), 0u);
+    Handle<FixedArray> first_object = handles.front();
+    Address first_address = first_object->address();
+    Page* first_page = Page::FromAddress(first_address);
+    CHECK(first_page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK));
+    CHECK(!first_page->Contains(heap->new_space()->age_mark()));
+
+    // The second scavenge moves the page instead of copying its objects.
+    heap->CollectGarbage(NEW_SPACE);
+    CHECK_EQ(first_address, first_object->address());
+    CHECK(!heap->new_space()->ContainsSlow(first_page->address()));
+    CHECK(heap->old_space()->ContainsSlow(first_page->address()));
+    // Objects on the page must still be valid after a full GC.
+    heap::GcAndSweep(heap, OLD_SPACE);
+    for (Handle<FixedArray> object : handles) {
+      CHECK(object->IsFixedArray());
+    }
+  }
+}
+
 UNINITIALIZED_TEST(PagePromotion_NewToNew) {
   v8::Isolate* isolate = NewIsolateForPagePromotion();
   Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
@@ -398,6 +398,44 @@ TEST(OldSpace) {
 }
 
 
+TEST(PooledOldSpacePages) {
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  MemoryAllocator* memory_allocator = new MemoryAllocator(isolate);
+  CHECK(memory_allocator->SetUp(heap->MaxReserved(), heap->MaxExecutableSize(),
+                                0));
+  TestMemoryAllocatorScope test_scope(isolate, memory_allocator);
+
+  OldSpace* s = new OldSpace(heap, OLD_SPACE, NOT_EXECUTABLE);
+  CHECK(s->SetUp());
+
+  Page* page = memory_allocator->AllocatePage(Page::kAllocatableMemory, s,
+                                              NOT_EXECUTABLE);
+  CHECK_NOT_NULL(page);
+  Address address = page->address();
+  memory_allocator->Free<MemoryAllocator::kPooledAndQueue>(page);
+  memory_allocator->unmapper()->FreeQueuedChunks();
+  memory_allocator->unmapper()->WaitUntilCompleted();
+
+  // The uncommitted page is reused from the pool.
+  page = memory_allocator->AllocatePage<MemoryAllocator::kPooled>(
+      Page::kAllocatableMemory, s, NOT_EXECUTABLE);
+  CHECK_NOT_NULL(page);
+  CHECK_EQ(address, page->address());
+
+  // Without room in the pool the page is released to the OS.
+  memory_allocator->unmapper()->set_max_pooled_chunks(0);
+  memory_allocator->Free<MemoryAllocator::kPooledAndQueue>(page);
+  memory_allocator->unmapper()->FreeQueuedChunks();
+  memory_allocator->unmapper()->WaitUntilCompleted();
+  CHECK_NULL(memory_allocator->unmapper()->TryGetPooledMemoryChunkSafe());
+
+  delete s;
+  memory_allocator->TearDown();
+  delete memory_allocator;
+}
+
+
 TEST(CompactionSpace) {
   Isolate* isolate = CcTest::i_isolate();
   Heap* heap = isolate->heap();
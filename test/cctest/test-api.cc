@@ -8529,6 +8529,37 @@ THREADED_TEST(StringWrite) {
 }
 
 
+THREADED_TEST(WriteUtf8OneByteRuns) {
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  // An ASCII prefix followed by Latin-1 characters, long enough to span
+  // several machine words.
+  Local<String> str = v8_str("abcdefghijklmnopqrstuvwxyz\xc3\xa9t\xc3\xa9!");
+  CHECK_EQ(30, str->Length());
+  char buffer[64];
+  int nchars;
+  int len = str->WriteUtf8(buffer, sizeof(buffer), &nchars);
+  CHECK_EQ(33, len);
+  CHECK_EQ(30, nchars);
+  CHECK_EQ(0, strcmp("abcdefghijklmnopqrstuvwxyz\xc3\xa9t\xc3\xa9!", buffer));
+
+  // Limited capacity stops before a character that does not fit.
+  memset(buffer, 'x', sizeof(buffer));
+  len = str->WriteUtf8(buffer, 27, &nchars);
+  CHECK_EQ(26, len);
+  CHECK_EQ(26, nchars);
+  CHECK_EQ(0, strncmp("abcdefghijklmnopqrstuvwxyz", buffer, 26));
+  CHECK_EQ('x', buffer[26]);
+
+  memset(buffer, 'x', sizeof(buffer));
+  len = str->WriteUtf8(buffer, 10, &nchars, String::NO_NULL_TERMINATION);
+  CHECK_EQ(10, len);
+  CHECK_EQ(10, nchars);
+  CHECK_EQ(0, strncmp("abcdefghij", buffer, 10));
+  CHECK_EQ('x', buffer[10]);
+}
+
+
 static void Utf16Helper(
     LocalContext& context,  // NOLINT
     const char* name,
@@ -18015,6 +18046,8 @@ THREADED_TEST(GetHeapStatistics) {
   c1->GetIsolate()->GetHeapStatistics(&heap_statistics);
   CHECK_NE(static_cast<int>(heap_statistics.total_heap_size()), 0);
   CHECK_NE(static_cast<int>(heap_statistics.used_heap_size()), 0);
+  CHECK_GE(heap_statistics.peak_malloced_memory(),
+           heap_statistics.malloced_memory());
 }
 
 
@@ -21871,6 +21904,70 @@ TEST(TryFinallyMessage) {
 }
 
 
+TEST(MessageSkippedOnlyWhenCaughtByJavaScript) {
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  {
+    // An exception caught by a JavaScript catch block does not leave a
+    // message behind for a later rethrow of a different value.
+    TryCatch try_catch(context->GetIsolate());
+    const char* caught_then_thrown =
+        "try {                          \n"
+        "  throw new Error('caught');   \n"
+        "} catch (e) {}                 \n"
+        "throw new Error('uncaught');   \n";
+    CompileRun(caught_then_thrown);
+    CHECK(try_catch.HasCaught());
+    Local<Message> message = try_catch.Message();
+    CHECK(!message.IsEmpty());
+    CHECK_EQ(4, message->GetLineNumber(context.local()).FromJust());
+  }
+
+  {
+    // The desugared catch block around a for-of body rethrows and keeps the
+    // original message.
+    TryCatch try_catch(context->GetIsolate());
+    const char* for_of =
+        "for (var x of [1, 2]) {        \n"
+        "  var y = x;                   \n"
+        "  throw new Error('for-of');   \n"
+        "}                              \n";
+    CompileRun(for_of);
+    CHECK(try_catch.HasCaught());
+    Local<Message> message = try_catch.Message();
+    CHECK(!message.IsEmpty());
+    CHECK_EQ(3, message->GetLineNumber(context.local()).FromJust());
+  }
+}
+
+
+static void VerboseTryCatchAroundThrow(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  v8::TryCatch try_catch(args.GetIsolate());
+  try_catch.SetVerbose(true);
+  CompileRun("throw new Error('inner');");
+  CHECK(try_catch.HasCaught());
+  CHECK(!try_catch.Message().IsEmpty());
+}
+
+
+TEST(MessageKeptForVerboseTryCatchInsideJavaScriptCatch) {
+  // The verbose v8::TryCatch sits between the throw and the JavaScript catch
+  // block, so it must still see the message and report it to listeners.
+  message_received = false;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  isolate->AddMessageListener(receive_message);
+  Local<ObjectTemplate> templ = ObjectTemplate::New(isolate);
+  templ->Set(v8_str("VerboseTryCatch"),
+             v8::FunctionTemplate::New(isolate, VerboseTryCatchAroundThrow));
+  LocalContext context(0, templ);
+  CompileRun("try { VerboseTryCatch(); } catch (e) {}");
+  CHECK(message_received);
+  isolate->RemoveMessageListeners(receive_message);
+}
+
+
 static void Helper137002(bool do_store,
                          bool polymorphic,
                          bool remove_accessor,
@@ -26,6 +26,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "src/v8.h"
 
@@ -406,3 +407,27 @@ TEST(SpecialIndexParsing) {
   CheckNonArrayIndex(false, "-9999999999999999");
   CheckNonArrayIndex(false, "42949672964294967296429496729694966");
 }
+
+
+static void CheckDoubleToCString(const char* expected, double value) {
+  char buffer[kDoubleToCStringMinBufferSize];
+  CHECK_EQ(0, strcmp(expected, DoubleToCString(value, ArrayVector(buffer))));
+}
+
+
+TEST(DoubleToCStringIntegers) {
+  CheckDoubleToCString("0", 0.0);
+  CheckDoubleToCString("0", -0.0);
+  CheckDoubleToCString("7", 7.0);
+  CheckDoubleToCString("-7", -7.0);
+  CheckDoubleToCString("-2147483648", -2147483648.0);
+  CheckDoubleToCString("4294967296", 4294967296.0);
+  CheckDoubleToCString("1466000000000", 1466000000000.0);
+  CheckDoubleToCString("9007199254740991", 9007199254740991.0);
+  CheckDoubleToCString("-9007199254740991", -9007199254740991.0);
+  // Outside the safe integer range the shortest representation is used.
+  CheckDoubleToCString("9007199254740992", 9007199254740992.0);
+  CheckDoubleToCString("1e+21", 1e21);
+  CheckDoubleToCString("0.5", 0.5);
+  CheckDoubleToCString("-1.5", -1.5);
+}
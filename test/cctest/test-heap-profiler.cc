@@ -2547,6 +2547,33 @@ TEST(TrackHeapAllocations) {
 }
 
 
+TEST(TrackHeapAllocationsAggregated) {
+  i::FLAG_heap_profiler_aggregate_allocations = true;
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  heap_profiler->StartTrackingHeapObjects(true);
+
+  CompileRun(record_trace_tree_source);
+
+  AllocationTracker* tracker =
+      reinterpret_cast<i::HeapProfiler*>(heap_profiler)->allocation_tracker();
+  CHECK(tracker);
+  tracker->PrepareForSerialization();
+
+  const char* names[] = {"", "start", "f_0_0", "f_0_1", "f_0_2"};
+  AllocationTraceNode* node = FindNode(tracker, ArrayVector(names));
+  CHECK(node);
+  CHECK_GE(node->allocation_count(), 100u);
+  CHECK_GE(node->allocation_size(), 4 * node->allocation_count());
+  // No per-object ranges are recorded.
+  CHECK_EQ(0u, tracker->address_to_trace()->size());
+  heap_profiler->StopTrackingHeapObjects();
+  i::FLAG_heap_profiler_aggregate_allocations = false;
+}
+
+
 static const char* inline_heap_allocation_source =
     "function f_0(x) {\n"
     "  return f_1(x+1);\n"
@@ -29,9 +29,12 @@
 
 #include <sys/stat.h>
 
+#include <string>
+
 #include "src/v8.h"
 
 #include "src/ast/scopeinfo.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/bootstrapper.h"
 #include "src/compilation-cache.h"
 #include "src/debug/debug.h"
@@ -1809,6 +1812,62 @@ TEST(CodeSerializerEagerCompilationAndPreAge) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerBytecodePreAge) {
+  FLAG_ignition = true;
+  FLAG_lazy = true;
+  FLAG_serialize_toplevel = true;
+  FLAG_serialize_age_code = true;
+  FLAG_serialize_eager = true;
+  FLAG_min_preparse_length = 1;
+
+  static const char* source =
+      "function f() {"
+      "  function g() {"
+      "    return 1;"
+      "  }"
+      "  return g();"
+      "}"
+      "'abcdef';";
+
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+
+    CHECK(!cache->rejected);
+
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+    HandleScope i_scope(i_isolate);
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*unbound);
+    Handle<Script> script(Script::cast(toplevel->script()));
+    WeakFixedArray::Iterator iterator(script->shared_function_infos());
+    // Every function comes with pre-aged bytecode from the code cache.
+    int count = 0;
+    while (SharedFunctionInfo* shared = iterator.Next<SharedFunctionInfo>()) {
+      CHECK(shared->HasBytecodeArray());
+      CHECK_EQ(BytecodeArray::kPreAgedBytecodeAge,
+               shared->bytecode_array()->bytecode_age());
+      count++;
+    }
+    CHECK_EQ(3, count);
+  }
+  isolate2->Dispose();
+}
+
 TEST(Regress503552) {
   // Test that the code serializer can deal with weak cells that form a linked
   // list during incremental marking.
@@ -2129,3 +2188,80 @@ TEST(SerializationMemoryStats) {
   v8::StartupData blob = v8::V8::CreateSnapshotDataBlob();
   delete[] blob.data;
 }
+
+static std::string MakeStartupBundle(int functions) {
+  std::string bundle;
+  for (int i = 0; i < functions; i++) {
+    std::string name = "f" + std::to_string(i);
+    bundle += "function " + name + "(a, b) { return [a, b, '" + name +
+              "'].join(); }\n";
+  }
+  bundle += "f0(1, 2);";
+  return bundle;
+}
+
+// Prints per-phase startup times for test/startup/Startup.json: creating an
+// isolate and a context from the snapshot, and compiling bundles of several
+// sizes without, while producing and while consuming a code cache.
+TEST(StartupTimingStats) {
+  FLAG_serialize_toplevel = true;
+  static const int kBundleSizes[] = {10, 100, 1000};
+  static const v8::ScriptCompiler::CompileOptions kCompileOptions[] = {
+      v8::ScriptCompiler::kNoCompileOptions,
+      v8::ScriptCompiler::kProduceCodeCache,
+      v8::ScriptCompiler::kConsumeCodeCache};
+  static const char* kCompilePhases[] = {"Compile", "CompileProduceCache",
+                                         "CompileConsumeCache"};
+
+  for (int functions : kBundleSizes) {
+    std::string bundle = MakeStartupBundle(functions);
+    v8::ScriptCompiler::CachedData* cache = nullptr;
+    for (int i = 0; i < 3; i++) {
+      v8::base::ElapsedTimer timer;
+      timer.Start();
+      v8::Isolate::CreateParams create_params;
+      create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+      v8::Isolate* isolate = v8::Isolate::New(create_params);
+      double isolate_ms = timer.Elapsed().InMillisecondsF();
+      {
+        v8::Isolate::Scope iscope(isolate);
+        v8::HandleScope scope(isolate);
+        timer.Restart();
+        v8::Local<v8::Context> context = v8::Context::New(isolate);
+        double context_ms = timer.Elapsed().InMillisecondsF();
+        v8::Context::Scope context_scope(context);
+        if (i == 0 && functions == kBundleSizes[0]) {
+          PrintF("Startup-IsolateNew: %0.3f ms\n", isolate_ms);
+          PrintF("Startup-ContextNew: %0.3f ms\n", context_ms);
+        }
+
+        v8::ScriptOrigin origin(v8_str("bundle"));
+        // The source takes ownership of the cache it consumes.
+        v8::ScriptCompiler::Source source(v8_str(bundle.c_str()), origin,
+                                          i == 2 ? cache : nullptr);
+        timer.Restart();
+        v8::Local<v8::UnboundScript> script =
+            v8::ScriptCompiler::CompileUnboundScript(isolate, &source,
+                                                     kCompileOptions[i])
+                .ToLocalChecked();
+        double compile_ms = timer.Elapsed().InMillisecondsF();
+        PrintF("Startup-%s%d: %0.3f ms\n", kCompilePhases[i], functions,
+               compile_ms);
+
+        if (i == 1) {
+          const v8::ScriptCompiler::CachedData* data = source.GetCachedData();
+          CHECK(data);
+          uint8_t* buffer = NewArray<uint8_t>(data->length);
+          MemCopy(buffer, data->data, data->length);
+          cache = new v8::ScriptCompiler::CachedData(
+              buffer, data->length,
+              v8::ScriptCompiler::CachedData::BufferOwned);
+        } else if (i == 2) {
+          CHECK(!source.GetCachedData()->rejected);
+        }
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+      }
+      isolate->Dispose();
+    }
+  }
+}
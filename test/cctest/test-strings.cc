@@ -1531,3 +1531,27 @@ TEST(Regress609831) {
     CHECK(v8::Utils::OpenHandle(*result)->IsSeqTwoByteString());
   }
 }
+
+TEST(ArrayJoinWithSeparatorRepresentation) {
+  CcTest::InitializeVM();
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  {
+    HandleScope scope(isolate);
+    v8::Local<v8::Value> result = CompileRun("['abc', 'de', 'f'].join(', ')");
+    Handle<Object> string = v8::Utils::OpenHandle(*result);
+    CHECK(string->IsSeqOneByteString());
+    CHECK(String::cast(*string)->IsUtf8EqualTo(CStrVector("abc, de, f")));
+  }
+  {
+    HandleScope scope(isolate);
+    v8::Local<v8::Value> result =
+        CompileRun("['abc', '\\u1234', 'f'].join(', ')");
+    CHECK(v8::Utils::OpenHandle(*result)->IsSeqTwoByteString());
+  }
+  {
+    HandleScope scope(isolate);
+    v8::Local<v8::Value> result = CompileRun("['abc', 'f'].join('\\u1234')");
+    CHECK(v8::Utils::OpenHandle(*result)->IsSeqTwoByteString());
+  }
+}
@@ -256,3 +256,43 @@ TEST(Regress399527) {
   // marking bits which makes the weak map garbage.
   heap->CollectAllGarbage();
 }
+
+
+TEST(ChainedEphemerons) {
+  FLAG_incremental_marking = false;
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmaps[] = {AllocateJSWeakMap(isolate),
+                                  AllocateJSWeakMap(isolate)};
+  const int kChainLength = 10;
+
+  // Build a reachable and an unreachable chain k0 -> k1 -> ... where each
+  // key maps to the next one, alternating between the two weak maps.
+  Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  Handle<JSObject> root = factory->NewJSObjectFromMap(map);
+  for (int chain = 0; chain < 2; chain++) {
+    HandleScope scope(isolate);
+    Handle<JSObject> key =
+        chain == 0 ? root : factory->NewJSObjectFromMap(map);
+    for (int i = 0; i < kChainLength; i++) {
+      Handle<JSObject> value = factory->NewJSObjectFromMap(map);
+      int32_t hash = Object::GetOrCreateHash(isolate, key)->value();
+      JSWeakCollection::Set(weakmaps[i % 2], key, value, hash);
+      key = value;
+    }
+  }
+  CHECK_EQ(kChainLength,
+           ObjectHashTable::cast(weakmaps[0]->table())->NumberOfElements());
+  CHECK_EQ(kChainLength,
+           ObjectHashTable::cast(weakmaps[1]->table())->NumberOfElements());
+
+  // Only the entries reachable from the root survive.
+  heap->CollectAllGarbage(false);
+  CHECK_EQ(kChainLength / 2,
+           ObjectHashTable::cast(weakmaps[0]->table())->NumberOfElements());
+  CHECK_EQ(kChainLength / 2,
+           ObjectHashTable::cast(weakmaps[1]->table())->NumberOfElements());
+}
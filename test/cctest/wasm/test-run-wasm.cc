@@ -1435,6 +1435,46 @@ WASM_EXEC_TEST(LoadMemI32_offset) {
   CHECK_EQ(44444444, r.Call(8));
 }
 
+WASM_EXEC_TEST(LoadMemI32_repeated_index) {
+  TestingModule module(execution_mode);
+  int32_t* memory = module.AddMemoryElems<int32_t>(4);
+  WasmRunner<int32_t> r(&module, MachineType::Int32());
+
+  // The second access is covered by the bounds check of the first one.
+  BUILD(r, WASM_I32_ADD(
+               WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 8, WASM_GET_LOCAL(0)),
+               WASM_LOAD_MEM(MachineType::Int32(), WASM_GET_LOCAL(0))));
+
+  memory[0] = 1;
+  memory[1] = 20;
+  memory[2] = 300;
+  memory[3] = 4000;
+  CHECK_EQ(301, r.Call(0));
+  CHECK_EQ(4020, r.Call(4));
+  CHECK_TRAP(r.Call(8));
+  CHECK_TRAP(r.Call(12));
+}
+
+WASM_EXEC_TEST(LoadMemI32_repeated_index_growing_offset) {
+  TestingModule module(execution_mode);
+  int32_t* memory = module.AddMemoryElems<int32_t>(4);
+  WasmRunner<int32_t> r(&module, MachineType::Int32());
+
+  // The second access reaches further and needs its own bounds check.
+  BUILD(r, WASM_I32_ADD(
+               WASM_LOAD_MEM(MachineType::Int32(), WASM_GET_LOCAL(0)),
+               WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 8,
+                                    WASM_GET_LOCAL(0))));
+
+  memory[0] = 1;
+  memory[1] = 20;
+  memory[2] = 300;
+  memory[3] = 4000;
+  CHECK_EQ(301, r.Call(0));
+  CHECK_EQ(4020, r.Call(4));
+  CHECK_TRAP(r.Call(8));
+}
+
 WASM_EXEC_TEST(LoadMemI32_const_oob_misaligned) {
   const int kMemSize = 12;
   // TODO(titzer): Fix misaligned accesses on MIPS and re-enable.
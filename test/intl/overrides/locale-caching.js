@@ -0,0 +1,36 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Overrides called with a single locale string and no options reuse cached
+// service instances. Make sure results still depend on the locale.
+
+var number = 1234567.891;
+assertEquals(new Intl.NumberFormat('de').format(number),
+             number.toLocaleString('de'));
+assertEquals(new Intl.NumberFormat('en').format(number),
+             number.toLocaleString('en'));
+assertEquals(number.toLocaleString('de'), number.toLocaleString('de'));
+assertFalse(number.toLocaleString('de') === number.toLocaleString('en'));
+
+var date = new Date(2016, 6, 1, 12, 30);
+assertEquals(new Intl.DateTimeFormat('en').format(date),
+             date.toLocaleDateString('en'));
+assertEquals(date.toLocaleString('de'), date.toLocaleString('de'));
+assertEquals(date.toLocaleTimeString('en'), date.toLocaleTimeString('en'));
+
+assertEquals(new Intl.Collator('sv').compare('z', 'ä'),
+             'z'.localeCompare('ä', 'sv'));
+assertEquals(new Intl.Collator('de').compare('z', 'ä'),
+             'z'.localeCompare('ä', 'de'));
+
+// Locale strings that collide with Object.prototype properties are not
+// confused with cached instances.
+Object.prototype.de = 'not a formatter';
+assertEquals(new Intl.NumberFormat('de').format(number),
+             number.toLocaleString('de'));
+delete Object.prototype.de;
+
+// Invalid locales still throw, whether or not a cache entry exists.
+assertThrows(function() { number.toLocaleString('xx-invalid-'); }, RangeError);
+assertThrows(function() { number.toLocaleString('xx-invalid-'); }, RangeError);
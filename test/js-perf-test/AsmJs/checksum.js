@@ -0,0 +1,67 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The Adler-32 and CRC-32 checksums used by zlib, over a buffer that starts
+// after the 1KB CRC table.
+
+function ChecksumModule(stdlib, foreign, heap) {
+  "use asm";
+  var U8 = new stdlib.Uint8Array(heap);
+  var I32 = new stdlib.Int32Array(heap);
+
+  function makeCrcTable() {
+    var n = 0, k = 0, c = 0;
+    for (n = 0; (n | 0) < 256; n = (n + 1) | 0) {
+      c = n;
+      for (k = 0; (k | 0) < 8; k = (k + 1) | 0) {
+        if (c & 1) {
+          c = -306674912 ^ (c >>> 1);
+        } else {
+          c = c >>> 1;
+        }
+      }
+      I32[n << 2 >> 2] = c;
+    }
+  }
+
+  function adler32(start, length) {
+    start = start | 0;
+    length = length | 0;
+    var a = 1, b = 0, i = 0, end = 0;
+    end = (start + length) | 0;
+    for (i = start; (i | 0) < (end | 0); i = (i + 1) | 0) {
+      a = (((a + (U8[i >> 0] | 0)) | 0) % 65521) | 0;
+      b = (((b + a) | 0) % 65521) | 0;
+    }
+    return b << 16 | a;
+  }
+
+  function crc32(start, length) {
+    start = start | 0;
+    length = length | 0;
+    var c = -1, i = 0, end = 0;
+    end = (start + length) | 0;
+    for (i = start; (i | 0) < (end | 0); i = (i + 1) | 0) {
+      c = I32[((c ^ U8[i >> 0]) & 255) << 2 >> 2] ^ (c >>> 8);
+    }
+    return c ^ -1;
+  }
+
+  return {makeCrcTable: makeCrcTable, adler32: adler32, crc32: crc32};
+}
+
+
+var kChecksumStart = 1024;
+var kChecksumLength = 64 * 1024;
+
+AddAsmJsSuites('Checksum', ChecksumModule, function(instance, heap) {
+  instance.makeCrcTable();
+  var u8 = new Uint8Array(heap, kChecksumStart, kChecksumLength);
+  for (var i = 0; i < kChecksumLength; i++) {
+    u8[i] = (i * 31) & 0xff;
+  }
+}, function(instance, heap) {
+  instance.adler32(kChecksumStart, kChecksumLength);
+  instance.crc32(kChecksumStart, kChecksumLength);
+});
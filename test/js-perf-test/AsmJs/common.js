@@ -0,0 +1,44 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+var stdlib = this;
+var kHeapSize = 1 << 20;
+var compileCounter = 0;
+
+
+// Compiles and links a fresh copy of the asm.js module |module|. The source
+// gets a unique suffix so that the compilation cache cannot be hit and every
+// call measures the full compile.
+function CompileModule(module, heap) {
+  var source = '(' + module.toString() + ')\n//' + compileCounter++;
+  return eval(source)(stdlib, {}, heap);
+}
+
+
+// Adds a pair of benchmark suites for |module|: one that only compiles and
+// links it, and one that measures steady-state throughput of |run| on an
+// already linked instance.
+function AddAsmJsSuites(name, module, setup, run) {
+  new BenchmarkSuite(name + '-Compile', [1000], [
+    new Benchmark(name + '-Compile', false, false, 0, function() {
+      CompileModule(module, new ArrayBuffer(kHeapSize));
+    }),
+  ]);
+
+  var instance;
+  var heap;
+  new BenchmarkSuite(name + '-Run', [1000], [
+    new Benchmark(name + '-Run', false, false, 0, function() {
+      run(instance, heap);
+    }, function() {
+      heap = new ArrayBuffer(kHeapSize);
+      instance = CompileModule(module, heap);
+      setup(instance, heap);
+    }, function() {
+      instance = null;
+      heap = null;
+    }),
+  ]);
+}
@@ -0,0 +1,49 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The add-rotate-xor quarter round of ChaCha20, mixed with words read from
+// the heap.
+
+function CryptoModule(stdlib, foreign, heap) {
+  "use asm";
+  var I32 = new stdlib.Int32Array(heap);
+
+  function mix(blocks) {
+    blocks = blocks | 0;
+    var a = 0x61707865, b = 0x3320646e, c = 0x79622d32, d = 0x6b206574;
+    var i = 0, r = 0;
+    for (i = 0; (i | 0) < (blocks | 0); i = (i + 1) | 0) {
+      a = (a + (I32[(i & 1023) << 2 >> 2] | 0)) | 0;
+      for (r = 0; (r | 0) < 10; r = (r + 1) | 0) {
+        a = (a + b) | 0;
+        d = d ^ a;
+        d = d << 16 | d >>> 16;
+        c = (c + d) | 0;
+        b = b ^ c;
+        b = b << 12 | b >>> 20;
+        a = (a + b) | 0;
+        d = d ^ a;
+        d = d << 8 | d >>> 24;
+        c = (c + d) | 0;
+        b = b ^ c;
+        b = b << 7 | b >>> 25;
+      }
+    }
+    return a ^ b ^ c ^ d;
+  }
+
+  return {mix: mix};
+}
+
+
+var kCryptoBlocks = 4096;
+
+AddAsmJsSuites('Crypto', CryptoModule, function(instance, heap) {
+  var i32 = new Int32Array(heap);
+  for (var i = 0; i < 1024; i++) {
+    i32[i] = i * 0x9e3779b9;
+  }
+}, function(instance, heap) {
+  instance.mix(kCryptoBlocks);
+});
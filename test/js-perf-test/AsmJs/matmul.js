@@ -0,0 +1,43 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Dense double-precision matrix multiplication, C = A * B. The three n x n
+// matrices are laid out row-major one after another in the heap.
+
+function MatMulModule(stdlib, foreign, heap) {
+  "use asm";
+  var imul = stdlib.Math.imul;
+  var F64 = new stdlib.Float64Array(heap);
+
+  function multiply(n) {
+    n = n | 0;
+    var i = 0, j = 0, k = 0, b = 0, c = 0, sum = 0.0;
+    b = imul(n, n) << 3;
+    c = b << 1;
+    for (i = 0; (i | 0) < (n | 0); i = (i + 1) | 0) {
+      for (j = 0; (j | 0) < (n | 0); j = (j + 1) | 0) {
+        sum = 0.0;
+        for (k = 0; (k | 0) < (n | 0); k = (k + 1) | 0) {
+          sum = sum + F64[((imul(i, n) | 0) + k << 3) >> 3] *
+                F64[(b + ((imul(k, n) | 0) + j << 3)) >> 3];
+        }
+        F64[(c + ((imul(i, n) | 0) + j << 3)) >> 3] = sum;
+      }
+    }
+  }
+
+  return {multiply: multiply};
+}
+
+
+var kMatrixSize = 32;
+
+AddAsmJsSuites('MatMul', MatMulModule, function(instance, heap) {
+  var f64 = new Float64Array(heap);
+  for (var i = 0; i < 2 * kMatrixSize * kMatrixSize; i++) {
+    f64[i] = (i % 7) - 3;
+  }
+}, function(instance, heap) {
+  instance.multiply(kMatrixSize);
+});
@@ -0,0 +1,53 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Explicit Euler integration of particles under gravity, bouncing off the
+// walls of a box. Each particle is stored as x, y, vx, vy.
+
+function PhysicsModule(stdlib, foreign, heap) {
+  "use asm";
+  var F64 = new stdlib.Float64Array(heap);
+
+  function step(count, dt) {
+    count = count | 0;
+    dt = +dt;
+    var i = 0, p = 0, x = 0.0, y = 0.0, vx = 0.0, vy = 0.0;
+    for (i = 0; (i | 0) < (count | 0); i = (i + 1) | 0) {
+      p = i << 5;
+      vx = +F64[(p + 16) >> 3];
+      vy = +F64[(p + 24) >> 3] - 9.81 * dt;
+      x = +F64[p >> 3] + vx * dt;
+      y = +F64[(p + 8) >> 3] + vy * dt;
+      if ((x < 0.0) | (x > 100.0)) {
+        x = x < 0.0 ? -x : 200.0 - x;
+        vx = -vx;
+      }
+      if (y < 0.0) {
+        y = -y;
+        vy = -vy * 0.9;
+      }
+      F64[p >> 3] = x;
+      F64[(p + 8) >> 3] = y;
+      F64[(p + 16) >> 3] = vx;
+      F64[(p + 24) >> 3] = vy;
+    }
+  }
+
+  return {step: step};
+}
+
+
+var kParticleCount = 4096;
+
+AddAsmJsSuites('Physics', PhysicsModule, function(instance, heap) {
+  var f64 = new Float64Array(heap);
+  for (var i = 0; i < kParticleCount; i++) {
+    f64[4 * i] = i % 100;
+    f64[4 * i + 1] = 50 + (i % 50);
+    f64[4 * i + 2] = (i % 11) - 5;
+    f64[4 * i + 3] = 0;
+  }
+}, function(instance, heap) {
+  for (var i = 0; i < 10; i++) instance.step(kParticleCount, 0.01);
+});
@@ -0,0 +1,46 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short-lived allocations that die in the young generation, so the score is
+// dominated by allocation throughput and scavenge cost.
+
+new BenchmarkSuite('Allocation-Objects', [1000], [
+  new Benchmark('Allocation-Objects', false, false, 0, AllocateObjects),
+]);
+
+new BenchmarkSuite('Allocation-Arrays', [1000], [
+  new Benchmark('Allocation-Arrays', false, false, 0, AllocateArrays),
+]);
+
+new BenchmarkSuite('Allocation-Closures', [1000], [
+  new Benchmark('Allocation-Closures', false, false, 0, AllocateClosures),
+]);
+
+
+var kAllocationCount = 10000;
+var allocationSink;
+
+
+function AllocateObjects() {
+  for (var i = 0; i < kAllocationCount; i++) {
+    allocationSink = {x: i, y: i + 1, next: allocationSink};
+    if ((i & 0xff) == 0) allocationSink = null;
+  }
+}
+
+
+function AllocateArrays() {
+  for (var i = 0; i < kAllocationCount; i++) {
+    allocationSink = [i, i + 0.5, 'a', allocationSink];
+    if ((i & 0xff) == 0) allocationSink = null;
+  }
+}
+
+
+function AllocateClosures() {
+  for (var i = 0; i < kAllocationCount; i++) {
+    var j = i;
+    allocationSink = function() { return j; };
+  }
+}
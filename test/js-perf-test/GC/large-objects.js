@@ -0,0 +1,35 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Allocations above the regular object size limit, which go straight to
+// large object space.
+
+new BenchmarkSuite('LargeObjects-Arrays', [1000], [
+  new Benchmark('LargeObjects-Arrays', false, false, 0, AllocateLargeArrays),
+]);
+
+new BenchmarkSuite('LargeObjects-TypedArrays', [1000], [
+  new Benchmark('LargeObjects-TypedArrays', false, false, 0,
+      AllocateLargeTypedArrays),
+]);
+
+
+var kLargeLength = 256 * 1024;
+var largeSink;
+
+
+function AllocateLargeArrays() {
+  for (var i = 0; i < 4; i++) {
+    largeSink = new Array(kLargeLength);
+    largeSink[i] = i;
+  }
+}
+
+
+function AllocateLargeTypedArrays() {
+  for (var i = 0; i < 4; i++) {
+    largeSink = new Float64Array(kLargeLength);
+    largeSink[i] = i;
+  }
+}
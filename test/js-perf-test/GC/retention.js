@@ -0,0 +1,60 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long-lived object graphs that survive scavenges and get promoted, so the
+// score is dominated by promotion and mark-compact cost.
+
+new BenchmarkSuite('Retention-Tree', [1000], [
+  new Benchmark('Retention-Tree', false, false, 0, RetainTree,
+      RetentionSetup, RetentionTearDown),
+]);
+
+new BenchmarkSuite('Retention-Churn', [1000], [
+  new Benchmark('Retention-Churn', false, false, 0, ChurnRetained,
+      RetentionSetup, RetentionTearDown),
+]);
+
+
+var kRetainedSize = 50000;
+var kTreeDepth = 10;
+var retained;
+var retainedIndex;
+
+
+function RetentionSetup() {
+  retained = new Array(kRetainedSize);
+  for (var i = 0; i < kRetainedSize; i++) {
+    retained[i] = {value: i, payload: [i]};
+  }
+  retainedIndex = 0;
+}
+
+
+function RetentionTearDown() {
+  retained = null;
+}
+
+
+function MakeTree(depth) {
+  if (depth == 0) return null;
+  return {left: MakeTree(depth - 1), right: MakeTree(depth - 1)};
+}
+
+
+function RetainTree() {
+  // Replace one retained slot per run with a fresh tree, so the old
+  // generation keeps receiving promoted objects.
+  retained[retainedIndex] = MakeTree(kTreeDepth);
+  retainedIndex = (retainedIndex + 1) % kRetainedSize;
+}
+
+
+function ChurnRetained() {
+  // Overwrite a slice of the retained set, creating old-to-new pointers and
+  // garbage in the old generation.
+  for (var i = 0; i < 1000; i++) {
+    retained[retainedIndex] = {value: i, payload: [retainedIndex]};
+    retainedIndex = (retainedIndex + 1) % kRetainedSize;
+  }
+}
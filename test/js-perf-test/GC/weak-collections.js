@@ -0,0 +1,55 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// WeakMaps and WeakSets whose keys die at different rates, which stresses
+// ephemeron processing during marking.
+
+new BenchmarkSuite('Weak-WeakMap', [1000], [
+  new Benchmark('Weak-WeakMap', false, false, 0, FillWeakMap,
+      WeakCollectionsSetup, WeakCollectionsTearDown),
+]);
+
+new BenchmarkSuite('Weak-WeakSet', [1000], [
+  new Benchmark('Weak-WeakSet', false, false, 0, FillWeakSet,
+      WeakCollectionsSetup, WeakCollectionsTearDown),
+]);
+
+
+var kWeakKeyCount = 1000;
+var weakKeys;
+var weakMap;
+var weakSet;
+
+
+function WeakCollectionsSetup() {
+  weakKeys = new Array(kWeakKeyCount);
+  for (var i = 0; i < kWeakKeyCount; i++) {
+    weakKeys[i] = {};
+  }
+  weakMap = new WeakMap;
+  weakSet = new WeakSet;
+}
+
+
+function WeakCollectionsTearDown() {
+  weakKeys = null;
+  weakMap = null;
+  weakSet = null;
+}
+
+
+function FillWeakMap() {
+  for (var i = 0; i < kWeakKeyCount; i++) {
+    // Every other key is only reachable through the map and dies.
+    var key = (i & 1) ? weakKeys[i] : {};
+    weakMap.set(key, {value: i});
+  }
+}
+
+
+function FillWeakSet() {
+  for (var i = 0; i < kWeakKeyCount; i++) {
+    weakSet.add((i & 1) ? weakKeys[i] : {});
+  }
+}
@@ -248,3 +248,18 @@ for (var i = 0; i < 100; i++) {
 var r4 = [0].concat(arr3, arr3);
 assertEquals(1 + arr3.length * 2, r4.length);
 assertEquals(expectedTrace, trace);
+
+// Primitive arguments are appended as single elements.
+assertEquals([1, 2, 3, 4], [1, 2].concat(3, 4));
+assertEquals([1, 2, 3.5], [1, 2].concat(3.5));
+assertEquals([1.5, 2, -0, NaN], [1.5].concat(2, -0, NaN));
+assertTrue(Object.is(-0, [1.5].concat(-0)[1]));
+assertEquals([1, "a", true, undefined, null], [1].concat("a", true, undefined,
+                                                            null));
+var sym = Symbol();
+assertEquals([0.5, sym], [0.5].concat(sym));
+var holey = [1, , 3];
+var r5 = holey.concat(4.5, "b");
+assertEquals(5, r5.length);
+assertFalse(1 in r5);
+assertEquals([1, undefined, 3, 4.5, "b"], r5);
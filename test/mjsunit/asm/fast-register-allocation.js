@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --turbo-fast-regalloc-threshold=1
+
+function Module(stdlib, foreign, heap) {
+  "use asm";
+  var MEM32 = new stdlib.Int32Array(heap);
+  function sum(n) {
+    n = n | 0;
+    var i = 0, a = 0, b = 1, c = 2, d = 3;
+    for (i = 0; (i | 0) < (n | 0); i = (i + 1) | 0) {
+      a = (a + b) | 0;
+      b = (b + c) | 0;
+      c = (c + d) | 0;
+      d = (d + i) | 0;
+      MEM32[(i & 1023) << 2 >> 2] = a;
+    }
+    return (a + b + c + d) | 0;
+  }
+  function fsum(n) {
+    n = n | 0;
+    var i = 0, x = 0.5, y = 1.5, z = 2.5;
+    for (i = 0; (i | 0) < (n | 0); i = (i + 1) | 0) {
+      x = x + y;
+      y = y * 0.5 + z;
+      z = z - x * 0.25;
+    }
+    return +(x + y + z);
+  }
+  return { sum: sum, fsum: fsum };
+}
+
+var m = Module(this, {}, new ArrayBuffer(64 * 1024));
+
+function sum(n) {
+  var a = 0, b = 1, c = 2, d = 3;
+  for (var i = 0; i < n; i++) {
+    a = (a + b) | 0;
+    b = (b + c) | 0;
+    c = (c + d) | 0;
+    d = (d + i) | 0;
+  }
+  return (a + b + c + d) | 0;
+}
+
+function fsum(n) {
+  var x = 0.5, y = 1.5, z = 2.5;
+  for (var i = 0; i < n; i++) {
+    x = x + y;
+    y = y * 0.5 + z;
+    z = z - x * 0.25;
+  }
+  return x + y + z;
+}
+
+for (var n = 0; n < 100; n += 7) {
+  assertEquals(sum(n), m.sum(n));
+  assertEquals(fsum(n), m.fsum(n));
+}
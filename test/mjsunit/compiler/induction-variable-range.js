@@ -0,0 +1,74 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo
+
+function sum(a) {
+  var s = 0;
+  for (var i = 0; i < a.length; i++) s += a[i];
+  return s;
+}
+
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(6, sum([1, 2, 3]));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(0, sum([]));
+
+function steps(n) {
+  var last = 0;
+  for (var i = 3; i <= n; i += 4) last = i;
+  return last + i;
+}
+
+assertEquals(7 + 11, steps(10));
+assertEquals(7 + 11, steps(10));
+%OptimizeFunctionOnNextCall(steps);
+assertEquals(7 + 11, steps(10));
+assertEquals(0 + 3, steps(-5));
+
+function large(n) {
+  var i = 2147483640;
+  while (i < n) i++;
+  return i;
+}
+
+assertEquals(2147483650, large(2147483650));
+assertEquals(2147483650, large(2147483650));
+%OptimizeFunctionOnNextCall(large);
+assertEquals(2147483650, large(2147483650));
+assertEquals(2147483660, large(2147483660));
+assertEquals(2147483640, large(0));
+
+function branchy(n, x) {
+  var i = 0;
+  while (i < n) {
+    if (x) {
+      i += 1;
+    } else {
+      i += 2;
+    }
+  }
+  return i;
+}
+
+assertEquals(10, branchy(10, true));
+assertEquals(10, branchy(9, false));
+%OptimizeFunctionOnNextCall(branchy);
+assertEquals(10, branchy(10, true));
+assertEquals(10, branchy(9, false));
+
+function nested(n) {
+  var a = [];
+  for (var j = 1; j < n; j *= 2) {
+    for (var i = 0; i < j; i++) a[i] = i;
+  }
+  return a.length;
+}
+
+assertEquals(64, nested(100));
+assertEquals(64, nested(100));
+%OptimizeFunctionOnNextCall(nested);
+assertEquals(64, nested(100));
+assertEquals(1024, nested(2000));
@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test forwarding of arguments through Reflect.apply(f, this, arguments) in
+// inlined functions, including sloppy, strict and rest arguments.
+(function testStrictForwarding() {
+  "use strict";
+  function target(a, b, c) { return [this, a, b, c]; }
+  function forward() { return Reflect.apply(target, this, arguments); }
+  function caller(x, y) { return forward.call(x, y, y + 1); }
+
+  assertEquals([1, 2, 3, undefined], caller(1, 2));
+  assertEquals([1, 2, 3, undefined], caller(1, 2));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals([1, 2, 3, undefined], caller(1, 2));
+  assertEquals(["a", "b", "b1", undefined], caller("a", "b"));
+})();
+
+(function testSloppyForwarding() {
+  function target(a, b) { return a + b; }
+  function forward() { return Reflect.apply(target, undefined, arguments); }
+  function caller(x) { return forward(x, 1) + forward(x); }
+
+  assertEquals(NaN, caller(1));
+  assertEquals(NaN, caller(1));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(NaN, caller(1));
+  assertEquals("a1aundefined", caller("a"));
+})();
+
+(function testRestForwarding() {
+  "use strict";
+  function target() { return arguments.length; }
+  function forward(a, ...rest) { return Reflect.apply(target, a, rest); }
+  function caller() { return forward(1, 2, 3) + forward(1); }
+
+  assertEquals(2, caller());
+  assertEquals(2, caller());
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(2, caller());
+})();
+
+(function testNonCallableTarget() {
+  function forward() { return Reflect.apply(1, undefined, arguments); }
+  function caller() { return forward(1); }
+
+  assertThrows(caller, TypeError);
+  assertThrows(caller, TypeError);
+  %OptimizeFunctionOnNextCall(caller);
+  assertThrows(caller, TypeError);
+})();
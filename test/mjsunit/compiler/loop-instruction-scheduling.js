@@ -0,0 +1,35 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-instruction-scheduling
+// Flags: --turbo-stress-instruction-scheduling
+
+function dot(a, b) {
+  var sum = 0;
+  for (var i = 0; i < a.length; ++i) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+function mix(a, n) {
+  var x = 1, y = 2;
+  for (var i = 0; i < n; ++i) {
+    x = (x * 31 + a[i & 7]) | 0;
+    y = (y ^ (x >>> 3)) + ((i / 3) | 0);
+    a[i & 7] = y & 0xff;
+  }
+  return x + y;
+}
+
+var a = new Float64Array([1, 2, 3, 4, 5, 6, 7, 8]);
+var b = new Float64Array([8, 7, 6, 5, 4, 3, 2, 1]);
+assertEquals(120, dot(a, b));
+%OptimizeFunctionOnNextCall(dot);
+assertEquals(120, dot(a, b));
+
+var reference = mix(new Int32Array(8), 100);
+mix(new Int32Array(8), 100);
+%OptimizeFunctionOnNextCall(mix);
+assertEquals(reference, mix(new Int32Array(8), 100));
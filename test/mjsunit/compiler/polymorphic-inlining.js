@@ -0,0 +1,55 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --polymorphic-inlining
+
+(function testCallPhiOfFunctions() {
+  function add(a, b) { return a + b; }
+  function sub(a, b) { return a - b; }
+  function mul(a, b) { return a * b; }
+
+  function visit(op, a, b) {
+    var f = op === 0 ? add : (op === 1 ? sub : mul);
+    return f(a, b);
+  }
+
+  for (var i = 0; i < 3; ++i) visit(i, 6, 3);
+  %OptimizeFunctionOnNextCall(visit);
+  assertEquals(9, visit(0, 6, 3));
+  assertEquals(3, visit(1, 6, 3));
+  assertEquals(18, visit(2, 6, 3));
+})();
+
+(function testConstructPhiOfFunctions() {
+  function A(x) { this.x = x; }
+  function B(x) { this.x = x + 1; }
+
+  function make(b, x) {
+    var C = b ? B : A;
+    return new C(x);
+  }
+
+  make(true, 1);
+  make(false, 1);
+  %OptimizeFunctionOnNextCall(make);
+  assertInstanceof(make(false, 1), A);
+  assertInstanceof(make(true, 1), B);
+  assertEquals(1, make(false, 1).x);
+  assertEquals(2, make(true, 1).x);
+})();
+
+(function testThrowingTarget() {
+  function ok() { return 1; }
+  function fail() { throw new Error("fail"); }
+
+  function call(b) {
+    var f = b ? fail : ok;
+    return f();
+  }
+
+  call(false);
+  %OptimizeFunctionOnNextCall(call);
+  assertEquals(1, call(false));
+  assertThrows(function() { call(true); }, Error);
+})();
@@ -0,0 +1,48 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-string-concat
+
+(function() {
+  function foo(a, b, c, d) {
+    a = String(a);
+    b = String(b);
+    c = String(c);
+    d = String(d);
+    return a + b + c + d;
+  }
+  assertEquals("abcd", foo("a", "b", "c", "d"));
+  assertEquals("1234", foo(1, 2, 3, 4));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals("abcd", foo("a", "b", "c", "d"));
+  assertEquals("aሴcd", foo("a", "ሴ", "c", "d"));
+  var long = "x".repeat(1000);
+  assertEquals(long + "bc" + long, foo(long, "b", "c", long));
+  assertEquals(4002, foo(long, long, long, "xx").length);
+})();
+
+(function() {
+  function foo(x, y) {
+    var s = String(x);
+    var t = String(y);
+    return `(${s}, ${t})`;
+  }
+  assertEquals("(1, 2)", foo(1, 2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals("(1, 2)", foo(1, 2));
+  assertEquals("(ä, €)", foo("ä", "€"));
+})();
+
+(function() {
+  var big = "x".repeat(1 << 25);
+  function foo(a, b) {
+    a = String(a);
+    b = String(b);
+    return a + b + a + b + a + b + a + b + a + b;
+  }
+  assertEquals("ababababab", foo("a", "b"));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals("ababababab", foo("a", "b"));
+  assertThrows(function() { foo(big, big); }, RangeError);
+})();
@@ -0,0 +1,52 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+var buffer = new ArrayBuffer(64);
+var int32 = new Int32Array(buffer);
+var float32 = new Float32Array(buffer);
+var int8 = new Int8Array(buffer, 4);
+
+// Stores to other elements of the same typed array don't change the value.
+function sameArray(a) {
+  var x = a[1];
+  a[0] = x + 1;
+  a[2] = x + 2;
+  return x + a[1];
+}
+
+// Views on the same buffer alias each other.
+function otherView(a, b) {
+  var x = a[0];
+  b[0] = 1.5;
+  return x === a[0];
+}
+
+function overlappingView(a, b) {
+  var x = a[1];
+  b[1] = 7;
+  return a[1] - x;
+}
+
+function test() {
+  int32.fill(0);
+  int32[1] = 21;
+  assertEquals(42, sameArray(int32));
+  assertEquals(22, int32[0]);
+  assertEquals(23, int32[2]);
+
+  int32.fill(0);
+  assertFalse(otherView(int32, float32));
+
+  int32.fill(0);
+  assertEquals(7 << 8, overlappingView(int32, int8));
+}
+
+test();
+test();
+%OptimizeFunctionOnNextCall(sameArray);
+%OptimizeFunctionOnNextCall(otherView);
+%OptimizeFunctionOnNextCall(overlappingView);
+test();
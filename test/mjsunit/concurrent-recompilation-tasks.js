@@ -0,0 +1,36 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --nostress-opt
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+// Flags: --concurrent-recompilation-tasks=2
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+function f1(x) { return x + 1; }
+function f2(x) { return x * 2; }
+function f3(x) { return x - 3; }
+
+var functions = [f1, f2, f3];
+
+// Queue more jobs than there are compile tasks.
+for (var f of functions) {
+  f(1);
+  f(2);
+  %OptimizeFunctionOnNextCall(f, "concurrent");
+  f(3);
+  assertUnoptimized(f, "no sync");
+}
+
+%UnblockConcurrentRecompilation();
+
+for (var f of functions) {
+  assertOptimized(f, "sync");
+}
+assertEquals(2, f1(1));
+assertEquals(4, f2(2));
+assertEquals(0, f3(3));
@@ -82,8 +82,18 @@ var workerScript =
            if (t[i] !== i)
              throw new Error('ArrayBuffer transfer value ' + i);
          break;
+       case 10:
+         if (!(m instanceof Map) ||
+             JSON.stringify(Array.from(m)) !== '[[1,"one"],["two",[2]]]')
+           throw new Error('Map');
+         break;
+       case 11:
+         if (!(m instanceof Set) ||
+             JSON.stringify(Array.from(m)) !== '[3,"four",{"five":5}]')
+           throw new Error('Set');
+         break;
      }
-     if (c == 10) {
+     if (c == 12) {
        postMessage('DONE');
      }
    };`;
@@ -121,6 +131,9 @@ if (this.Worker) {
   w.postMessage(ab2, [ab2]);
   assertEquals(0, ab2.byteLength);  // ArrayBuffer should be neutered.
 
+  w.postMessage(new Map([[1, "one"], ["two", [2]]]));
+  w.postMessage(new Set([3, "four", {five: 5}]));
+
   assertEquals("undefined", typeof foo);
 
   // Read a message from the worker.
@@ -22,6 +22,10 @@ function f4() {
   return 4;
 }
 
+function makeAdder() {
+  return function(a) { return a + 1; };
+}
+
 
 function optimize(f) {
   f();
@@ -33,6 +37,7 @@ function optimize(f) {
 optimize(f1);
 optimize(f2);
 optimize(f3);
+optimize(makeAdder());
 
 Debug.setListener(function() {});
 
@@ -47,6 +52,10 @@ assertUnoptimized(f1);
 assertOptimized(f2);
 assertUnoptimized(f3);
 
+// Cached optimized code that does not inline f1 is kept, so new closures
+// still start out optimized.
+assertOptimized(makeAdder());
+
 // We can optimize with break points set.
 optimize(f4);
 assertOptimized(f4);
@@ -216,3 +216,42 @@
   assertEquals(iter, iter[Symbol.iterator]());
   assertEquals(iter[Symbol.iterator].name, '[Symbol.iterator]');
 })();
+
+
+(function TestEntriesAreFreshArrays() {
+  var map = new Map([[1, 'a'], [2, 'b']]);
+  var iter = map.entries();
+  var first = iter.next().value;
+  var second = iter.next().value;
+  assertArrayEquals([1, 'a'], first);
+  assertArrayEquals([2, 'b'], second);
+  assertTrue(first !== second);
+  first[0] = 42;
+  assertArrayEquals([2, 'b'], second);
+  assertEquals(1, map.keys().next().value);
+
+  var set = new Set(['x', 'y']);
+  var setIter = set.entries();
+  var a = setIter.next().value;
+  var b = setIter.next().value;
+  assertArrayEquals(['x', 'x'], a);
+  assertArrayEquals(['y', 'y'], b);
+  assertTrue(a !== b);
+  var done = setIter.next();
+  assertTrue(done.done);
+  assertEquals(undefined, done.value);
+})();
+
+
+(function TestInterleavedIterators() {
+  var map = new Map([[1, 'a'], [2, 'b']]);
+  var set = new Set([3, 4]);
+  var keys = map.keys();
+  var values = set.values();
+  assertEquals(1, keys.next().value);
+  assertEquals(3, values.next().value);
+  assertEquals(2, keys.next().value);
+  assertEquals(4, values.next().value);
+  assertTrue(keys.next().done);
+  assertTrue(values.next().done);
+})();
@@ -0,0 +1,55 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-debug-as debug
+
+// Test that the catch block desugared around a for-of body, which only closes
+// the iterator and rethrows, does not count as catching the exception.
+
+Debug = debug.Debug;
+
+var expected_uncaught = [];
+var exception = null;
+
+function listener(event, exec_state, event_data, data) {
+  try {
+    if (event == Debug.DebugEvent.Exception) {
+      assertTrue(expected_uncaught.length > 0);
+      assertEquals(expected_uncaught.shift(), event_data.uncaught());
+      // Assert that the debug event is triggered at the throw site.
+      assertTrue(exec_state.frame(0).sourceLineText().indexOf("// event") > 0);
+    }
+  } catch (e) {
+    exception = e;
+  }
+}
+
+Debug.setListener(listener);
+
+// With only the for-of around it, the exception is predicted uncaught and
+// rejects the promise.
+Debug.setBreakOnUncaughtException();
+expected_uncaught = [true];
+new Promise(function(resolve, reject) {
+  for (var x of [1, 2]) {
+    throw new Error("uncaught");  // event
+  }
+});
+assertEquals(0, expected_uncaught.length);
+Debug.clearBreakOnUncaughtException();
+
+// An enclosing try-catch still catches it.
+Debug.setBreakOnException();
+expected_uncaught = [false];
+try {
+  for (var x of [1, 2]) {
+    throw new Error("caught");  // event
+  }
+} catch (e) {
+}
+assertEquals(0, expected_uncaught.length);
+Debug.clearBreakOnException();
+
+Debug.setListener(null);
+assertNull(exception);
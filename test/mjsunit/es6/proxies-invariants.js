@@ -0,0 +1,63 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The get, set, has and deleteProperty invariant checks are skipped for
+// targets that cannot violate them; make sure they still fire otherwise.
+
+var lying = {
+  get: function() { return 42; },
+  set: function() { return true; },
+  has: function() { return false; },
+  deleteProperty: function() { return true; }
+};
+
+// Configurable properties on an extensible target: no invariant applies.
+var proxy = new Proxy({a: 1}, lying);
+assertEquals(42, proxy.a);
+assertEquals(42, proxy.b);
+proxy.a = 2;
+assertFalse("a" in proxy);
+assertTrue(delete proxy.a);
+
+// Non-configurable, non-writable data property.
+var target = {};
+Object.defineProperty(target, "x", {value: 1});
+proxy = new Proxy(target, lying);
+assertThrows(function() { return proxy.x; }, TypeError);
+assertThrows(function() { "use strict"; proxy.x = 2; }, TypeError);
+assertThrows(function() { return "x" in proxy; }, TypeError);
+assertThrows(function() { "use strict"; delete proxy.x; }, TypeError);
+assertEquals(42, proxy.y);
+
+// Non-configurable accessor without getter or setter.
+target = {};
+Object.defineProperty(target, "x", {set: function() {}});
+proxy = new Proxy(target, lying);
+assertThrows(function() { return proxy.x; }, TypeError);
+Object.defineProperty(target, "y", {get: function() {}});
+assertThrows(function() { "use strict"; proxy.y = 1; }, TypeError);
+
+// Array length is a non-configurable accessor internally.
+proxy = new Proxy([], lying);
+assertThrows(function() { "use strict"; delete proxy.length; }, TypeError);
+assertThrows(function() { return "length" in proxy; }, TypeError);
+
+// Configurable property on a non-extensible target for has.
+target = {z: 1};
+Object.preventExtensions(target);
+proxy = new Proxy(target, lying);
+assertThrows(function() { return "z" in proxy; }, TypeError);
+assertFalse("w" in proxy);
+
+// A proxy target is asked for its descriptor.
+var log = [];
+var inner = new Proxy({}, {
+  getOwnPropertyDescriptor: function(t, name) {
+    log.push(name);
+    return undefined;
+  }
+});
+proxy = new Proxy(inner, lying);
+assertEquals(42, proxy.p);
+assertEquals(["p"], log);
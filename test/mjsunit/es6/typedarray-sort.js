@@ -53,3 +53,22 @@ for (var constructor of typedArrayConstructors) {
   // Method doesn't work on other objects
   assertThrows(function() { a.sort.call([]); }, TypeError);
 }
+
+// Sorting in the default order matches sorting with an explicit comparator,
+// also for views into the middle of a buffer.
+for (var constructor of typedArrayConstructors) {
+  var values = [];
+  for (var i = 0; i < 1000; i++) values.push((i * 7919) % 1009 - 500);
+  var size = constructor.BYTES_PER_ELEMENT;
+  var buffer = new ArrayBuffer((values.length + 16) * size);
+  var array = new constructor(buffer, 8 * size, values.length);
+  array.set(values);
+  var expected = new constructor(values).sort(function(x, y) { return x - y; });
+  array.sort();
+  assertArrayLikeEquals(array, expected, constructor);
+  // Elements outside the view are left alone.
+  assertArrayLikeEquals(new constructor(buffer, 0, 8), [0, 0, 0, 0, 0, 0, 0, 0],
+                        constructor);
+  assertArrayLikeEquals(new constructor(buffer, (values.length + 8) * size),
+                        [0, 0, 0, 0, 0, 0, 0, 0], constructor);
+}
@@ -533,6 +533,55 @@ function TestTypedArraySet() {
 
 TestTypedArraySet();
 
+function TestTypedArraySetConversions() {
+  // Setting from a typed array of another type converts every element as
+  // storing it from JavaScript would.
+  var values = [0, -0, 1, -1, 1.5, -1.5, 2.5, 127, 128, 255, 256, 32767,
+                32768, 65535, 65536, 2147483647, 2147483648, 4294967295,
+                4294967296, 1e20, -1e20, NaN, Infinity, -Infinity];
+  for (var source_constructor of typedArrayConstructors) {
+    var source = new source_constructor(values);
+    for (var target_constructor of typedArrayConstructors) {
+      var target = new target_constructor(values.length + 2);
+      target.set(source, 1);
+      var expected = new target_constructor(values.length + 2);
+      for (var i = 0; i < source.length; i++) expected[i + 1] = source[i];
+      for (var i = 0; i < target.length; i++) {
+        assertSame(expected[i], target[i]);
+      }
+    }
+  }
+}
+
+TestTypedArraySetConversions();
+
+function TestTypedArrayFromFastArrays() {
+  // Arrays too large for on-heap typed arrays are converted natively when
+  // they have packed Smi or double elements.
+  var smis = [];
+  var doubles = [];
+  for (var i = 0; i < 200; i++) {
+    smis.push(i * 1000 - 100000);
+    doubles.push((i - 100) * 1e7 + 0.5);
+  }
+  doubles[0] = NaN;
+  doubles[1] = -Infinity;
+  doubles[2] = -0;
+  for (var constructor of typedArrayConstructors) {
+    for (var source of [smis, doubles]) {
+      var array = new constructor(source);
+      assertEquals(source.length, array.length);
+      var expected = new constructor(source.length);
+      for (var i = 0; i < source.length; i++) expected[i] = source[i];
+      for (var i = 0; i < array.length; i++) {
+        assertSame(expected[i], array[i]);
+      }
+    }
+  }
+}
+
+TestTypedArrayFromFastArrays();
+
 function TestTypedArraysWithIllegalIndices() {
   var a = new Int32Array(100);
 
@@ -0,0 +1,37 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Loads through the global proxy, with the global object holding the
+// property or sitting on the prototype chain to the holder.
+
+var global = this;
+var global_value = 42;
+Object.defineProperty(global, "global_accessor", {
+  get: function() { return 23; }
+});
+
+function loadValue(o) { return o.global_value; }
+function loadAccessor(o) { return o.global_accessor; }
+function loadFromPrototype(o) { return o.hasOwnProperty; }
+
+for (var i = 0; i < 5; i++) {
+  assertEquals(42, loadValue(global));
+  assertEquals(23, loadAccessor(global));
+  assertEquals(Object.prototype.hasOwnProperty, loadFromPrototype(global));
+}
+
+%OptimizeFunctionOnNextCall(loadValue);
+%OptimizeFunctionOnNextCall(loadAccessor);
+%OptimizeFunctionOnNextCall(loadFromPrototype);
+assertEquals(42, loadValue(global));
+assertEquals(23, loadAccessor(global));
+assertEquals(Object.prototype.hasOwnProperty, loadFromPrototype(global));
+
+// The handlers need to notice changes to the global object.
+global_value = 1;
+assertEquals(1, loadValue(global));
+global.hasOwnProperty = 2;
+assertEquals(2, loadFromPrototype(global));
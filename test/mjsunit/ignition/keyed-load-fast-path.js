@@ -0,0 +1,40 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-filter=load
+
+function load(a, i) {
+  return a[i];
+}
+
+// Packed object elements, monomorphic.
+var a = [1, "2", {}, 4];
+for (var i = 0; i < 10; ++i) {
+  assertEquals(1, load(a, 0));
+  assertEquals("2", load(a, 1));
+  assertEquals(4, load(a, 3));
+  assertEquals(undefined, load(a, 4));
+  assertEquals(undefined, load(a, -1));
+}
+
+// Holes beyond the length of the array go to the IC.
+a.length = 2;
+assertEquals(undefined, load(a, 3));
+Array.prototype[3] = "proto";
+assertEquals("proto", load(a, 3));
+delete Array.prototype[3];
+
+// Non-smi keys and other receivers.
+assertEquals("2", load(a, "1"));
+assertEquals(2, load(a, "length"));
+assertEquals("b", load("abc", 1));
+assertEquals(undefined, load(1, 0));
+
+// Packed smi elements.
+var b = [1, 2, 3];
+for (var i = 0; i < 10; ++i) {
+  assertEquals(3, load(b, 2));
+}
+b[1] = 1.5;
+assertEquals(1.5, load(b, 1));
@@ -0,0 +1,30 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-skip-baseline --turbo-filter=* --ignition-filter=*
+// Flags: --allow-natives-syntax
+
+function sum(n) {
+  var result = 0;
+  for (var i = 0; i < n; ++i) {
+    result += i;
+  }
+  return result;
+}
+
+function run() {
+  var total = 0;
+  for (var i = 0; i < 2000; ++i) {
+    total += sum(100);
+  }
+  return total;
+}
+
+// Keep running until the runtime profiler has tiered up {sum}, which goes
+// straight from bytecode to TurboFan.
+for (var round = 0; round < 100; ++round) {
+  assertEquals(2000 * 4950, run());
+  if (%GetOptimizationStatus(sum, "sync") != 2) break;
+}
+assertOptimized(sum, "sync");
@@ -0,0 +1,29 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings of every length around the word size, with a quote, a backslash
+// or a control character at each position.
+
+for (var length = 0; length < 20; length++) {
+  var plain = "";
+  for (var i = 0; i < length; i++) plain += String.fromCharCode(0x61 + i);
+  assertEquals(plain, JSON.parse('"' + plain + '"'));
+  assertEquals(plain + "\xff", JSON.parse('"' + plain + '\xff"'));
+  assertEquals({key: plain}, JSON.parse('{"key":"' + plain + '"}'));
+  for (var pos = 0; pos <= length; pos++) {
+    var before = plain.substring(0, pos);
+    var after = plain.substring(pos);
+    assertEquals(before + '"' + after,
+                 JSON.parse('"' + before + '\\"' + after + '"'));
+    assertEquals(before + "\\" + after,
+                 JSON.parse('"' + before + '\\\\' + after + '"'));
+    assertThrows(function() {
+      JSON.parse('"' + before + '\n' + after + '"');
+    }, SyntaxError);
+    assertThrows(function() {
+      JSON.parse('"' + before + '\x1f' + after + '"');
+    }, SyntaxError);
+  }
+  assertThrows(function() { JSON.parse('"' + plain); }, SyntaxError);
+}
@@ -0,0 +1,29 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Records whose maps have several transitions, e.g. because records nest
+// objects of a different shape, must still get the right keys and values.
+
+var records = [];
+for (var i = 0; i < 50; i++) {
+  records.push({id: i, name: "n" + i, pos: {x: i / 2, y: 3 * i}, tag: "t"});
+  if (i % 7 == 0) records.push({id: i, label: "odd", pos: {y: i, x: 1}});
+  if (i % 11 == 0) records.push({name: "first", id: i});
+}
+var text = JSON.stringify(records);
+var parsed = JSON.parse(text);
+assertEquals(records, parsed);
+assertEquals(text, JSON.stringify(parsed));
+
+for (var i = 0; i < parsed.length; i++) {
+  assertEquals(Object.keys(records[i]), Object.keys(parsed[i]));
+  assertEquals(Object.keys(records[i].pos || {}),
+               Object.keys(parsed[i].pos || {}));
+}
+
+// Records of the same shape share their map.
+assertTrue(%HaveSameMap(parsed[3], parsed[4]));
+assertTrue(%HaveSameMap(parsed[3].pos, parsed[4].pos));
@@ -0,0 +1,47 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc
+
+// Object.keys returns arrays that share their backing store with the enum
+// cache; writing to one must not affect later results.
+
+function check(object, expected) {
+  var keys = Object.keys(object);
+  assertEquals(expected, keys);
+  return keys;
+}
+
+var o = {a: 1, b: 2, c: 3};
+for (var i = 0; i < 3; i++) {
+  var keys = check(o, ["a", "b", "c"]);
+  keys[0] = "x";
+  keys.push("d");
+  keys.length = 1;
+}
+check(o, ["a", "b", "c"]);
+for (var key in o) assertTrue(key == "a" || key == "b" || key == "c");
+
+// Maps sharing a descriptor array see prefixes of the same enum cache.
+var p = {a: 1, b: 2};
+var q = {a: 1, b: 2, c: 3};
+for (var i = 0; i < 3; i++) {
+  check(p, ["a", "b"]);
+  check(q, ["a", "b", "c"]);
+}
+
+// A different transition from the same descriptor owner, after the longer
+// one has died, still gets its own keys.
+(function() {
+  var r = {x: 1};
+  r.y = 2;
+  r.z = 3;
+  check(r, ["x", "y", "z"]);
+})();
+gc();
+gc();
+var s = {x: 1};
+s.y = 2;
+s.w = 4;
+for (var i = 0; i < 3; i++) check(s, ["x", "y", "w"]);
@@ -25,6 +25,8 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+// Flags: --allow-natives-syntax
+
 // Tests that regexp caching isn't messing things up.
 
 var re1 = /(o)/g;
@@ -34,3 +36,23 @@ assertTrue(/(x)/.test("abcxdef"));
 assertEquals("x", RegExp.$1);
 assertEquals("FxxBar", "FooBar".replace(re1, "x"));
 assertEquals("o", RegExp.$1);
+
+// Global replaces on long internalized subjects are cached. A cached result
+// must only be reused for the same replacement, and must restore the last
+// match info.
+(function() {
+  var subject = "";
+  for (var i = 0; i < 1000; i++) subject += "ab" + i + ";";
+  subject = %InternalizeString(subject);
+  var re = /b(\d+);/g;
+  var expected = subject.replace(re, "[$1]");
+  for (var i = 0; i < 3; i++) {
+    assertEquals("x", "x".replace(/(x)/, "$1"));
+    assertEquals(expected, subject.replace(re, "[$1]"));
+    assertEquals("999", RegExp.$1);
+    assertEquals("b999;", RegExp.lastMatch);
+  }
+  assertEquals(expected.replace(/\[/g, "<").replace(/\]/g, ">"),
+               subject.replace(re, "<$1>"));
+  assertEquals(expected, subject.replace(re, "[$1]"));
+})();
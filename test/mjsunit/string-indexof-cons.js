@@ -0,0 +1,33 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// indexOf on ropes built by concatenation, with matches inside, across and
+// after the leftmost part.
+
+function makeRope(parts) {
+  var result = parts[0];
+  for (var i = 1; i < parts.length; i++) result += parts[i];
+  return result;
+}
+
+var parts = ["Content-Type: text/plain; charset=utf-8\r\n",
+             "X-Request-Id: 0123456789abcdef\r\n\r\n",
+             "body body body body body body body body body body\n",
+             "the end\n"];
+
+var flat = parts.join("");
+var patterns = ["Content", "utf-8", "\r\nX-", "\r\n\r\n", "body", "end",
+                "missing", "8\r\nX", "\n", "C"];
+for (var i = 0; i < patterns.length; i++) {
+  for (var start = 0; start < flat.length; start += 7) {
+    assertEquals(flat.indexOf(patterns[i], start),
+                 makeRope(parts).indexOf(patterns[i], start));
+  }
+}
+
+var twoByte = makeRope(["\u2603 snow", "man \u2603", " done"]);
+assertEquals(0, twoByte.indexOf("\u2603"));
+assertEquals(6, twoByte.indexOf("man"));
+assertEquals(10, twoByte.indexOf("\u2603", 1));
+assertEquals(-1, twoByte.indexOf("\u2604"));
@@ -0,0 +1,37 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches for short one-byte patterns in one-byte subjects, around the
+// boundaries of the word-at-a-time filter.
+
+function naiveIndexOf(subject, pattern, start) {
+  for (var i = Math.max(0, start); i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) === pattern) return i;
+  }
+  return -1;
+}
+
+var alphabet = "aab";
+for (var length = 0; length < 40; length++) {
+  var subject = "";
+  for (var i = 0; i < length; i++) {
+    subject += alphabet[(i * 7 + (i >> 2)) % alphabet.length];
+  }
+  var patterns = ["ab", "ba", "aa", "bb", "aab", "aba", "bab", "abaa",
+                  "aabaa", "baaba", "abaaba"];
+  for (var p = 0; p < patterns.length; p++) {
+    var pattern = patterns[p];
+    for (var start = 0; start <= length + 1; start++) {
+      assertEquals(naiveIndexOf(subject, pattern, start),
+                   subject.indexOf(pattern, start),
+                   subject + ".indexOf(" + pattern + ", " + start + ")");
+    }
+  }
+}
+
+var long = new Array(100).join("x") + "\xff\x80" + new Array(20).join("x");
+assertEquals(99, long.indexOf("\xff\x80"));
+assertEquals(99, long.indexOf("\xff\x80x"));
+assertEquals(-1, long.indexOf("\x80\xff"));
+assertTrue(long.includes("x\xff\x80x"));
@@ -87,3 +87,26 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
     assertContains("Duplicate export", e.toString());
   }
 })();
+
+(function testExportedSameSignature() {
+  var builder = new WasmModuleBuilder();
+
+  builder.addFunction("add", kSig_i_ii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Add])
+    .exportFunc();
+  builder.addFunction("sub", kSig_i_ii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Sub])
+    .exportFunc();
+  builder.addFunction("mul", kSig_i_ii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Mul])
+    .exportFunc();
+
+  var module = builder.instantiate();
+
+  assertEquals(2, module.exports.add.length);
+  assertEquals(2, module.exports.sub.length);
+  assertEquals(13, module.exports.add(8, 5));
+  assertEquals(3, module.exports.sub(8, 5));
+  assertEquals(40, module.exports.mul(8, 5));
+  assertEquals(3, module.exports.sub("8", 5.7));
+})();
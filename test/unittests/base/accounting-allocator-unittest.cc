@@ -0,0 +1,68 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/accounting-allocator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace base {
+
+TEST(AccountingAllocator, PooledSegmentSizes) {
+  EXPECT_TRUE(AccountingAllocator::IsPooledSegmentSize(8 * 1024));
+  EXPECT_TRUE(AccountingAllocator::IsPooledSegmentSize(16 * 1024));
+  EXPECT_TRUE(AccountingAllocator::IsPooledSegmentSize(32 * 1024));
+  EXPECT_FALSE(AccountingAllocator::IsPooledSegmentSize(4 * 1024));
+  EXPECT_FALSE(AccountingAllocator::IsPooledSegmentSize(12 * 1024));
+  EXPECT_FALSE(AccountingAllocator::IsPooledSegmentSize(64 * 1024));
+}
+
+
+TEST(AccountingAllocator, ReusesPooledSegment) {
+  AccountingAllocator allocator;
+  const size_t size = 16 * 1024;
+  void* segment = allocator.AllocateSegment(size);
+  ASSERT_NE(nullptr, segment);
+  EXPECT_EQ(size, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(segment, size);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(size, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(segment, allocator.AllocateSegment(size));
+  EXPECT_EQ(size, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(segment, size);
+}
+
+
+TEST(AccountingAllocator, DoesNotPoolOtherSizes) {
+  AccountingAllocator allocator;
+  const size_t size = 12 * 1024;
+  void* segment = allocator.AllocateSegment(size);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment, size);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+
+TEST(AccountingAllocator, PoolIsBounded) {
+  AccountingAllocator allocator;
+  const size_t size = 8 * 1024;
+  const size_t count = AccountingAllocator::kMaxPooledSegmentsPerSize + 1;
+  void* segments[count];
+  for (size_t i = 0; i < count; i++) {
+    segments[i] = allocator.AllocateSegment(size);
+    ASSERT_NE(nullptr, segments[i]);
+  }
+  for (size_t i = 0; i < count; i++) {
+    allocator.ReturnSegment(segments[i], size);
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(AccountingAllocator::kMaxPooledSegmentsPerSize * size,
+            allocator.GetCurrentPoolSize());
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+}  // namespace base
+}  // namespace v8
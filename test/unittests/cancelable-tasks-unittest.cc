@@ -15,15 +15,24 @@ namespace {
 
 class TestTask : public Task, public Cancelable {
  public:
-  enum Mode { kDoNothing, kWaitTillCanceledAgain, kCheckNotRun };
+  enum Mode {
+    kDoNothing,
+    kWaitTillCanceledAgain,
+    kCheckNotRun,
+    kCheckNotCounted
+  };
 
   TestTask(CancelableTaskManager* parent, base::AtomicWord* result,
-           Mode mode = kDoNothing)
-      : Cancelable(parent), result_(result), mode_(mode) {}
+           Mode mode = kDoNothing, bool on_background_thread = true)
+      : Cancelable(parent),
+        parent_(parent),
+        result_(result),
+        mode_(mode),
+        on_background_thread_(on_background_thread) {}
 
   // Task overrides.
   void Run() final {
-    if (TryRun()) {
+    if (TryRun(on_background_thread_)) {
       RunInternal();
     }
   }
@@ -42,13 +51,19 @@ class TestTask : public Task, public Cancelable {
         // Check that we never execute {RunInternal}.
         EXPECT_TRUE(false);
         break;
+      case kCheckNotCounted:
+        // Check that the task is not counted as running.
+        EXPECT_EQ(0, parent_->NumberOfRunningTasks());
+        break;
       default:
         break;
     }
   }
 
+  CancelableTaskManager* parent_;
   base::AtomicWord* result_;
   Mode mode_;
+  bool on_background_thread_;
 };
 
 
@@ -205,6 +220,47 @@ TEST(CancelableTask, RemoveAfterCancelAndWait) {
 }
 
 
+TEST(CancelableTask, NumberOfRunningTasks) {
+  CancelableTaskManager manager;
+  ResultType result1 = 0;
+  ResultType result2 = 0;
+  TestTask* task1 =
+      new TestTask(&manager, &result1, TestTask::kWaitTillCanceledAgain);
+  TestTask* task2 = new TestTask(&manager, &result2, TestTask::kCheckNotRun);
+  uint32_t id1 = task1->id();
+  ThreadedRunner runner1(task1);
+  ThreadedRunner runner2(task2);
+  EXPECT_EQ(0, manager.NumberOfRunningTasks());
+  runner1.Start();
+  // Busy wait on result to make sure the task is running.
+  while (GetValue(&result1) == 0) {
+  }
+  EXPECT_EQ(1, manager.NumberOfRunningTasks());
+  // Aborting a running task fails, but makes it return.
+  EXPECT_FALSE(manager.TryAbort(id1));
+  runner1.Join();
+  EXPECT_EQ(0, manager.NumberOfRunningTasks());
+  // Canceled tasks are never counted.
+  manager.CancelAndWait();
+  runner2.Start();
+  runner2.Join();
+  EXPECT_EQ(0, manager.NumberOfRunningTasks());
+}
+
+
+TEST(CancelableTask, ForegroundTasksNotCounted) {
+  CancelableTaskManager manager;
+  ResultType result1 = 0;
+  TestTask* task1 = new TestTask(&manager, &result1, TestTask::kCheckNotCounted,
+                                 false);
+  SequentialRunner runner1(task1);
+  runner1.Run();
+  EXPECT_EQ(GetValue(&result1), 1);
+  EXPECT_EQ(0, manager.NumberOfRunningTasks());
+  manager.CancelAndWait();
+}
+
+
 TEST(CancelableTask, RemoveUnmanagedId) {
   CancelableTaskManager manager;
   EXPECT_FALSE(manager.TryAbort(1));
@@ -69,6 +69,77 @@ TEST_F(LoadEliminationTest, LoadFieldWithStoreField) {
   EXPECT_EQ(value, r4.replacement());
 }
 
+
+TEST_F(LoadEliminationTest, LoadFieldAcrossDiamond) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* value = Parameter(Type::Any(), 1);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  FieldAccess access = AccessBuilder::ForContextSlot(42);
+  Node* load1 = graph()->NewNode(simplified()->LoadField(access), object,
+                                 effect, control);
+  Node* branch = graph()->NewNode(common()->Branch(), value, control);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = graph()->NewNode(
+      simplified()->StoreElement(AccessBuilder::ForFixedArrayElement()),
+      value, Int32Constant(0), value, load1, if_true);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = load1;
+  Node* merge = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* ephi =
+      graph()->NewNode(common()->EffectPhi(2), etrue, efalse, merge);
+
+  Reduction r = Reduce(graph()->NewNode(simplified()->LoadField(access),
+                                        object, ephi, merge));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldAcrossDiamondWithStore) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* value = Parameter(Type::Any(), 1);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  FieldAccess access = AccessBuilder::ForContextSlot(42);
+  Node* load1 = graph()->NewNode(simplified()->LoadField(access), object,
+                                 effect, control);
+  Node* branch = graph()->NewNode(common()->Branch(), value, control);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = graph()->NewNode(simplified()->StoreField(access), object,
+                                 value, load1, if_true);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = load1;
+  Node* merge = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* ephi =
+      graph()->NewNode(common()->EffectPhi(2), etrue, efalse, merge);
+
+  Reduction r = Reduce(graph()->NewNode(simplified()->LoadField(access),
+                                        object, ephi, merge));
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldAcrossLoop) {
+  Node* object = Parameter(Type::Any(), 0);
+  Node* effect = graph()->start();
+  Node* control = graph()->start();
+
+  FieldAccess access = AccessBuilder::ForContextSlot(42);
+  Node* load1 = graph()->NewNode(simplified()->LoadField(access), object,
+                                 effect, control);
+  Node* loop = graph()->NewNode(common()->Loop(2), control, control);
+  Node* ephi = graph()->NewNode(common()->EffectPhi(2), load1, load1, loop);
+  ephi->ReplaceInput(1, ephi);
+  loop->ReplaceInput(1, loop);
+
+  Reduction r = Reduce(graph()->NewNode(simplified()->LoadField(access),
+                                        object, ephi, loop));
+  ASSERT_FALSE(r.Changed());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,181 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopInvariantCodeMotionTest : public GraphTest {
+ public:
+  LoopInvariantCodeMotionTest()
+      : GraphTest(2),
+        javascript_(zone()),
+        machine_(zone()),
+        simplified_(zone()) {}
+  ~LoopInvariantCodeMotionTest() override {}
+
+ protected:
+  int Hoist() {
+    Zone zone(isolate()->allocator());
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), &zone);
+    JSGraph jsgraph(isolate(), graph(), common(), javascript(), simplified(),
+                    &machine_);
+    LoopInvariantCodeMotion licm(&jsgraph, loop_tree, &zone);
+    return licm.Run();
+  }
+
+  // Builds a loop whose body starts with a load of {object}'s elements and
+  // optionally ends with a store to {object}'s properties. The load is
+  // optionally preceded by a stack check.
+  void BuildLoop(Node* object, bool with_store, bool with_stack_check = false) {
+    loop_ = graph()->NewNode(common()->Loop(2), start(), start());
+    effect_phi_ =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop_);
+    if (object == nullptr) {
+      object = graph()->NewNode(
+          common()->Phi(MachineRepresentation::kTagged, 2), Parameter(0),
+          Parameter(0), loop_);
+    }
+    Node* effect = effect_phi_;
+    Node* control = loop_;
+    if (with_stack_check) {
+      effect = control =
+          graph()->NewNode(javascript()->StackCheck(), Parameter(1),
+                           EmptyFrameState(), effect_phi_, loop_);
+    }
+    load_ = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSObjectElements()), object,
+        effect, control);
+    effect = load_;
+    if (with_store) {
+      effect = graph()->NewNode(
+          simplified()->StoreField(AccessBuilder::ForJSObjectProperties()),
+          object, load_, effect, control);
+    }
+    Node* branch = graph()->NewNode(common()->Branch(), Parameter(1), control);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    loop_->ReplaceInput(1, if_true);
+    effect_phi_->ReplaceInput(1, effect);
+    Node* ret =
+        graph()->NewNode(common()->Return(), load_, effect_phi_, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  // Builds a loop the way the graph builders do for JavaScript: the header
+  // loads {object}'s elements to test the loop condition, and the body only
+  // consists of a stack check.
+  void BuildJSLoop(Node* object) {
+    loop_ = graph()->NewNode(common()->Loop(2), start(), start());
+    effect_phi_ =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop_);
+    load_ = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSObjectElements()), object,
+        effect_phi_, loop_);
+    Node* branch = graph()->NewNode(common()->Branch(), load_, loop_);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    stack_check_ = graph()->NewNode(javascript()->StackCheck(), Parameter(1),
+                                    EmptyFrameState(), load_, if_true);
+    Node* if_success = graph()->NewNode(common()->IfSuccess(), stack_check_);
+    loop_->ReplaceInput(1, if_success);
+    effect_phi_->ReplaceInput(1, stack_check_);
+    Node* ret = graph()->NewNode(common()->Return(), load_, load_, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  JSOperatorBuilder* javascript() { return &javascript_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  Node* loop_ = nullptr;
+  Node* effect_phi_ = nullptr;
+  Node* load_ = nullptr;
+  Node* stack_check_ = nullptr;
+
+ private:
+  JSOperatorBuilder javascript_;
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+};
+
+
+TEST_F(LoopInvariantCodeMotionTest, HoistInvariantLoad) {
+  BuildLoop(Parameter(0), false);
+  EXPECT_EQ(1, Hoist());
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(load_));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(load_));
+  EXPECT_EQ(load_, effect_phi_->InputAt(0));
+  EXPECT_EQ(effect_phi_, effect_phi_->InputAt(1));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, NoHoistWithStoreInLoop) {
+  BuildLoop(Parameter(0), true);
+  EXPECT_EQ(0, Hoist());
+  EXPECT_EQ(effect_phi_, NodeProperties::GetEffectInput(load_));
+  EXPECT_EQ(loop_, NodeProperties::GetControlInput(load_));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, NoHoistPastStackCheck) {
+  BuildLoop(Parameter(0), false, true);
+  EXPECT_EQ(0, Hoist());
+  EXPECT_EQ(IrOpcode::kJSStackCheck,
+            NodeProperties::GetEffectInput(load_)->opcode());
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, HoistInvariantLoadOutOfJSLoop) {
+  BuildJSLoop(Parameter(0));
+  EXPECT_EQ(1, Hoist());
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(load_));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(load_));
+  EXPECT_EQ(load_, effect_phi_->InputAt(0));
+
+  // The loop uses the hoisted value through a loop phi...
+  Node* ret = graph()->end()->InputAt(0);
+  Node* phi = ret->InputAt(0);
+  EXPECT_EQ(IrOpcode::kPhi, phi->opcode());
+  EXPECT_EQ(loop_, NodeProperties::GetControlInput(phi));
+  EXPECT_EQ(load_, phi->InputAt(0));
+
+  // ...whose back edge value is only reloaded after the stack check was
+  // actually taken.
+  Node* value = phi->InputAt(1);
+  EXPECT_EQ(IrOpcode::kPhi, value->opcode());
+  EXPECT_EQ(phi, value->InputAt(0));
+  Node* reload = value->InputAt(1);
+  EXPECT_EQ(load_->op(), reload->op());
+  EXPECT_EQ(stack_check_, NodeProperties::GetEffectInput(reload));
+  EXPECT_EQ(IrOpcode::kIfFalse,
+            NodeProperties::GetControlInput(stack_check_)->opcode());
+  Node* ephi = effect_phi_->InputAt(1);
+  EXPECT_EQ(IrOpcode::kEffectPhi, ephi->opcode());
+  EXPECT_EQ(load_, ephi->InputAt(0));
+  EXPECT_EQ(reload, ephi->InputAt(1));
+}
+
+
+TEST_F(LoopInvariantCodeMotionTest, NoHoistOfVariantLoad) {
+  BuildLoop(nullptr, false);
+  EXPECT_EQ(0, Hoist());
+  EXPECT_EQ(effect_phi_, NodeProperties::GetEffectInput(load_));
+  EXPECT_EQ(loop_, NodeProperties::GetControlInput(load_));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
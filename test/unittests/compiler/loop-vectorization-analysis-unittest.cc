@@ -0,0 +1,112 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVectorizationAnalysisTest : public GraphTest {
+ public:
+  LoopVectorizationAnalysisTest() : GraphTest(3), simplified_(zone()) {}
+  ~LoopVectorizationAnalysisTest() override {}
+
+ protected:
+  // Builds the loop
+  //
+  //   for (i = 0; i < bound; i++) dst[i + store_offset] = src[i] * 2;
+  //
+  // over a typed array of the given {type}.
+  void BuildLoop(ExternalArrayType type, Node* bound, Node* src, Node* dst,
+                 bool store_offset = false) {
+    ElementAccess access = AccessBuilder::ForTypedArrayElement(type, true);
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* phi =
+        graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                         NumberConstant(0), NumberConstant(0), loop);
+    Node* check =
+        graph()->NewNode(simplified()->NumberLessThan(), phi, bound);
+    Node* branch = graph()->NewNode(common()->Branch(), check, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* load =
+        graph()->NewNode(simplified()->LoadElement(access), src, phi,
+                         effect_phi, if_true);
+    Node* value = graph()->NewNode(simplified()->NumberMultiply(), load,
+                                   NumberConstant(2));
+    Node* increment =
+        graph()->NewNode(simplified()->NumberAdd(), phi, NumberConstant(1));
+    Node* store = graph()->NewNode(simplified()->StoreElement(access), dst,
+                                   store_offset ? increment : phi, value, load,
+                                   if_true);
+    phi->ReplaceInput(1, increment);
+    effect_phi->ReplaceInput(1, store);
+    loop->ReplaceInput(1, if_true);
+    Node* ret =
+        graph()->NewNode(common()->Return(), phi, effect_phi, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  const ZoneVector<VectorizableLoop>& Analyze() {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+    analysis_ = new (zone()) LoopVectorizationAnalysis(loop_tree, zone());
+    analysis_->Run();
+    return analysis_->candidates();
+  }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  LoopVectorizationAnalysis* analysis_ = nullptr;
+};
+
+
+TEST_F(LoopVectorizationAnalysisTest, Float64Map) {
+  Node* bound = Parameter(0);
+  BuildLoop(kExternalFloat64Array, bound, Parameter(1), Parameter(2));
+  const ZoneVector<VectorizableLoop>& candidates = Analyze();
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_EQ(MachineRepresentation::kFloat64,
+            candidates[0].element_representation);
+  EXPECT_EQ(2, candidates[0].lanes);
+  EXPECT_EQ(bound, candidates[0].bound);
+  EXPECT_TRUE(candidates[0].needs_alias_check);
+}
+
+
+TEST_F(LoopVectorizationAnalysisTest, InPlaceFloat32Map) {
+  Node* array = Parameter(1);
+  BuildLoop(kExternalFloat32Array, Parameter(0), array, array);
+  const ZoneVector<VectorizableLoop>& candidates = Analyze();
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_EQ(4, candidates[0].lanes);
+  EXPECT_FALSE(candidates[0].needs_alias_check);
+}
+
+
+TEST_F(LoopVectorizationAnalysisTest, Int32MultiplyIsNotVectorizable) {
+  BuildLoop(kExternalInt32Array, Parameter(0), Parameter(1), Parameter(2));
+  EXPECT_TRUE(Analyze().empty());
+}
+
+
+TEST_F(LoopVectorizationAnalysisTest, ShiftedIndexIsNotVectorizable) {
+  BuildLoop(kExternalFloat64Array, Parameter(0), Parameter(1), Parameter(2),
+            true);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -545,6 +545,29 @@ TARGET_TEST_F(SchedulerTest, BranchHintFalse) {
 }
 
 
+TARGET_TEST_F(SchedulerTest, BranchToDeoptimize) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* br = graph()->NewNode(common()->Branch(), p0, start);
+  Node* t = graph()->NewNode(common()->IfTrue(), br);
+  Node* f = graph()->NewNode(common()->IfFalse(), br);
+  Node* deopt = graph()->NewNode(
+      common()->Deoptimize(DeoptimizeKind::kEager), p0, start, t);
+  Node* ret = graph()->NewNode(common()->Return(), p0, start, f);
+  Node* end = graph()->NewNode(common()->End(2), ret, deopt);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(8);
+  // Make sure the block leading to the deoptimization is deferred.
+  EXPECT_TRUE(schedule->block(t)->deferred());
+  EXPECT_FALSE(schedule->block(f)->deferred());
+  EXPECT_FALSE(schedule->block(p0)->deferred());
+}
+
+
 TARGET_TEST_F(SchedulerTest, CallException) {
   Node* start = graph()->NewNode(common()->Start(1));
   graph()->SetStart(start);
@@ -158,6 +158,25 @@ TEST_F(ZonePoolTest, SimpleAllocationLoop) {
   ExpectForPool(0, max_loop_allocation, total_allocated);
 }
 
+TEST_F(ZonePoolTest, Budget) {
+  base::AccountingAllocator allocator;
+  ZoneBudget budget(64 * KB);
+  {
+    ZonePool zone_pool(&allocator, &budget);
+    {
+      ZonePool::Scope scope(&zone_pool);
+      scope.zone()->New(32 * KB);
+      EXPECT_LT(0u, budget.allocated_bytes());
+      EXPECT_FALSE(budget.exceeded());
+      scope.zone()->New(64 * KB);
+      EXPECT_TRUE(budget.exceeded());
+    }
+    // Returned zones keep a small segment around for reuse.
+    EXPECT_FALSE(budget.exceeded());
+  }
+  EXPECT_EQ(0u, budget.allocated_bytes());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -24,6 +24,7 @@ class GCIdleTimeHandlerTest : public ::testing::Test {
     result.contexts_disposed = 0;
     result.contexts_disposal_rate = GCIdleTimeHandler::kHighContextDisposalRate;
     result.incremental_marking_stopped = false;
+    result.can_start_incremental_marking = false;
     return result;
   }
 
@@ -172,6 +173,22 @@ TEST_F(GCIdleTimeHandlerTest, DoNotStartIncrementalMarking) {
 }
 
 
+TEST_F(GCIdleTimeHandlerTest, StartIncrementalMarkingInLongIdleTime) {
+  if (!FLAG_incremental_marking) return;
+  GCIdleTimeHeapState heap_state = DefaultHeapState();
+  heap_state.incremental_marking_stopped = true;
+  heap_state.can_start_incremental_marking = true;
+  double idle_time_ms =
+      static_cast<double>(GCIdleTimeHandler::kMaxFrameRenderingIdleTime);
+  GCIdleTimeAction action = handler()->Compute(idle_time_ms, heap_state);
+  EXPECT_EQ(DONE, action.type);
+  idle_time_ms = static_cast<double>(
+      GCIdleTimeHandler::kMinIdleTimeToStartIncrementalMarking);
+  action = handler()->Compute(idle_time_ms, heap_state);
+  EXPECT_EQ(DO_INCREMENTAL_STEP, action.type);
+}
+
+
 TEST_F(GCIdleTimeHandlerTest, ContinueAfterStop) {
   GCIdleTimeHeapState heap_state = DefaultHeapState();
   heap_state.incremental_marking_stopped = true;
@@ -11,6 +11,7 @@
 #include "src/handles.h"
 #include "src/handles-inl.h"
 
+#include "src/heap/heap-growing-policy.h"
 #include "src/heap/heap.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -44,5 +45,22 @@ TEST(Heap, HeapGrowingFactor) {
                     Heap::HeapGrowingFactor(400, 1));
 }
 
+
+TEST(Heap, ThroughputHeapGrowingPolicy) {
+  ThroughputHeapGrowingPolicy policy(0.01);
+  CheckEqualRounded(ThroughputHeapGrowingPolicy::kMaxGrowingFactor,
+                    policy.GrowingFactor(0, 1));
+  CheckEqualRounded(ThroughputHeapGrowingPolicy::kMaxGrowingFactor,
+                    policy.GrowingFactor(100, 1));
+  CheckEqualRounded(2.0, policy.GrowingFactor(198, 1));
+  CheckEqualRounded(Heap::kMinHeapGrowingFactor, policy.GrowingFactor(1e5, 1));
+  // With the same measurements the policy grows the heap at least as much as
+  // the default one.
+  DefaultHeapGrowingPolicy default_policy;
+  EXPECT_LE(default_policy.GrowingFactor(200, 1), policy.GrowingFactor(200, 1));
+  EXPECT_FALSE(policy.LimitsGrowthForMemory());
+  EXPECT_TRUE(default_policy.LimitsGrowthForMemory());
+}
+
 }  // namespace internal
 }  // namespace v8
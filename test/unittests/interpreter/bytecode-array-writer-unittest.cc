@@ -249,6 +249,65 @@ TEST_F(BytecodeArrayWriterUnittest, ComplexExample) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, ElideRedundantPositions) {
+  bool old_flag = FLAG_ignition_elide_redundant_positions;
+  FLAG_ignition_elide_redundant_positions = true;
+
+  Write(Bytecode::kLdaNamedProperty, Register(0).ToOperand(), 0, 1,
+        {10, false});
+  Write(Bytecode::kAdd, Register(0).ToOperand(), {10, false});
+  Write(Bytecode::kCall, Register(0).ToOperand(), Register(1).ToOperand(), 1,
+        2, {10, false});
+  Write(Bytecode::kReturn, {10, true});
+
+  // The position of the Add is redundant, but the Call keeps its position
+  // as the debugger uses it as a break location.
+  PositionTableEntry expected_positions[] = {
+      {0, 10, false}, {6, 10, false}, {11, 10, true}};
+  Handle<ByteArray> source_positions =
+      source_position_table_builder()->ToSourcePositionTable();
+  SourcePositionTableIterator source_iterator(*source_positions);
+  for (size_t i = 0; i < arraysize(expected_positions); ++i) {
+    const PositionTableEntry& expected = expected_positions[i];
+    CHECK_EQ(source_iterator.bytecode_offset(), expected.bytecode_offset);
+    CHECK_EQ(source_iterator.source_position(), expected.source_position);
+    CHECK_EQ(source_iterator.is_statement(), expected.is_statement);
+    source_iterator.Advance();
+  }
+  CHECK(source_iterator.done());
+
+  FLAG_ignition_elide_redundant_positions = old_flag;
+}
+
+TEST_F(BytecodeArrayWriterUnittest, CompactTemporaryRegisters) {
+  bool old_flag = FLAG_ignition_compact_registers;
+  FLAG_ignition_compact_registers = true;
+
+  Write(Bytecode::kStar, Register(0).ToOperand());
+  Write(Bytecode::kStar, Register(4).ToOperand());
+  Write(Bytecode::kCall, Register(6).ToOperand(), Register(7).ToOperand(), 2,
+        1);
+  Write(Bytecode::kLdar, Register(300).ToOperand());
+  Write(Bytecode::kReturn);
+  CHECK_EQ(max_register_count(), 301);
+
+  Handle<BytecodeArray> bytecode_array =
+      writer()->ToBytecodeArray(1, 0, factory()->empty_fixed_array());
+  CHECK_EQ(max_register_count(), 6);
+  CHECK_EQ(bytecode_array->frame_size(), 6 * kPointerSize);
+
+  // The local r0 keeps its index and the wide operand keeps its width.
+  static const uint8_t bytes[] = {B(Star), R8(0), B(Star), R8(1),   B(Call),
+                                  R8(2),   R8(3), U8(2),   U8(1),   B(Wide),
+                                  B(Ldar), R16(5), B(Return)};
+  CHECK_EQ(bytecode_array->length(), static_cast<int>(arraysize(bytes)));
+  for (size_t i = 0; i < arraysize(bytes); ++i) {
+    CHECK_EQ(bytecode_array->get(static_cast<int>(i)), bytes[i]);
+  }
+
+  FLAG_ignition_compact_registers = old_flag;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -45,6 +45,22 @@ TEST(TaskQueueTest, Basic) {
 }
 
 
+TEST(TaskQueueTest, ShortRunningTasksFirst) {
+  TaskQueue queue;
+  MockTask long_task;
+  MockTask short_task1;
+  MockTask short_task2;
+  queue.Append(&long_task, Platform::kLongRunningTask);
+  queue.Append(&short_task1, Platform::kShortRunningTask);
+  queue.Append(&short_task2);
+  EXPECT_EQ(&short_task1, queue.GetNext());
+  EXPECT_EQ(&short_task2, queue.GetNext());
+  EXPECT_EQ(&long_task, queue.GetNext());
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(), IsNull());
+}
+
+
 TEST(TaskQueueTest, TerminateMultipleReaders) {
   TaskQueue queue;
   TaskQueueThread thread1(&queue);
@@ -0,0 +1,135 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <sstream>
+#include <string>
+
+#include "src/libplatform/trace-buffer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+const char kPhaseInstant = 'I';
+const char kPhaseComplete = 'X';
+const uint8_t kTypeInt = 3;
+const uint8_t kTypeCopyString = 7;
+const unsigned int kFlagNone = 0;
+const unsigned int kFlagCopy = 1 << 0;
+
+uint64_t AddEvent(TraceBuffer* buffer, const char* category_group,
+                  const char* name, char phase = kPhaseInstant) {
+  return buffer->AddTraceEvent(phase,
+                               buffer->GetCategoryGroupEnabled(category_group),
+                               name, NULL, 0, 0, 0, NULL, NULL, NULL,
+                               kFlagNone);
+}
+
+std::string ToJSON(TraceBuffer* buffer) {
+  std::ostringstream stream;
+  buffer->WriteJSON(stream);
+  return stream.str();
+}
+
+}  // namespace
+
+
+TEST(TraceBufferTest, CategoryFiltering) {
+  TraceBuffer buffer;
+  const uint8_t* v8 = buffer.GetCategoryGroupEnabled("v8");
+  const uint8_t* gc = buffer.GetCategoryGroupEnabled("v8.gc");
+  const uint8_t* group = buffer.GetCategoryGroupEnabled("devtools, v8.gc");
+  EXPECT_EQ(v8, buffer.GetCategoryGroupEnabled("v8"));
+  EXPECT_STREQ("devtools, v8.gc", buffer.GetCategoryGroupName(group));
+  EXPECT_EQ(0, *v8);
+
+  buffer.Start("v8.gc,v8.compile");
+  EXPECT_EQ(0, *v8);
+  EXPECT_NE(0, *gc);
+  EXPECT_NE(0, *group);
+  EXPECT_NE(0, *buffer.GetCategoryGroupEnabled("v8.compile"));
+
+  buffer.Stop();
+  EXPECT_EQ(0, *gc);
+  EXPECT_EQ(0, *group);
+}
+
+
+TEST(TraceBufferTest, RecordsOnlyWhileEnabled) {
+  TraceBuffer buffer;
+  EXPECT_EQ(0u, AddEvent(&buffer, "v8", "Before"));
+  buffer.Start("v8");
+  EXPECT_NE(0u, AddEvent(&buffer, "v8", "During"));
+  EXPECT_EQ(0u, AddEvent(&buffer, "other", "Filtered"));
+  buffer.Stop();
+  EXPECT_EQ(0u, AddEvent(&buffer, "v8", "After"));
+
+  std::string json = ToJSON(&buffer);
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"During\""));
+  EXPECT_EQ(std::string::npos, json.find("Before"));
+  EXPECT_EQ(std::string::npos, json.find("Filtered"));
+  EXPECT_EQ(std::string::npos, json.find("After"));
+}
+
+
+TEST(TraceBufferTest, RingBufferKeepsNewestEvents) {
+  TraceBuffer buffer(2);
+  buffer.Start("v8");
+  AddEvent(&buffer, "v8", "First");
+  AddEvent(&buffer, "v8", "Second");
+  AddEvent(&buffer, "v8", "Third");
+
+  std::string json = ToJSON(&buffer);
+  EXPECT_EQ(std::string::npos, json.find("First"));
+  size_t second = json.find("Second");
+  size_t third = json.find("Third");
+  ASSERT_NE(std::string::npos, second);
+  ASSERT_NE(std::string::npos, third);
+  EXPECT_LT(second, third);
+}
+
+
+TEST(TraceBufferTest, CompleteEventDuration) {
+  TraceBuffer buffer(2);
+  buffer.Start("v8");
+  const uint8_t* v8 = buffer.GetCategoryGroupEnabled("v8");
+  uint64_t handle = AddEvent(&buffer, "v8", "Complete", kPhaseComplete);
+  ASSERT_NE(0u, handle);
+  buffer.UpdateTraceEventDuration(v8, "Complete", handle);
+  EXPECT_NE(std::string::npos, ToJSON(&buffer).find("\"dur\":"));
+
+  // Updating an event that has been overwritten is ignored.
+  AddEvent(&buffer, "v8", "Second");
+  AddEvent(&buffer, "v8", "Third");
+  buffer.UpdateTraceEventDuration(v8, "Complete", handle);
+  EXPECT_EQ(std::string::npos, ToJSON(&buffer).find("Complete"));
+}
+
+
+TEST(TraceBufferTest, CopiedStringsAndArguments) {
+  TraceBuffer buffer;
+  buffer.Start("v8");
+  char name[] = "Copied";
+  char arg_name[] = "size";
+  char value[] = "quote\" and backslash\\";
+  const char* arg_names[] = {arg_name, "count"};
+  const uint8_t arg_types[] = {kTypeCopyString, kTypeInt};
+  const uint64_t arg_values[] = {reinterpret_cast<uint64_t>(value),
+                                 static_cast<uint64_t>(-3)};
+  buffer.AddTraceEvent(kPhaseInstant, buffer.GetCategoryGroupEnabled("v8"),
+                       name, NULL, 0, 0, 2, arg_names, arg_types, arg_values,
+                       kFlagCopy);
+  name[0] = arg_name[0] = value[0] = 'X';
+
+  std::string json = ToJSON(&buffer);
+  EXPECT_NE(std::string::npos, json.find("\"name\":\"Copied\""));
+  EXPECT_NE(std::string::npos,
+            json.find("\"size\":\"quote\\\" and backslash\\\\\""));
+  EXPECT_NE(std::string::npos, json.find("\"count\":-3"));
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -25,6 +25,7 @@
         '../..',
       ],
       'sources': [  ### gcmole(all) ###
+        'base/accounting-allocator-unittest.cc',
         'base/atomic-utils-unittest.cc',
         'base/bits-unittest.cc',
         'base/cpu-unittest.cc',
@@ -73,7 +74,9 @@
         'compiler/liveness-analyzer-unittest.cc',
         'compiler/live-range-unittest.cc',
         'compiler/load-elimination-unittest.cc',
+        'compiler/loop-invariant-code-motion-unittest.cc',
         'compiler/loop-peeling-unittest.cc',
+        'compiler/loop-vectorization-analysis-unittest.cc',
         'compiler/machine-operator-reducer-unittest.cc',
         'compiler/machine-operator-unittest.cc',
         'compiler/move-optimizer-unittest.cc',
@@ -111,6 +114,7 @@
         'interpreter/source-position-table-unittest.cc',
         'libplatform/default-platform-unittest.cc',
         'libplatform/task-queue-unittest.cc',
+        'libplatform/trace-buffer-unittest.cc',
         'libplatform/worker-thread-unittest.cc',
         'heap/bitmap-unittest.cc',
         'heap/gc-idle-time-handler-unittest.cc',
@@ -0,0 +1,224 @@
+#!/usr/bin/env python
+# Copyright 2016 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""
+Looks for performance cliffs: inputs where a small change to a program makes
+it run an order of magnitude slower or deoptimize much more often.
+
+Each generator below produces a family of programs indexed by a size n (the
+number of receiver shapes at a property access, the number of properties
+added to an object, ...). Every variant is run in d8 with --trace-deopt and
+--trace-ic, and variants whose time per iteration or deopt count jumps against
+the previous variant are reported together with the deopt reasons and IC
+transitions that appeared at the jump.
+
+Usage:
+  tools/find-perf-cliffs.py --d8 out/x64.release/d8 [--generator=name]
+"""
+
+from __future__ import print_function
+
+import optparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+
+ITERATIONS = 200000
+
+TIMING_FOOTER = """
+var start = performance.now();
+for (var i = 0; i < %(iterations)d; i++) run(i);
+print("perf-cliffs-time: " + (performance.now() - start));
+"""
+
+
+def PolymorphicLoad(n):
+  # A single load site that sees n receiver maps.
+  return """
+var objects = [];
+for (var k = 0; k < %(n)d; k++) {
+  var o = {x: k};
+  o["p" + k] = k;
+  objects.push(o);
+}
+function load(o) { return o.x; }
+function run(i) { return load(objects[i %% objects.length]); }
+""" % {"n": n}
+
+
+def AddedProperties(n):
+  # An object that gets n properties added one by one; past a threshold it
+  # goes to dictionary mode.
+  return """
+function make() {
+  var o = {};
+  for (var k = 0; k < %(n)d; k++) o["p" + k] = k;
+  return o;
+}
+var object = make();
+function run(i) { return object.p0 + object["p" + (i %% %(n)d)]; }
+""" % {"n": n}
+
+
+def MixedElements(n):
+  # An array function that sees n different elements kinds.
+  kinds = ["1", "1.5", "'s'", "{}", "undefined", "null", "true"]
+  values = ", ".join(kinds[k % len(kinds)] for k in range(n))
+  return """
+var arrays = [%(values)s].map(function(v) { return [v, v, v]; });
+function first(a) { return a[0]; }
+function run(i) { return first(arrays[i %% arrays.length]); }
+""" % {"values": values}
+
+
+def DeletedProperties(n):
+  # Deleting the last n properties of an object.
+  return """
+function make() {
+  var o = {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8};
+  var names = Object.keys(o);
+  for (var k = 0; k < %(n)d && k < names.length; k++) {
+    delete o[names[names.length - 1 - k]];
+  }
+  return o;
+}
+function run(i) { return make().a; }
+""" % {"n": n}
+
+
+GENERATORS = {
+  "polymorphic-load": (PolymorphicLoad, range(1, 9)),
+  "added-properties": (AddedProperties, range(1, 160, 8)),
+  "mixed-elements": (MixedElements, range(1, 8)),
+  "deleted-properties": (DeletedProperties, range(0, 9)),
+}
+
+
+DEOPT_REASON_RE = re.compile(r";;; deoptimize at [^:]+: (.+)$")
+DEOPT_BEGIN_RE = re.compile(r"^\[deoptimizing \(DEOPT (\w+)\): begin")
+IC_RE = re.compile(r"^\[(\w+) in .* \((.)->(.)[^)]*\)")
+TIME_RE = re.compile(r"^perf-cliffs-time: (.+)$")
+
+
+class Result(object):
+
+  def __init__(self, n):
+    self.n = n
+    self.time = None
+    self.deopts = 0
+    self.deopt_reasons = {}
+    self.ic_transitions = {}
+
+  def TimePerIteration(self):
+    return self.time / ITERATIONS
+
+
+def RunVariant(d8, extra_flags, source, n):
+  with tempfile.NamedTemporaryFile(suffix=".js", delete=False) as f:
+    f.write((source + TIMING_FOOTER % {"iterations": ITERATIONS}).encode())
+    path = f.name
+  try:
+    command = [d8, "--trace-deopt", "--trace-ic"] + extra_flags + [path]
+    output = subprocess.check_output(command, stderr=subprocess.STDOUT)
+  finally:
+    os.unlink(path)
+
+  result = Result(n)
+  for line in output.decode("utf-8", "replace").splitlines():
+    match = TIME_RE.match(line)
+    if match:
+      result.time = float(match.group(1))
+      continue
+    if DEOPT_BEGIN_RE.match(line):
+      result.deopts += 1
+      continue
+    match = DEOPT_REASON_RE.search(line)
+    if match:
+      reason = match.group(1)
+      result.deopt_reasons[reason] = result.deopt_reasons.get(reason, 0) + 1
+      continue
+    match = IC_RE.match(line)
+    if match and match.group(3) in "NG":
+      key = "%s %s->%s" % match.groups()
+      result.ic_transitions[key] = result.ic_transitions.get(key, 0) + 1
+  if result.time is None:
+    raise Exception("No timing in output of %s" % " ".join(command))
+  return result
+
+
+def NewKeys(current, previous):
+  return sorted(k for k in current if k not in previous)
+
+
+def FindCliffs(results, time_ratio, deopt_delta):
+  cliffs = []
+  for previous, current in zip(results, results[1:]):
+    reasons = []
+    if (previous.TimePerIteration() > 0 and
+        current.TimePerIteration() / previous.TimePerIteration() >=
+            time_ratio):
+      reasons.append("time %.1fx" % (current.TimePerIteration() /
+                                     previous.TimePerIteration()))
+    if current.deopts - previous.deopts >= deopt_delta:
+      reasons.append("deopts %d -> %d" % (previous.deopts, current.deopts))
+    if reasons:
+      cliffs.append((previous, current, reasons))
+  return cliffs
+
+
+def BuildOptions():
+  result = optparse.OptionParser()
+  result.add_option("--d8", help="Path to the d8 binary", default="d8")
+  result.add_option("--generator", action="append", default=[],
+                    help="Generator to run (default: all), one of %s" %
+                         ", ".join(sorted(GENERATORS)))
+  result.add_option("--flags", default="",
+                    help="Additional flags passed to d8")
+  result.add_option("--time-ratio", type="float", default=5.0,
+                    help="Slowdown against the previous variant that counts "
+                         "as a cliff")
+  result.add_option("--deopt-delta", type="int", default=3,
+                    help="Increase in deopts against the previous variant "
+                         "that counts as a cliff")
+  return result
+
+
+def Main():
+  parser = BuildOptions()
+  (options, args) = parser.parse_args()
+  names = options.generator or sorted(GENERATORS)
+  for name in names:
+    if name not in GENERATORS:
+      parser.error("Unknown generator %s" % name)
+
+  extra_flags = options.flags.split()
+  found = 0
+  for name in names:
+    generator, sizes = GENERATORS[name]
+    results = []
+    for n in sizes:
+      result = RunVariant(options.d8, extra_flags, generator(n), n)
+      print("%s n=%d: %.4f ms/kiter, %d deopts" %
+            (name, n, result.TimePerIteration() * 1000, result.deopts))
+      results.append(result)
+    for previous, current, reasons in FindCliffs(
+        results, options.time_ratio, options.deopt_delta):
+      found += 1
+      print("CLIFF %s n=%d -> n=%d: %s" %
+            (name, previous.n, current.n, ", ".join(reasons)))
+      for reason in NewKeys(current.deopt_reasons, previous.deopt_reasons):
+        print("  new deopt reason: %s (%d)" %
+              (reason, current.deopt_reasons[reason]))
+      for ic in NewKeys(current.ic_transitions, previous.ic_transitions):
+        print("  new IC transition: %s (%d)" %
+              (ic, current.ic_transitions[ic]))
+  return 1 if found else 0
+
+
+if __name__ == "__main__":
+  sys.exit(Main())
@@ -209,7 +209,30 @@ consts_misc = [
         'value': 'UnseededNumberDictionaryShape::kPrefixSize' },
 
     { 'name': 'numberdictionaryshape_entry_size',
-        'value': 'NumberDictionaryShape::kEntrySize' }
+        'value': 'NumberDictionaryShape::kEntrySize' },
+
+    { 'name': 'page_size',
+        'value': 'Page::kPageSize' },
+    { 'name': 'page_alignment_mask',
+        'value': 'Page::kPageAlignmentMask' },
+    { 'name': 'page_object_start_offset',
+        'value': 'Page::kObjectStartOffset' },
+    { 'name': 'chunk_size_offset',
+        'value': 'MemoryChunk::kSizeOffset' },
+    { 'name': 'chunk_flags_offset',
+        'value': 'MemoryChunk::kFlagsOffset' },
+    { 'name': 'chunk_area_start_offset',
+        'value': 'MemoryChunk::kAreaStartOffset' },
+    { 'name': 'chunk_area_end_offset',
+        'value': 'MemoryChunk::kAreaEndOffset' },
+    { 'name': 'chunk_flag_is_executable',
+        'value': 'MemoryChunk::IS_EXECUTABLE' },
+    { 'name': 'chunk_flag_in_from_space',
+        'value': 'MemoryChunk::IN_FROM_SPACE' },
+    { 'name': 'chunk_flag_in_to_space',
+        'value': 'MemoryChunk::IN_TO_SPACE' },
+    { 'name': 'chunk_flag_black_page',
+        'value': 'MemoryChunk::BLACK_PAGE' }
 ];
 
 #
@@ -279,6 +302,7 @@ header = '''
 #include "src/frames.h"
 #include "src/frames-inl.h" /* for architecture-specific frame constants */
 #include "src/contexts.h"
+#include "src/heap/spaces.h"
 
 using namespace v8::internal;
 
@@ -16,7 +16,10 @@ import struct
 
 __DESCRIPTION = """
 Process v8.ignition_dispatches_counters.json and list top counters,
-or plot a dispatch heatmap.
+list superinstruction candidates or plot a dispatch heatmap.
+
+When more than one input file is given, e.g. profiles collected from
+different workloads, the counters are summed up before processing.
 
 Please note that those handlers that may not or will never dispatch
 (e.g. Return or Throw) do not show up in the results.
@@ -43,11 +46,30 @@ examples:
 
   # Display the top 5 sources and destinations of dispatches to/from LdaZero
   $ tools/ignition/bytecode_dispatches_report.py -f LdaZero -n 5
+
+  # Print the 20 best candidates for superinstructions across two profiles
+  $ tools/ignition/bytecode_dispatches_report.py -c -n 20 a.json b.json
 """
 
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
 __COUNTER_MAX = 2**__COUNTER_BITS - 1
 
+# Bytecodes which cannot be the first half of a superinstruction, because
+# they don't (always) fall through to the next bytecode, or because they only
+# modify the operand scale of the next bytecode.
+__NON_FUSABLE_PREFIXES = ("Jump", "Wide", "ExtraWide", "DebugBreak")
+
+
+def merge_dispatches_tables(dispatches_tables):
+  merged_table = {}
+  for dispatches_table in dispatches_tables:
+    for source, counters_from_source in dispatches_table.items():
+      merged_row = merged_table.setdefault(source, {})
+      for destination, counter in counters_from_source.items():
+        merged_row[destination] = min(merged_row.get(destination, 0) + counter,
+                                      __COUNTER_MAX)
+  return merged_table
+
 
 def warn_if_counter_may_have_saturated(dispatches_table):
   for source, counters_from_source in dispatches_table.items():
@@ -75,6 +97,37 @@ def print_top_bytecode_dispatch_pairs(dispatches_table, top_count):
     print "{:>12d}\t{} -> {}".format(counter, source, destination)
 
 
+def is_fusable_bytecode_pair(source, destination):
+  return (not source.startswith(__NON_FUSABLE_PREFIXES) and
+          not destination.startswith(("Wide", "ExtraWide")))
+
+
+def find_superinstruction_candidates(dispatches_table, top_count):
+  def fusable_counters_generator():
+    for source, counters_from_source in dispatches_table.items():
+      for destination, counter in counters_from_source.items():
+        if is_fusable_bytecode_pair(source, destination):
+          yield source, destination, counter
+
+  return heapq.nlargest(top_count, fusable_counters_generator(),
+                        key=lambda x: x[2])
+
+
+def print_superinstruction_candidates(dispatches_table, top_count):
+  candidates = find_superinstruction_candidates(dispatches_table, top_count)
+  total_dispatches = sum(sum(counters_from_source.values())
+                         for counters_from_source in dispatches_table.values())
+  saved_dispatches = sum(counter for _, _, counter in candidates)
+  saved_ratio = float(saved_dispatches) / max(total_dispatches, 1)
+  print "// Top {} superinstruction candidates, covering {:.2%} of {} " \
+        "dispatches.".format(top_count, saved_ratio, total_dispatches)
+  print "#define SUPERINSTRUCTION_CANDIDATE_LIST(V) \\"
+  for source, destination, counter in candidates:
+    print "  V({0}{1}, {0}, {1}) /* {2} */ \\".format(
+        source, destination, counter)
+  print ""
+
+
 def find_top_bytecodes(dispatches_table):
   top_bytecodes = []
   for bytecode, counters_from_bytecode in dispatches_table.items():
@@ -195,12 +248,18 @@ def parse_command_line():
     action="store_true",
     help="print the top bytecode dispatch pairs"
   )
+  command_line_parser.add_argument(
+    "--superinstruction-candidates", "-c",
+    action="store_true",
+    help=("print the top bytecode dispatch pairs that can be fused into "
+          "superinstructions, as a macro list")
+  )
   command_line_parser.add_argument(
     "--top-entries-count", "-n",
     metavar="N",
     type=int,
     default=10,
-    help="print N top entries when running with -t or -f (default 10)"
+    help="print N top entries when running with -t, -c or -f (default 10)"
   )
   command_line_parser.add_argument(
     "--top-dispatches-for-bytecode", "-f",
@@ -215,11 +274,11 @@ def parse_command_line():
           "extension. PDF, SVG, PNG supported")
   )
   command_line_parser.add_argument(
-    "input_filename",
+    "input_filenames",
     metavar="<input filename>",
-    default="v8.ignition_dispatches_table.json",
-    nargs='?',
-    help="Ignition counters JSON file"
+    default=["v8.ignition_dispatches_table.json"],
+    nargs='*',
+    help="Ignition counters JSON files"
   )
 
   return command_line_parser.parse_args()
@@ -228,8 +287,11 @@ def parse_command_line():
 def main():
   program_options = parse_command_line()
 
-  with open(program_options.input_filename) as stream:
-    dispatches_table = json.load(stream)
+  dispatches_tables = []
+  for input_filename in program_options.input_filenames:
+    with open(input_filename) as stream:
+      dispatches_tables.append(json.load(stream))
+  dispatches_table = merge_dispatches_tables(dispatches_tables)
 
   warn_if_counter_may_have_saturated(dispatches_table)
 
@@ -246,6 +308,9 @@ def main():
   elif program_options.top_bytecode_dispatch_pairs:
     print_top_bytecode_dispatch_pairs(
       dispatches_table, program_options.top_entries_count)
+  elif program_options.superinstruction_candidates:
+    print_superinstruction_candidates(
+      dispatches_table, program_options.top_entries_count)
   elif program_options.top_dispatches_for_bytecode:
     print_top_dispatch_sources_and_destinations(
       dispatches_table, program_options.top_dispatches_for_bytecode,
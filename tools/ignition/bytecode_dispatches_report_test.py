@@ -52,3 +52,27 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("c", 12),
       ("a",  8)
     ])
+
+  def test_merge_dispatches_tables(self):
+    merged_table = bdr.merge_dispatches_tables([
+      {"a": {"a": 10, "b": 8}, "b": {"a": 1}},
+      {"a": {"b": 2}, "c": {"c": 5}}
+    ])
+    self.assertDictEqual(merged_table, {
+      "a": {"a": 10, "b": 10},
+      "b": {"a": 1},
+      "c": {"c": 5}
+    })
+
+  def test_find_superinstruction_candidates(self):
+    candidates = bdr.find_superinstruction_candidates({
+      "LdaZero": {"Star": 50, "Wide": 70},
+      "JumpIfTrue": {"LdaZero": 99},
+      "Star": {"LdaZero": 20, "Ldar": 30},
+      "Wide": {"Star": 80}
+    }, 5)
+    self.assertListEqual(candidates, [
+      ("LdaZero", "Star", 50),
+      ("Star", "Ldar", 30),
+      ("Star", "LdaZero", 20)
+    ])